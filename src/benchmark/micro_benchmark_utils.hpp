@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// The micro benchmarks run on single-column tables with this many rows. The chunk sizes and cardinalities (i.e., the
+// number of distinct values) are parameters of most benchmarks. Every chunk size divides the row count, so that all
+// chunks are full and can be compressed.
+constexpr auto MICRO_BENCHMARK_ROW_COUNT = uint32_t{100'000};
+const auto MICRO_BENCHMARK_CHUNK_SIZES = std::vector<int64_t>{1'000, 10'000};
+const auto MICRO_BENCHMARK_CARDINALITIES = std::vector<int64_t>{16, 1'000};
+
+// how the segments of a benchmark table are stored. Reference tables point to an unencoded table.
+enum class SegmentEncoding { Unencoded, Dictionary, Reference };
+
+const auto MICRO_BENCHMARK_SEGMENT_ENCODINGS = std::vector<int64_t>{
+    static_cast<int64_t>(SegmentEncoding::Unencoded), static_cast<int64_t>(SegmentEncoding::Dictionary),
+    static_cast<int64_t>(SegmentEncoding::Reference)};
+
+// Returns the value with the given rank. Strings are zero-padded, so that the values of all types are ordered like
+// their ranks.
+template <typename T>
+T benchmark_value(const uint32_t rank) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto stream = std::stringstream{};
+    stream << std::setw(10) << std::setfill('0') << rank;
+    return stream.str();
+  } else {
+    return static_cast<T>(rank);
+  }
+}
+
+// returns values with ranks uniformly distributed over [0, cardinality). The values only depend on the arguments.
+template <typename T>
+std::vector<T> generate_benchmark_values(const uint32_t row_count, const uint32_t cardinality) {
+  auto generator = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<uint32_t>{0, cardinality - 1};
+
+  auto values = std::vector<T>{};
+  values.reserve(row_count);
+  for (auto row = uint32_t{0}; row < row_count; ++row) values.push_back(benchmark_value<T>(distribution(generator)));
+  return values;
+}
+
+// Returns a table with MICRO_BENCHMARK_ROW_COUNT rows in a single column "a" of type T. Tables are created once per
+// combination of arguments, so that creating them is not part of the measurements of later runs.
+template <typename T>
+std::shared_ptr<const Table> get_benchmark_table(const uint32_t chunk_size, const uint32_t cardinality,
+                                                 const SegmentEncoding encoding) {
+  static auto tables = std::map<std::tuple<uint32_t, uint32_t, SegmentEncoding>, std::shared_ptr<const Table>>{};
+
+  const auto key = std::make_tuple(chunk_size, cardinality, encoding);
+  const auto table_iter = tables.find(key);
+  if (table_iter != tables.cend()) return table_iter->second;
+
+  auto table = std::shared_ptr<const Table>{};
+  if (encoding == SegmentEncoding::Reference) {
+    // selects all rows of the unencoded table
+    const auto table_wrapper =
+        std::make_shared<TableWrapper>(get_benchmark_table<T>(chunk_size, cardinality, SegmentEncoding::Unencoded));
+    table_wrapper->execute();
+    const auto table_scan =
+        std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, benchmark_value<T>(0));
+    table_scan->execute();
+    table = table_scan->get_output();
+  } else {
+    const auto value_table = std::make_shared<Table>(chunk_size);
+    value_table->add_column("a", data_type_from_type<T>());
+    for (const auto& value : generate_benchmark_values<T>(MICRO_BENCHMARK_ROW_COUNT, cardinality)) {
+      value_table->append({value});
+    }
+
+    if (encoding == SegmentEncoding::Dictionary) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < value_table->chunk_count(); ++chunk_id) {
+        value_table->compress_chunk(chunk_id);
+      }
+    }
+    table = value_table;
+  }
+
+  tables.emplace(key, table);
+  return table;
+}
+
+}  // namespace opossum
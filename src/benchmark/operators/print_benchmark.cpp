@@ -0,0 +1,37 @@
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "operators/print.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Arguments: segment encoding, chunk size. Prints a whole table into a stringstream.
+template <typename T>
+void BM_Print(benchmark::State& state) {  // NOLINT
+  const auto encoding = static_cast<SegmentEncoding>(state.range(0));
+  const auto chunk_size = static_cast<uint32_t>(state.range(1));
+  const auto table = get_benchmark_table<T>(chunk_size, 1'000, encoding);
+
+  for (auto _ : state) {
+    auto stream = std::stringstream{};
+    Print::print(table, stream);
+    benchmark::DoNotOptimize(stream.tellp());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * MICRO_BENCHMARK_ROW_COUNT);
+}
+
+void print_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"encoding", "chunk_size"})
+      ->ArgsProduct({MICRO_BENCHMARK_SEGMENT_ENCODINGS, MICRO_BENCHMARK_CHUNK_SIZES});
+}
+
+BENCHMARK_TEMPLATE(BM_Print, int32_t)->Apply(print_arguments);
+BENCHMARK_TEMPLATE(BM_Print, std::string)->Apply(print_arguments);
+
+}  // namespace opossum
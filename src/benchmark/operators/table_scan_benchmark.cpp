@@ -0,0 +1,67 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Arguments: segment encoding, scan type, chunk size, selectivity in percent, cardinality. The search value is the
+// value at the given percentile of the ranks, so that OpLessThan selects roughly the given share of the rows.
+template <typename T>
+void BM_TableScan(benchmark::State& state) {  // NOLINT
+  const auto encoding = static_cast<SegmentEncoding>(state.range(0));
+  const auto scan_type = static_cast<ScanType>(state.range(1));
+  const auto chunk_size = static_cast<uint32_t>(state.range(2));
+  const auto selectivity = static_cast<uint32_t>(state.range(3));
+  const auto cardinality = static_cast<uint32_t>(state.range(4));
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(get_benchmark_table<T>(chunk_size, cardinality, encoding));
+  table_wrapper->execute();
+  const auto search_value = benchmark_value<T>(cardinality * selectivity / 100);
+
+  auto output_row_count = uint64_t{0};
+  for (auto _ : state) {
+    const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, scan_type, search_value);
+    table_scan->execute();
+    output_row_count = table_scan->get_output()->row_count();
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * MICRO_BENCHMARK_ROW_COUNT);
+  state.counters["output_rows"] = static_cast<double>(output_row_count);
+}
+
+// All scan types are only benchmarked for int columns, the other types are scanned for equality and ranges
+void add_table_scan_arguments(benchmark::internal::Benchmark* benchmark, const std::vector<int64_t>& scan_types) {
+  benchmark->ArgNames({"encoding", "scan_type", "chunk_size", "selectivity", "cardinality"})
+      ->ArgsProduct({MICRO_BENCHMARK_SEGMENT_ENCODINGS, scan_types, MICRO_BENCHMARK_CHUNK_SIZES, {1, 50},
+                     MICRO_BENCHMARK_CARDINALITIES});
+}
+
+void all_scan_types(benchmark::internal::Benchmark* benchmark) {
+  add_table_scan_arguments(benchmark, {static_cast<int64_t>(ScanType::OpEquals),
+                                       static_cast<int64_t>(ScanType::OpNotEquals),
+                                       static_cast<int64_t>(ScanType::OpLessThan),
+                                       static_cast<int64_t>(ScanType::OpLessThanEquals),
+                                       static_cast<int64_t>(ScanType::OpGreaterThan),
+                                       static_cast<int64_t>(ScanType::OpGreaterThanEquals)});
+}
+
+void equality_and_range_scans(benchmark::internal::Benchmark* benchmark) {
+  add_table_scan_arguments(
+      benchmark, {static_cast<int64_t>(ScanType::OpEquals), static_cast<int64_t>(ScanType::OpLessThan)});
+}
+
+BENCHMARK_TEMPLATE(BM_TableScan, int32_t)->Apply(all_scan_types);
+BENCHMARK_TEMPLATE(BM_TableScan, int64_t)->Apply(equality_and_range_scans);
+BENCHMARK_TEMPLATE(BM_TableScan, float)->Apply(equality_and_range_scans);
+BENCHMARK_TEMPLATE(BM_TableScan, double)->Apply(equality_and_range_scans);
+BENCHMARK_TEMPLATE(BM_TableScan, std::string)->Apply(equality_and_range_scans);
+
+}  // namespace opossum
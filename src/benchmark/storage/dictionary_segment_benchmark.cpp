@@ -0,0 +1,42 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Arguments: segment size (i.e., chunk size), cardinality
+template <typename T>
+void BM_DictionarySegmentConstruction(benchmark::State& state) {  // NOLINT
+  const auto segment_size = static_cast<uint32_t>(state.range(0));
+  const auto cardinality = static_cast<uint32_t>(state.range(1));
+
+  const auto value_segment = std::make_shared<ValueSegment<T>>();
+  for (const auto& value : generate_benchmark_values<T>(segment_size, cardinality)) value_segment->append(value);
+
+  for (auto _ : state) {
+    const auto dictionary_segment = std::make_shared<DictionarySegment<T>>(value_segment);
+    benchmark::DoNotOptimize(dictionary_segment->unique_values_count());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * segment_size);
+}
+
+void dictionary_segment_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"segment_size", "cardinality"})
+      ->ArgsProduct({MICRO_BENCHMARK_CHUNK_SIZES, MICRO_BENCHMARK_CARDINALITIES});
+}
+
+BENCHMARK_TEMPLATE(BM_DictionarySegmentConstruction, int32_t)->Apply(dictionary_segment_arguments);
+BENCHMARK_TEMPLATE(BM_DictionarySegmentConstruction, int64_t)->Apply(dictionary_segment_arguments);
+BENCHMARK_TEMPLATE(BM_DictionarySegmentConstruction, float)->Apply(dictionary_segment_arguments);
+BENCHMARK_TEMPLATE(BM_DictionarySegmentConstruction, double)->Apply(dictionary_segment_arguments);
+BENCHMARK_TEMPLATE(BM_DictionarySegmentConstruction, std::string)->Apply(dictionary_segment_arguments);
+
+}  // namespace opossum
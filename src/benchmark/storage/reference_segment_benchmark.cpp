@@ -0,0 +1,90 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/materialize.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Arguments: encoding of the referenced segments, chunk size, selectivity in percent. Reads every value of the
+// ReferenceSegments of a scan result through operator[].
+template <typename T>
+void BM_ReferenceSegmentAccess(benchmark::State& state) {  // NOLINT
+  const auto encoding = static_cast<SegmentEncoding>(state.range(0));
+  const auto chunk_size = static_cast<uint32_t>(state.range(1));
+  const auto selectivity = static_cast<uint32_t>(state.range(2));
+  const auto cardinality = uint32_t{1'000};
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(get_benchmark_table<T>(chunk_size, cardinality, encoding));
+  table_wrapper->execute();
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan,
+                                                      benchmark_value<T>(cardinality * selectivity / 100));
+  table_scan->execute();
+  const auto reference_table = table_scan->get_output();
+
+  for (auto _ : state) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < reference_table->chunk_count(); ++chunk_id) {
+      const auto& segment = *reference_table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+      for (auto offset = size_t{0}; offset < segment.size(); ++offset) benchmark::DoNotOptimize(segment[offset]);
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * reference_table->row_count());
+}
+
+// Arguments: see BM_ReferenceSegmentAccess. Materializes the ReferenceSegments of a scan result in bulk, as joins and
+// aggregates do.
+template <typename T>
+void BM_ReferenceSegmentMaterialize(benchmark::State& state) {  // NOLINT
+  const auto encoding = static_cast<SegmentEncoding>(state.range(0));
+  const auto chunk_size = static_cast<uint32_t>(state.range(1));
+  const auto selectivity = static_cast<uint32_t>(state.range(2));
+  const auto cardinality = uint32_t{1'000};
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(get_benchmark_table<T>(chunk_size, cardinality, encoding));
+  table_wrapper->execute();
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan,
+                                                      benchmark_value<T>(cardinality * selectivity / 100));
+  table_scan->execute();
+  const auto reference_table = table_scan->get_output();
+
+  auto values = std::vector<T>{};
+  for (auto _ : state) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < reference_table->chunk_count(); ++chunk_id) {
+      values.clear();
+      materialize_values(*reference_table->get_chunk(chunk_id)->get_segment(ColumnID{0}), values);
+      benchmark::DoNotOptimize(values.data());
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * reference_table->row_count());
+}
+
+void reference_segment_arguments(benchmark::internal::Benchmark* benchmark) {
+  const auto referenced_encodings = std::vector<int64_t>{static_cast<int64_t>(SegmentEncoding::Unencoded),
+                                                         static_cast<int64_t>(SegmentEncoding::Dictionary)};
+  benchmark->ArgNames({"encoding", "chunk_size", "selectivity"})
+      ->ArgsProduct({referenced_encodings, MICRO_BENCHMARK_CHUNK_SIZES, {1, 50}});
+}
+
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentAccess, int32_t)->Apply(reference_segment_arguments);
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentAccess, int64_t)->Apply(reference_segment_arguments);
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentAccess, float)->Apply(reference_segment_arguments);
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentAccess, double)->Apply(reference_segment_arguments);
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentAccess, std::string)->Apply(reference_segment_arguments);
+
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentMaterialize, int32_t)->Apply(reference_segment_arguments);
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentMaterialize, int64_t)->Apply(reference_segment_arguments);
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentMaterialize, float)->Apply(reference_segment_arguments);
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentMaterialize, double)->Apply(reference_segment_arguments);
+BENCHMARK_TEMPLATE(BM_ReferenceSegmentMaterialize, std::string)->Apply(reference_segment_arguments);
+
+}  // namespace opossum
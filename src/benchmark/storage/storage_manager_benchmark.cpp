@@ -0,0 +1,68 @@
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto STORAGE_MANAGER_BENCHMARK_TABLE_COUNT = 64;
+
+std::atomic_bool ddl_running{false};
+std::thread ddl_thread;
+
+}  // namespace
+
+// Arguments: whether a background thread concurrently adds and drops tables. Every benchmark thread looks up all
+// tables of the catalog in each iteration.
+void BM_StorageManagerGetTable(benchmark::State& state) {  // NOLINT
+  const auto concurrent_ddl = state.range(0) != 0;
+  auto& storage_manager = StorageManager::get();
+
+  auto names = std::vector<std::string>{};
+  for (auto table_id = 0; table_id < STORAGE_MANAGER_BENCHMARK_TABLE_COUNT; ++table_id) {
+    names.emplace_back("table_" + std::to_string(table_id));
+  }
+
+  // The first thread sets up the catalog before and cleans it up after all threads ran the benchmark loop
+  if (state.thread_index() == 0) {
+    StorageManager::reset();
+    for (const auto& name : names) storage_manager.add_table(name, std::make_shared<Table>());
+
+    if (concurrent_ddl) {
+      ddl_running = true;
+      ddl_thread = std::thread{[&storage_manager]() {
+        while (ddl_running) {
+          storage_manager.add_table("ddl_table", std::make_shared<Table>());
+          storage_manager.drop_table("ddl_table");
+        }
+      }};
+    }
+  }
+
+  for (auto _ : state) {
+    for (const auto& name : names) benchmark::DoNotOptimize(storage_manager.get_table(name));
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * STORAGE_MANAGER_BENCHMARK_TABLE_COUNT);
+
+  if (state.thread_index() == 0) {
+    if (concurrent_ddl) {
+      ddl_running = false;
+      ddl_thread.join();
+    }
+    StorageManager::reset();
+  }
+}
+
+BENCHMARK(BM_StorageManagerGetTable)->ArgNames({"concurrent_ddl"})->Arg(0)->Arg(1)->ThreadRange(1, 8)->UseRealTime();
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "all_type_variant.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Arguments: chunk size. Appends MICRO_BENCHMARK_ROW_COUNT rows to an empty table.
+template <typename T>
+void BM_TableAppend(benchmark::State& state) {  // NOLINT
+  const auto chunk_size = static_cast<uint32_t>(state.range(0));
+
+  auto rows = std::vector<std::vector<AllTypeVariant>>{};
+  for (const auto& value : generate_benchmark_values<T>(MICRO_BENCHMARK_ROW_COUNT, 1'000)) rows.push_back({value});
+
+  for (auto _ : state) {
+    auto table = std::make_shared<Table>(chunk_size);
+    table->add_column("a", data_type_from_type<T>());
+    for (const auto& row : rows) table->append(row);
+    benchmark::DoNotOptimize(table->row_count());
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * MICRO_BENCHMARK_ROW_COUNT);
+}
+
+void table_append_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"chunk_size"})->ArgsProduct({MICRO_BENCHMARK_CHUNK_SIZES});
+}
+
+BENCHMARK_TEMPLATE(BM_TableAppend, int32_t)->Apply(table_append_arguments);
+BENCHMARK_TEMPLATE(BM_TableAppend, int64_t)->Apply(table_append_arguments);
+BENCHMARK_TEMPLATE(BM_TableAppend, float)->Apply(table_append_arguments);
+BENCHMARK_TEMPLATE(BM_TableAppend, double)->Apply(table_append_arguments);
+BENCHMARK_TEMPLATE(BM_TableAppend, std::string)->Apply(table_append_arguments);
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+// Arguments: chunk size, cardinality. Loads a .tbl file with MICRO_BENCHMARK_ROW_COUNT rows in a single column.
+template <typename T>
+void BM_LoadTable(benchmark::State& state) {  // NOLINT
+  const auto chunk_size = static_cast<uint32_t>(state.range(0));
+  const auto cardinality = static_cast<uint32_t>(state.range(1));
+
+  auto file_name = std::string{"/tmp/hyrise_load_table_benchmark_XXXXXX"};
+  const auto file_descriptor = mkstemp(file_name.data());
+  Assert(file_descriptor >= 0, "Could not create a temporary file");
+  close(file_descriptor);
+
+  {
+    auto file = std::ofstream{file_name};
+    file << "a\n" << data_type_from_type<T>() << "\n";
+    for (const auto& value : generate_benchmark_values<T>(MICRO_BENCHMARK_ROW_COUNT, cardinality)) {
+      file << value << "\n";
+    }
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(load_table(file_name, chunk_size)->row_count());
+  }
+
+  std::remove(file_name.c_str());
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * MICRO_BENCHMARK_ROW_COUNT);
+}
+
+void load_table_arguments(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"chunk_size", "cardinality"})
+      ->ArgsProduct({MICRO_BENCHMARK_CHUNK_SIZES, MICRO_BENCHMARK_CARDINALITIES});
+}
+
+BENCHMARK_TEMPLATE(BM_LoadTable, int32_t)->Apply(load_table_arguments);
+BENCHMARK_TEMPLATE(BM_LoadTable, int64_t)->Apply(load_table_arguments);
+BENCHMARK_TEMPLATE(BM_LoadTable, float)->Apply(load_table_arguments);
+BENCHMARK_TEMPLATE(BM_LoadTable, double)->Apply(load_table_arguments);
+BENCHMARK_TEMPLATE(BM_LoadTable, std::string)->Apply(load_table_arguments);
+
+}  // namespace opossum
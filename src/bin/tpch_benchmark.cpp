@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../lib/operators/abstract_operator.hpp"
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/node_queue_scheduler.hpp"
+#include "../lib/scheduler/operator_task.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/tpch/tpch_queries.hpp"
+#include "../lib/tpch/tpch_table_generator.hpp"
+#include "../lib/utils/assert.hpp"
+
+namespace {
+
+struct Options {
+  float scale_factor = 0.1f;
+  uint32_t chunk_size = 100'000;
+  bool use_dictionary_encoding = false;
+  bool use_scheduler = false;
+  size_t warmup_runs = 1;
+  size_t runs = 10;
+};
+
+void print_usage(std::ostream& out) {
+  out << "Usage: hyriseTpchBenchmark [options]\n"
+      << "  --scale-factor <float>  size of the generated data, 1 means 6 million lineitems (default 0.1)\n"
+      << "  --chunk-size <int>      rows per chunk (default 100000)\n"
+      << "  --encode                dictionary-encode all segments\n"
+      << "  --scheduler             run the operators as tasks of a NodeQueueScheduler\n"
+      << "  --warmup <int>          unmeasured runs per query (default 1)\n"
+      << "  --runs <int>            measured runs per query (default 10)\n";
+}
+
+Options parse_options(const int argc, char* argv[]) {
+  auto options = Options{};
+  for (auto arg_index = 1; arg_index < argc; ++arg_index) {
+    const auto arg = std::string{argv[arg_index]};
+    const auto next_value = [&]() {
+      opossum::Assert(arg_index + 1 < argc, arg + " requires a value");
+      return std::string{argv[++arg_index]};
+    };
+
+    if (arg == "--scale-factor") {
+      options.scale_factor = std::stof(next_value());
+    } else if (arg == "--chunk-size") {
+      options.chunk_size = static_cast<uint32_t>(std::stoul(next_value()));
+    } else if (arg == "--encode") {
+      options.use_dictionary_encoding = true;
+    } else if (arg == "--scheduler") {
+      options.use_scheduler = true;
+    } else if (arg == "--warmup") {
+      options.warmup_runs = std::stoul(next_value());
+    } else if (arg == "--runs") {
+      options.runs = std::stoul(next_value());
+    } else {
+      print_usage(std::cerr);
+      std::exit(arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+  }
+  opossum::Assert(options.runs > 0, "At least one run is required");
+  return options;
+}
+
+// executes the plan with all of its inputs and returns the number of result rows
+uint64_t execute_plan(const std::shared_ptr<opossum::AbstractOperator>& plan) {
+  opossum::CurrentScheduler::schedule_and_wait_for_tasks(opossum::OperatorTask::make_tasks_from_operator(plan));
+  return plan->get_output()->row_count();
+}
+
+// nearest-rank percentile of the sorted durations
+double percentile(const std::vector<double>& sorted_durations, const double percent) {
+  const auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * sorted_durations.size()));
+  return sorted_durations[std::max(rank, size_t{1}) - 1];
+}
+
+}  // namespace
+
+// Generates TPC-H-like tables and measures how long the queries of opossum::tpch_queries take. Every query is run a
+// few times without measuring first, so that caches are warm and lazily built structures exist.
+int main(int argc, char* argv[]) {
+  const auto options = parse_options(argc, argv);
+
+  std::cout << "Generating tables with scale factor " << options.scale_factor << "..." << std::flush;
+  const auto generation_start = std::chrono::steady_clock::now();
+  opossum::TpchTableGenerator{options.scale_factor, options.chunk_size, options.use_dictionary_encoding}
+      .generate_and_store();
+  const auto generation_duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - generation_start);
+  std::cout << " done in " << std::fixed << std::setprecision(2) << generation_duration.count() << " s" << std::endl;
+
+  if (options.use_scheduler) opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
+
+  std::cout << std::left << std::setw(10) << "Query" << std::right << std::setw(10) << "Rows";
+  for (const auto* column : {"Min", "Mean", "P50", "P90", "P99", "Max"}) {
+    std::cout << std::setw(10) << std::string{column} + " ms";
+  }
+  std::cout << std::endl;
+
+  for (const auto& query : opossum::tpch_queries()) {
+    for (auto run = size_t{0}; run < options.warmup_runs; ++run) execute_plan(query.make_plan());
+
+    auto durations = std::vector<double>{};
+    auto row_count = uint64_t{0};
+    for (auto run = size_t{0}; run < options.runs; ++run) {
+      const auto plan = query.make_plan();
+      const auto start = std::chrono::steady_clock::now();
+      row_count = execute_plan(plan);
+      durations.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    std::sort(durations.begin(), durations.end());
+    auto mean = 0.0;
+    for (const auto duration : durations) mean += duration / durations.size();
+
+    std::cout << std::left << std::setw(10) << query.name << std::right << std::setw(10) << row_count;
+    for (const auto value : {durations.front(), mean, percentile(durations, 50), percentile(durations, 90),
+                             percentile(durations, 99), durations.back()}) {
+      std::cout << std::setw(10) << std::setprecision(2) << value;
+    }
+    std::cout << std::endl;
+  }
+
+  opossum::CurrentScheduler::set(nullptr);
+  return 0;
+}
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <boost/hana/ext/boost/mpl/vector.hpp>
+#include <boost/hana/first.hpp>
+#include <boost/hana/for_each.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/prepend.hpp>
 #include <boost/hana/second.hpp>
+#include <boost/hana/size.hpp>
 #include <boost/hana/transform.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/zip.hpp>
@@ -14,38 +17,50 @@
 #include <boost/preprocessor/seq/for_each.hpp>
 #include <boost/preprocessor/seq/transform.hpp>
 
+#include <array>
 #include <cstdint>
+#include <ostream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
 namespace hana = boost::hana;
 
+// The data type of a column. Dispatching on it (see resolve_data_type) compares small integers instead of strings.
+enum class DataType : uint8_t { Int, Long, Float, Double, String };
+
 namespace detail {
 
 #define EXPAND_TO_HANA_TYPE(s, data, elem) boost::hana::type_c<elem>
 
+// The data types, their DataTypes, and their names, in the same order
 // clang-format off
-#define data_types_macro                              (int32_t) (int64_t) (float)  (double)  (std::string)    // NOLINT
-static constexpr auto type_strings = hana::make_tuple("int",    "long",   "float", "double", "string"     );  // NOLINT
+#define data_types_macro (int32_t) (int64_t) (float) (double) (std::string)  // NOLINT
+static constexpr auto data_type_enums =
+    hana::make_tuple(DataType::Int, DataType::Long, DataType::Float, DataType::Double, DataType::String);
+static constexpr auto type_strings = std::array{"int", "long", "float", "double", "string"};
 // clang-format on
 
+static_assert(type_strings.size() == decltype(hana::size(data_type_enums))::value, "Every DataType needs a name");
+
 // Extends to hana::make_tuple(hana::type_c<int32_t>, hana::type_c<int64_t>, ...);
 static constexpr auto types =
     hana::make_tuple(BOOST_PP_SEQ_ENUM(BOOST_PP_SEQ_TRANSFORM(EXPAND_TO_HANA_TYPE, _, data_types_macro)));
 
 /**
- * Holds pairs of all types and their respective string representation.
+ * Holds pairs of all types and their respective DataType.
  *
  * Equivalent to:
- * hana::make_tuple(hana::make_tuple("int", hana::type_c<int32_t>),
- *                  hana::make_tuple("long", hana::type_c<int64_t>),
+ * hana::make_tuple(hana::make_tuple(DataType::Int, hana::type_c<int32_t>),
+ *                  hana::make_tuple(DataType::Long, hana::type_c<int64_t>),
  *                  ...);
  */
-static constexpr auto data_types_as_tuples = hana::zip(type_strings, types);
+static constexpr auto data_types_as_tuples = hana::zip(data_type_enums, types);
 
 struct to_pair {
   template <typename T>
@@ -70,6 +85,39 @@ static constexpr auto data_types = detail::data_types;
 
 using AllTypeVariant = detail::AllTypeVariant;
 
+// returns the DataType of T, e.g., DataType::Int for int32_t
+template <typename T>
+DataType data_type_from_type() {
+  auto result = DataType::Int;
+  auto found = false;
+  hana::for_each(data_types, [&](auto data_type) {
+    if constexpr (std::is_same_v<typename decltype(+hana::second(data_type))::type, T>) {
+      result = hana::first(data_type);
+      found = true;
+    }
+  });
+  Assert(found, "Not a data type");
+  return result;
+}
+
+// returns the name of the data type, e.g., "int" for DataType::Int
+inline std::string data_type_to_string(const DataType data_type) {
+  return detail::type_strings[static_cast<size_t>(data_type)];
+}
+
+// Parses the name of a data type, e.g., when loading a table from a file. Fails for unknown names.
+inline DataType data_type_from_string(const std::string& type_string) {
+  for (auto index = size_t{0}; index < detail::type_strings.size(); ++index) {
+    if (type_string == detail::type_strings[index]) return static_cast<DataType>(index);
+  }
+  Fail("Unknown data type " + type_string);
+  return DataType::Int;
+}
+
+inline std::ostream& operator<<(std::ostream& stream, const DataType data_type) {
+  return stream << data_type_to_string(data_type);
+}
+
 /**
  * @defgroup Macros for explicitly instantiating template classes
  *
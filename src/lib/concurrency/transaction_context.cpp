@@ -0,0 +1,68 @@
+#include "transaction_context.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "transaction_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id)
+    : _transaction_id{transaction_id}, _snapshot_commit_id{snapshot_commit_id} {}
+
+TransactionContext::~TransactionContext() {
+  if (_phase == TransactionPhase::Active) rollback();
+}
+
+TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
+
+CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commit_id; }
+
+Snapshot TransactionContext::snapshot() const { return Snapshot{_snapshot_commit_id, _transaction_id}; }
+
+TransactionPhase TransactionContext::phase() const { return _phase; }
+
+CommitID TransactionContext::commit() {
+  Assert(_phase == TransactionPhase::Active, "Transaction is not active");
+
+  const auto commit_id = TransactionManager::get().commit([&](const CommitID commit_id) {
+    // Inserted rows are released, so that other transactions can delete them. Deleted rows stay locked.
+    for (const auto& [mvcc_data, chunk_offset] : _inserted_rows) {
+      mvcc_data->set_begin_commit_id(chunk_offset, commit_id);
+      mvcc_data->set_transaction_id(chunk_offset, INVALID_TRANSACTION_ID);
+    }
+    for (const auto& [mvcc_data, chunk_offset] : _deleted_rows) {
+      mvcc_data->set_end_commit_id(chunk_offset, commit_id);
+    }
+  });
+
+  _phase = TransactionPhase::Committed;
+  return commit_id;
+}
+
+void TransactionContext::rollback() {
+  Assert(_phase == TransactionPhase::Active, "Transaction is not active");
+
+  // Inserted rows keep MAX_COMMIT_ID as their begin commit id, so they stay invisible to everyone
+  for (const auto& [mvcc_data, chunk_offset] : _inserted_rows) {
+    mvcc_data->set_transaction_id(chunk_offset, INVALID_TRANSACTION_ID);
+  }
+  for (const auto& [mvcc_data, chunk_offset] : _deleted_rows) {
+    mvcc_data->set_transaction_id(chunk_offset, INVALID_TRANSACTION_ID);
+  }
+
+  _phase = TransactionPhase::RolledBack;
+}
+
+void TransactionContext::register_insert(std::shared_ptr<MvccData> mvcc_data, const ChunkOffset chunk_offset) {
+  DebugAssert(_phase == TransactionPhase::Active, "Transaction is not active");
+  _inserted_rows.emplace_back(std::move(mvcc_data), chunk_offset);
+}
+
+void TransactionContext::register_delete(std::shared_ptr<MvccData> mvcc_data, const ChunkOffset chunk_offset) {
+  DebugAssert(_phase == TransactionPhase::Active, "Transaction is not active");
+  _deleted_rows.emplace_back(std::move(mvcc_data), chunk_offset);
+}
+
+}  // namespace opossum
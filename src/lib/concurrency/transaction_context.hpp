@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storage/mvcc_data.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class TransactionPhase { Active, Committed, RolledBack };
+
+// A TransactionContext is created by the TransactionManager and groups the inserts and deletes of one transaction
+// (see Table::append and Table::delete_row). Operators that are given the context (see
+// AbstractOperator::set_transaction_context) read the snapshot of the transaction: everything that was committed when
+// the transaction began, plus its own changes. Other transactions see the changes once commit returns.
+//
+// A transaction is used by one thread at a time. If it is neither committed nor rolled back, its destructor rolls it
+// back.
+class TransactionContext : private Noncopyable {
+ public:
+  TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id);
+  ~TransactionContext();
+
+  TransactionID transaction_id() const;
+
+  // returns the id of the last commit that the transaction sees
+  CommitID snapshot_commit_id() const;
+
+  Snapshot snapshot() const;
+
+  TransactionPhase phase() const;
+
+  // Makes the changes of the transaction visible to transactions that begin afterwards. Returns the commit id.
+  CommitID commit();
+
+  // discards the changes of the transaction and releases the rows that it deleted
+  void rollback();
+
+  // records a row that the transaction inserted and that has to be committed or rolled back with it
+  void register_insert(std::shared_ptr<MvccData> mvcc_data, const ChunkOffset chunk_offset);
+
+  // records a row that the transaction locked in order to delete it
+  void register_delete(std::shared_ptr<MvccData> mvcc_data, const ChunkOffset chunk_offset);
+
+ protected:
+  using Row = std::pair<std::shared_ptr<MvccData>, ChunkOffset>;
+
+  const TransactionID _transaction_id;
+  const CommitID _snapshot_commit_id;
+  TransactionPhase _phase = TransactionPhase::Active;
+  std::vector<Row> _inserted_rows;
+  std::vector<Row> _deleted_rows;
+};
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#include "transaction_manager.hpp"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "transaction_context.hpp"
+
+namespace opossum {
+
+TransactionManager& TransactionManager::get() {
+  static TransactionManager singleton_instance;
+  return singleton_instance;
+}
+
+std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
+  const auto transaction_id = _next_transaction_id.fetch_add(1, std::memory_order_relaxed);
+  return std::make_shared<TransactionContext>(transaction_id, last_commit_id());
+}
+
+CommitID TransactionManager::last_commit_id() const { return _last_commit_id.load(std::memory_order_acquire); }
+
+Snapshot TransactionManager::latest_snapshot() const { return Snapshot{last_commit_id(), INVALID_TRANSACTION_ID}; }
+
+CommitID TransactionManager::commit(const std::function<void(const CommitID commit_id)>& apply) {
+  // Transactions publish their commit ids in order, so that a snapshot includes all commits up to its commit id
+  std::lock_guard<std::mutex> lock(_commit_mutex);
+  const auto commit_id = _last_commit_id.load(std::memory_order_relaxed) + 1;
+  apply(commit_id);
+  _last_commit_id.store(commit_id, std::memory_order_release);
+  return commit_id;
+}
+
+void TransactionManager::reset() {
+  auto& transaction_manager = get();
+  std::lock_guard<std::mutex> lock(transaction_manager._commit_mutex);
+  transaction_manager._next_transaction_id = INVALID_TRANSACTION_ID + 1;
+  transaction_manager._last_commit_id = 0;
+}
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "storage/mvcc_data.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TransactionContext;
+
+// The TransactionManager is a singleton that hands out transaction ids and commit ids. Commit ids are assigned in
+// the order in which transactions commit, and a transaction's changes become visible once last_commit_id reaches its
+// commit id. Only committing is serialized, beginning a transaction and reading the snapshot do not take a lock.
+class TransactionManager : private Noncopyable {
+ public:
+  static TransactionManager& get();
+
+  // starts a transaction that sees everything that was committed so far
+  std::shared_ptr<TransactionContext> new_transaction_context();
+
+  // returns the commit id of the last transaction whose changes are visible
+  CommitID last_commit_id() const;
+
+  // returns the snapshot of readers outside of a transaction, i.e., all changes that were committed so far
+  Snapshot latest_snapshot() const;
+
+  // Assigns the next commit id, lets apply write it into the MVCC columns of the transaction's rows, and publishes
+  // it. Used by TransactionContext::commit.
+  CommitID commit(const std::function<void(const CommitID commit_id)>& apply);
+
+  // resets the transaction and commit ids, used especially in tests
+  static void reset();
+
+ protected:
+  TransactionManager() = default;
+
+  std::atomic<TransactionID> _next_transaction_id{INVALID_TRANSACTION_ID + 1};
+  std::atomic<CommitID> _last_commit_id{0};
+  std::mutex _commit_mutex;
+};
+
+}  // namespace opossum
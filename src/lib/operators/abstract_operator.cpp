@@ -1,12 +1,21 @@
 #include "abstract_operator.hpp"
 
+#include <time.h>
+
 #include <chrono>
+#include <future>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "scheduler/operator_task.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
+#include "utils/performance_counters.hpp"
+#include "utils/tracer.hpp"
 
 namespace opossum {
 
@@ -14,12 +23,118 @@ AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator>
                                    const std::shared_ptr<const AbstractOperator> right)
     : _input_left(left), _input_right(right) {}
 
+namespace {
+
+std::chrono::nanoseconds thread_cpu_time() {
+  auto time = timespec{};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+  return std::chrono::seconds{time.tv_sec} + std::chrono::nanoseconds{time.tv_nsec};
+}
+
+}  // namespace
+
 void AbstractOperator::execute() {
   Assert(!_alreadyExecuted, "Executed twice");
   _alreadyExecuted = true;
+
+  const auto trace_scope = TraceScope{"operator", Tracer::is_enabled() ? description() : std::string{}};
+
+  if (!OperatorPerformanceData::is_enabled()) {
+    _output = _on_execute();
+    return;
+  }
+
+  const auto walltime_start = std::chrono::steady_clock::now();
+  const auto cpu_time_start = thread_cpu_time();
+  const auto measure_counters = PerformanceCounters::is_enabled();
+  const auto counters_start = measure_counters ? PerformanceCounters::read() : PerformanceCounterValues{};
+
   _output = _on_execute();
+
+  _performance_data.counters =
+      measure_counters ? PerformanceCounters::read() - counters_start : PerformanceCounterValues{};
+  _performance_data.cpu_time = thread_cpu_time() - cpu_time_start;
+  _performance_data.walltime = std::chrono::steady_clock::now() - walltime_start;
+
+  // Counting rows and chunks is cheap, but it should not be part of the measured time
+  _performance_data.input_row_count = 0;
+  _performance_data.input_chunk_count = 0;
+  for (const auto& input : {_input_left, _input_right}) {
+    if (!input) continue;
+    const auto input_table = input->get_output();
+    _performance_data.input_row_count += input_table->row_count();
+    _performance_data.input_chunk_count += input_table->chunk_count();
+  }
+
+  _performance_data.output_row_count = _output->row_count();
+  _performance_data.output_chunk_count = _output->chunk_count();
+  _performance_data.output_bytes = OperatorPerformanceData::estimate_memory_consumption(*_output);
+  _performance_data.has_data = true;
 }
 
+const std::string AbstractOperator::description() const { return name(); }
+
+const OperatorPerformanceData& AbstractOperator::performance_data() const { return _performance_data; }
+
+std::future<std::shared_ptr<const Table>> AbstractOperator::execute_async(ExecutionCallback callback) {
+  const auto tasks = OperatorTask::make_tasks_from_operator(shared_from_this());
+
+  // std::promise is not copyable, but std::function requires copyable callables
+  const auto promise = std::make_shared<std::promise<std::shared_ptr<const Table>>>();
+  auto future = promise->get_future();
+
+  tasks.back()->add_done_callback([self = shared_from_this(), promise, callback](const std::exception_ptr& exception) {
+    if (exception) {
+      promise->set_exception(exception);
+      if (callback) callback(nullptr, exception);
+      return;
+    }
+
+    const auto output = self->get_output();
+    promise->set_value(output);
+    if (callback) callback(output, nullptr);
+  });
+
+  for (const auto& task : tasks) task->schedule();
+  return future;
+}
+
+void AbstractOperator::reset() {
+  _alreadyExecuted = false;
+  _output = nullptr;
+  _performance_data = OperatorPerformanceData{};
+  _on_reset();
+
+  // Inputs are only held as const, as operators must not modify them. Resetting the plan is done from the outside.
+  for (const auto& input : {_input_left, _input_right}) {
+    if (input) std::const_pointer_cast<AbstractOperator>(input)->reset();
+  }
+}
+
+void AbstractOperator::set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  _on_set_parameters(parameters);
+
+  for (const auto& input : {_input_left, _input_right}) {
+    if (input) std::const_pointer_cast<AbstractOperator>(input)->set_parameters(parameters);
+  }
+}
+
+void AbstractOperator::set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context) {
+  _transaction_context = transaction_context;
+
+  for (const auto& input : {_input_left, _input_right}) {
+    if (input) std::const_pointer_cast<AbstractOperator>(input)->set_transaction_context(transaction_context);
+  }
+}
+
+std::shared_ptr<TransactionContext> AbstractOperator::transaction_context() const { return _transaction_context; }
+
+Snapshot AbstractOperator::_snapshot() const {
+  return _transaction_context ? _transaction_context->snapshot() : TransactionManager::get().latest_snapshot();
+}
+
+bool AbstractOperator::executed() const { return _alreadyExecuted; }
+
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
   Assert(_alreadyExecuted, "Execution was not started yet");
   Assert(_output != nullptr, "Output not yet available");
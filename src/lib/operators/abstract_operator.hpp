@@ -1,14 +1,22 @@
 #pragma once
 
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "all_type_variant.hpp"
+#include "operator_performance_data.hpp"
+#include "storage/mvcc_data.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 class Table;
+class TransactionContext;
 
 // AbstractOperator is the abstract super class for all operators.
 // All operators have up to two input tables and one output table.
@@ -20,12 +28,22 @@ class Table;
 // 3. The consumer (usually another operator) calls get_output. This should be very cheap. It is only guaranteed to
 // succeed if execute was called before. Otherwise, a nullptr or an empty table could be returned.
 //
-// Operators shall not be executed twice.
+// Operators shall not be executed twice. To run the same plan again, e.g., with other parameters (see
+// set_parameters), reset it first.
+//
+// Instead of executing the operators of a tree one by one, execute_async runs the operator and its inputs as tasks of
+// the CurrentScheduler and returns a future of the output right away.
+//
+// While OperatorPerformanceData recording is enabled, execute records how long the operator took and how much data it
+// consumed and produced (see Explain for printing an annotated operator tree).
 //
 // Find more information about operators in our Wiki: https://github.com/hyrise/hyrise/wiki/operator-concept
 
-class AbstractOperator : private Noncopyable {
+class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>, private Noncopyable {
  public:
+  // receives the output of the operator or, if the operator or one of its inputs failed, the exception
+  using ExecutionCallback = std::function<void(std::shared_ptr<const Table> output, std::exception_ptr exception)>;
+
   AbstractOperator(const std::shared_ptr<const AbstractOperator> left = nullptr,
                    const std::shared_ptr<const AbstractOperator> right = nullptr);
 
@@ -38,6 +56,39 @@ class AbstractOperator : private Noncopyable {
 
   void execute();
 
+  // returns the name of the operator, e.g., "TableScan"
+  virtual const std::string name() const = 0;
+
+  // returns the name of the operator with its parameters, e.g., "TableScan column 0 >= 5"
+  virtual const std::string description() const;
+
+  // returns what the last execution recorded (see OperatorPerformanceData)
+  const OperatorPerformanceData& performance_data() const;
+
+  // Executes the operator and all of its inputs that were not executed yet (see OperatorTask). An operator only
+  // starts once its inputs are done, so no worker blocks while waiting for them. The returned future is fulfilled
+  // with the output. Callers that must not block either can pass a callback instead, which the worker finishing the
+  // operator calls. Without a scheduler, everything is executed before execute_async returns.
+  std::future<std::shared_ptr<const Table>> execute_async(ExecutionCallback callback = nullptr);
+
+  // returns whether execute was called already, i.e., whether the operator must not be executed again
+  bool executed() const;
+
+  // Resets the operator and all of its inputs, so that the plan can be executed again. Operators keep everything that
+  // does not depend on the input data, e.g., a TableScan keeps the scan implementation for the resolved column type.
+  void reset();
+
+  // binds the given values to the placeholders of the operator and all of its inputs (see TableScan)
+  void set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
+
+  // Makes the operator and all of its inputs read the snapshot of the given transaction, which includes its own
+  // uncommitted changes. Without a transaction context, operators read everything that was committed when they are
+  // executed. Operators that read stored tables only process the rows that are visible in this snapshot, except for
+  // Print, which shows all rows.
+  void set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
+
+  std::shared_ptr<TransactionContext> transaction_context() const;
+
   // returns the result of the operator
   std::shared_ptr<const Table> get_output() const;
 
@@ -51,6 +102,14 @@ class AbstractOperator : private Noncopyable {
   // asynchronous execution
   virtual std::shared_ptr<const Table> _on_execute() = 0;
 
+  // called by reset to clear state of the last execution
+  virtual void _on_reset() {}
+
+  virtual void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+  // returns the snapshot of the transaction context or, if there is none, the latest one
+  Snapshot _snapshot() const;
+
   std::shared_ptr<const Table> _input_table_left() const;
   std::shared_ptr<const Table> _input_table_right() const;
 
@@ -62,6 +121,10 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const Table> _output;
 
   bool _alreadyExecuted = false;
+
+  std::shared_ptr<TransactionContext> _transaction_context;
+
+  OperatorPerformanceData _performance_data;
 };
 
 }  // namespace opossum
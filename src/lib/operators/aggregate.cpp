@@ -0,0 +1,337 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/materialize.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::string aggregate_function_name(const AggregateFunction function) {
+  switch (function) {
+    case AggregateFunction::Count:
+      return "COUNT";
+    case AggregateFunction::CountDistinct:
+      return "COUNT DISTINCT";
+    case AggregateFunction::Min:
+      return "MIN";
+    case AggregateFunction::Max:
+      return "MAX";
+    case AggregateFunction::Sum:
+      return "SUM";
+    case AggregateFunction::Avg:
+      return "AVG";
+  }
+  Fail("Unknown aggregate function");
+  return {};
+}
+
+DataType aggregate_data_type(const AggregateFunction function, const DataType column_type) {
+  switch (function) {
+    case AggregateFunction::Count:
+    case AggregateFunction::CountDistinct:
+      return DataType::Long;
+    case AggregateFunction::Min:
+    case AggregateFunction::Max:
+      return column_type;
+    case AggregateFunction::Sum:
+      Assert(column_type != DataType::String, "Cannot sum up strings");
+      return column_type == DataType::Int || column_type == DataType::Long ? DataType::Long : DataType::Double;
+    case AggregateFunction::Avg:
+      Assert(column_type != DataType::String, "Cannot average strings");
+      return DataType::Double;
+  }
+  Fail("Unknown aggregate function");
+  return {};
+}
+
+// Stores which rows of the chunk the snapshot sees and returns true, unless it sees all of them, which is the case if
+// no transaction modified the chunk. Only then may the aggregates use the dictionary or the row count of the chunk.
+bool get_visible_rows(const Chunk& chunk, const Snapshot& snapshot, std::vector<uint8_t>& visible_rows) {
+  const auto mvcc_data = chunk.mvcc_data();
+  if (!mvcc_data || !mvcc_data->modified()) return false;
+
+  mvcc_data->get_visible_rows(snapshot, chunk.size(), visible_rows);
+  return true;
+}
+
+// Replaces values by the values of the segment in the visible rows. Rows appended after their visibility was checked
+// are not visible either.
+template <typename T>
+void materialize_visible_values(const BaseSegment& segment, const std::vector<uint8_t>& visible_rows,
+                                std::vector<T>& values) {
+  values.clear();
+  materialize_values(segment, values);
+
+  auto visible_row_count = size_t{0};
+  for (auto chunk_offset = size_t{0}; chunk_offset < visible_rows.size(); ++chunk_offset) {
+    values[visible_row_count] = values[chunk_offset];
+    visible_row_count += visible_rows[chunk_offset];
+  }
+  values.resize(visible_row_count);
+}
+
+}  // namespace
+
+// The partial result of a single aggregate
+class BaseAggregateState {
+ public:
+  virtual ~BaseAggregateState() = default;
+
+  // Adds the rows of a segment. visible_rows is nullptr if the snapshot sees all rows of the chunk.
+  virtual void consume(const BaseSegment& segment, const std::vector<uint8_t>* visible_rows) = 0;
+
+  // adds the rows that the state of the same aggregate in another accumulator consumed
+  virtual void merge(BaseAggregateState& other) = 0;
+
+  virtual AllTypeVariant result() = 0;
+};
+
+namespace {
+
+template <typename T>
+class AggregateState : public BaseAggregateState {
+ public:
+  using SumType = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+
+  explicit AggregateState(const AggregateFunction function) : _function{function} {}
+
+  void consume(const BaseSegment& segment, const std::vector<uint8_t>* visible_rows) override {
+    if (segment.size() == 0) return;
+
+    switch (_function) {
+      case AggregateFunction::Count:
+        _row_count +=
+            visible_rows ? std::accumulate(visible_rows->cbegin(), visible_rows->cend(), uint64_t{0}) : segment.size();
+        return;
+      case AggregateFunction::CountDistinct:
+        _consume_distinct(segment, visible_rows);
+        return;
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        _consume_min_or_max(segment, visible_rows);
+        return;
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        if constexpr (std::is_arithmetic_v<T>) {
+          _consume_sum(segment, visible_rows);
+          return;
+        }
+        Fail("SUM and AVG require a numeric column");
+    }
+  }
+
+  void merge(BaseAggregateState& base_other) override {
+    auto& other = static_cast<AggregateState<T>&>(base_other);
+    _row_count += other._row_count;
+    _sum += other._sum;
+    if (other._min_or_max) _update_min_or_max(*other._min_or_max);
+
+    const auto run_offset = _runs.size();
+    _runs.insert(_runs.end(), other._runs.cbegin(), other._runs.cend());
+    for (const auto run_end : other._run_ends) _run_ends.push_back(run_offset + run_end);
+  }
+
+  AllTypeVariant result() override {
+    switch (_function) {
+      case AggregateFunction::Count:
+        return static_cast<int64_t>(_row_count);
+      case AggregateFunction::CountDistinct:
+        return _count_distinct();
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        Assert(_min_or_max, "MIN and MAX of an empty column are undefined");
+        return *_min_or_max;
+      case AggregateFunction::Sum:
+        return _sum;
+      case AggregateFunction::Avg:
+        Assert(_row_count > 0, "AVG of an empty column is undefined");
+        return static_cast<double>(_sum) / static_cast<double>(_row_count);
+    }
+    Fail("Unknown aggregate function");
+    return {};
+  }
+
+ protected:
+  // materializes the visible values of the segment into _values
+  void _materialize(const BaseSegment& segment, const std::vector<uint8_t>* visible_rows) {
+    if (visible_rows) {
+      materialize_visible_values(segment, *visible_rows, _values);
+    } else {
+      _values.clear();
+      materialize_values(segment, _values);
+    }
+  }
+
+  void _update_min_or_max(const T& value) {
+    const auto is_max = _function == AggregateFunction::Max;
+    if (!_min_or_max || (is_max ? *_min_or_max < value : value < *_min_or_max)) _min_or_max = value;
+  }
+
+  void _consume_min_or_max(const BaseSegment& segment, const std::vector<uint8_t>* visible_rows) {
+    const auto dictionary_segment = visible_rows ? nullptr : dynamic_cast<const DictionarySegment<T>*>(&segment);
+    if (dictionary_segment) {
+      const auto& dictionary = *dictionary_segment->dictionary();
+      _update_min_or_max(_function == AggregateFunction::Max ? dictionary.back() : dictionary.front());
+      return;
+    }
+
+    _materialize(segment, visible_rows);
+    if (_values.empty()) return;
+    const auto [min, max] = std::minmax_element(_values.cbegin(), _values.cend());
+    _update_min_or_max(_function == AggregateFunction::Max ? *max : *min);
+  }
+
+  // Every chunk contributes one sorted run of distinct values. Dictionaries of chunks whose rows are all visible
+  // already are such runs.
+  void _consume_distinct(const BaseSegment& segment, const std::vector<uint8_t>* visible_rows) {
+    const auto dictionary_segment = visible_rows ? nullptr : dynamic_cast<const DictionarySegment<T>*>(&segment);
+    if (dictionary_segment) {
+      const auto& dictionary = *dictionary_segment->dictionary();
+      _runs.insert(_runs.end(), dictionary.cbegin(), dictionary.cend());
+    } else {
+      _materialize(segment, visible_rows);
+      std::sort(_values.begin(), _values.end());
+      _runs.insert(_runs.end(), _values.begin(), std::unique(_values.begin(), _values.end()));
+    }
+    _run_ends.push_back(_runs.size());
+  }
+
+  int64_t _count_distinct() {
+    // A single run holds distinct values only
+    if (_run_ends.size() == 1) return static_cast<int64_t>(_runs.size());
+
+    // Neighboring runs are merged pairwise until a single sorted run is left, so every value is moved O(log n) times
+    while (_run_ends.size() > 1) {
+      auto merged_run_ends = std::vector<size_t>{};
+      for (size_t run_index = 0; run_index + 1 < _run_ends.size(); run_index += 2) {
+        const auto run_begin = run_index == 0 ? size_t{0} : _run_ends[run_index - 1];
+        std::inplace_merge(_runs.begin() + run_begin, _runs.begin() + _run_ends[run_index],
+                           _runs.begin() + _run_ends[run_index + 1]);
+        merged_run_ends.push_back(_run_ends[run_index + 1]);
+      }
+      if (_run_ends.size() % 2 == 1) merged_run_ends.push_back(_run_ends.back());
+      _run_ends = std::move(merged_run_ends);
+    }
+
+    return static_cast<int64_t>(std::distance(_runs.begin(), std::unique(_runs.begin(), _runs.end())));
+  }
+
+  // Dictionary entries are weighed with their number of occurrences, so that no row is decoded
+  void _consume_sum(const BaseSegment& segment, const std::vector<uint8_t>* visible_rows) {
+    const auto dictionary_segment = visible_rows ? nullptr : dynamic_cast<const DictionarySegment<T>*>(&segment);
+    if (dictionary_segment) {
+      const auto& dictionary = *dictionary_segment->dictionary();
+      const auto value_id_counts = dictionary_segment->attribute_vector()->value_id_counts(dictionary.size());
+      for (size_t value_id = 0; value_id < dictionary.size(); ++value_id) {
+        _sum += static_cast<SumType>(dictionary[value_id]) * static_cast<SumType>(value_id_counts[value_id]);
+      }
+      _row_count += segment.size();
+      return;
+    }
+
+    _materialize(segment, visible_rows);
+    _sum = std::accumulate(_values.cbegin(), _values.cend(), _sum);
+    _row_count += _values.size();
+  }
+
+  const AggregateFunction _function;
+
+  // rows counted by COUNT, SUM and AVG
+  uint64_t _row_count = 0;
+  SumType _sum{};
+  std::optional<T> _min_or_max;
+
+  // the sorted runs of distinct values for COUNT DISTINCT, one per consumed chunk
+  std::vector<T> _runs;
+  std::vector<size_t> _run_ends;
+
+  // reused for the values of every materialized segment
+  std::vector<T> _values;
+};
+
+}  // namespace
+
+AggregateAccumulator::AggregateAccumulator(const Table& input_table,
+                                           const std::vector<AggregateDefinition>& aggregates)
+    : _aggregates(aggregates), _output_table{std::make_shared<Table>()} {
+  for (const auto& aggregate : _aggregates) {
+    const auto column_type = input_table.column_type(aggregate.column_id);
+    _output_table->add_column(
+        aggregate_function_name(aggregate.function) + "(" + input_table.column_name(aggregate.column_id) + ")",
+        aggregate_data_type(aggregate.function, column_type));
+
+    resolve_data_type(column_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _states.push_back(std::make_unique<AggregateState<ColumnDataType>>(aggregate.function));
+    });
+  }
+}
+
+AggregateAccumulator::~AggregateAccumulator() = default;
+
+void AggregateAccumulator::consume(const Chunk& chunk, const Snapshot& snapshot) {
+  if (chunk.size() == 0) return;
+
+  // The visibility is checked once for all aggregates
+  const auto visible_rows = get_visible_rows(chunk, snapshot, _visible_rows) ? &_visible_rows : nullptr;
+  for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+    _states[aggregate_index]->consume(*chunk.get_segment(_aggregates[aggregate_index].column_id), visible_rows);
+  }
+}
+
+void AggregateAccumulator::merge(AggregateAccumulator& other) {
+  for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+    _states[aggregate_index]->merge(*other._states[aggregate_index]);
+  }
+}
+
+std::shared_ptr<Table> AggregateAccumulator::output_table() {
+  auto row = std::vector<AllTypeVariant>{};
+  for (const auto& state : _states) row.push_back(state->result());
+  _output_table->append(row);
+  return _output_table;
+}
+
+Aggregate::Aggregate(const std::shared_ptr<const AbstractOperator> in,
+                     const std::vector<AggregateDefinition>& aggregates)
+    : AbstractOperator(in), _aggregates(aggregates) {}
+
+const std::vector<AggregateDefinition>& Aggregate::aggregates() const { return _aggregates; }
+
+const std::string Aggregate::name() const { return "Aggregate"; }
+
+const std::string Aggregate::description() const {
+  auto description = name();
+  for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+    const auto& aggregate = _aggregates[aggregate_index];
+    description += (aggregate_index == 0 ? " " : ", ") + aggregate_function_name(aggregate.function) + "(column " +
+                   std::to_string(aggregate.column_id) + ")";
+  }
+  return description;
+}
+
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto snapshot = _snapshot();
+
+  auto accumulator = AggregateAccumulator{*input_table, _aggregates};
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    accumulator.consume(*input_table->get_chunk(chunk_id), snapshot);
+  }
+  return accumulator.output_table();
+}
+
+}  // namespace opossum
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class AggregateFunction { Count, CountDistinct, Min, Max, Sum, Avg };
+
+struct AggregateDefinition {
+  ColumnID column_id;
+  AggregateFunction function;
+};
+
+// Aggregate computes aggregates over whole columns of its input (there is no GROUP BY yet). The output has a single
+// row with one column per aggregate, named like "MIN(a)". COUNT yields a long, SUM a long or double, AVG a double,
+// and MIN and MAX keep the type of the column. MIN, MAX and AVG are undefined for empty inputs, as there are no NULLs.
+//
+// DictionarySegments are aggregated without decoding any row: MIN and MAX are the first and last dictionary entries,
+// COUNT DISTINCT merges the sorted dictionaries of all chunks, and SUM and AVG weigh each dictionary entry with its
+// number of occurrences (BaseAttributeVector::value_id_counts). Other segments are materialized. Rows of stored chunks
+// that the snapshot does not see are not aggregated, so chunks that transactions modified are always materialized.
+//
+// The input is aggregated chunk by chunk through an AggregateAccumulator, which a Pipeline that ends in an Aggregate
+// also uses to aggregate the output chunks of its scans as soon as they are produced.
+class Aggregate : public AbstractOperator {
+ public:
+  Aggregate(const std::shared_ptr<const AbstractOperator> in, const std::vector<AggregateDefinition>& aggregates);
+
+  const std::vector<AggregateDefinition>& aggregates() const;
+
+  const std::string name() const override;
+
+  const std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<AggregateDefinition> _aggregates;
+};
+
+class BaseAggregateState;
+class Chunk;
+
+// The partial result of aggregates over the chunks consumed so far. Accumulators of the same aggregates over
+// different chunks of a table can be merged.
+class AggregateAccumulator : private Noncopyable {
+ public:
+  AggregateAccumulator(const Table& input_table, const std::vector<AggregateDefinition>& aggregates);
+  ~AggregateAccumulator();
+
+  // adds the rows of a chunk of the input table that are visible in the snapshot
+  void consume(const Chunk& chunk, const Snapshot& snapshot);
+
+  // adds the rows that the other accumulator consumed, which is left in an unspecified state
+  void merge(AggregateAccumulator& other);
+
+  // returns the output of the Aggregate, must only be called once
+  std::shared_ptr<Table> output_table();
+
+ protected:
+  const std::vector<AggregateDefinition> _aggregates;
+  const std::shared_ptr<Table> _output_table;
+  std::vector<std::unique_ptr<BaseAggregateState>> _states;
+  std::vector<uint8_t> _visible_rows;
+};
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#include "explain.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+namespace {
+
+void print_operator(const std::shared_ptr<const AbstractOperator>& op, const size_t depth, std::ostream& out) {
+  out << std::string(depth * 2, ' ') << op->description() << " [" << op->performance_data().to_string() << "]\n";
+  for (const auto& input : {op->input_left(), op->input_right()}) {
+    if (input) print_operator(input, depth + 1, out);
+  }
+}
+
+// operators are identified by their address, since descriptions are not unique
+std::string node_name(const AbstractOperator* op) {
+  return "\"" + std::to_string(reinterpret_cast<uintptr_t>(op)) + "\"";
+}
+
+std::string escape_label(const std::string& label) {
+  auto escaped = std::string{};
+  for (const auto character : label) {
+    if (character == '"' || character == '\\') escaped += '\\';
+    escaped += character;
+  }
+  return escaped;
+}
+
+// operators that are input to several others are printed once
+void print_graphviz_operator(const std::shared_ptr<const AbstractOperator>& op,
+                             std::unordered_set<const AbstractOperator*>& printed_operators, std::ostream& out) {
+  if (!printed_operators.insert(op.get()).second) return;
+
+  out << "  " << node_name(op.get()) << " [label=\"" << escape_label(op->description()) << "\\n"
+      << escape_label(op->performance_data().to_string()) << "\"];\n";
+  for (const auto& input : {op->input_left(), op->input_right()}) {
+    if (!input) continue;
+    print_graphviz_operator(input, printed_operators, out);
+    out << "  " << node_name(input.get()) << " -> " << node_name(op.get()) << ";\n";
+  }
+}
+
+}  // namespace
+
+void Explain::print(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out) {
+  print_operator(root, 0, out);
+}
+
+void Explain::print_graphviz(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out) {
+  auto printed_operators = std::unordered_set<const AbstractOperator*>{};
+  out << "digraph {\n";
+  out << "  node [shape=box];\n";
+  print_graphviz_operator(root, printed_operators, out);
+  out << "}\n";
+}
+
+}  // namespace opossum
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+namespace opossum {
+
+class AbstractOperator;
+
+// Explain prints operator trees annotated with the OperatorPerformanceData of every operator, similar to EXPLAIN
+// ANALYZE in other databases. Enable recording (OperatorPerformanceData::set_enabled) before executing the tree,
+// otherwise the operators are printed without data.
+class Explain {
+ public:
+  // prints one line per operator, inputs indented below the operator that consumes them
+  static void print(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out = std::cout);
+
+  // prints the tree as a Graphviz digraph, with edges pointing from inputs to their consumers
+  static void print_graphviz(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out = std::cout);
+};
+
+}  // namespace opossum
@@ -0,0 +1,154 @@
+#include "index_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "table_scan.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_pool.hpp"
+
+namespace opossum {
+
+namespace {
+
+using IndexRange = std::pair<BaseIndex::Iterator, BaseIndex::Iterator>;
+
+// Translates the predicate into the (at most two) ranges of the index that qualify
+std::vector<IndexRange> get_index_ranges(const BaseIndex& index, const ScanType scan_type,
+                                         const AllTypeVariant& search_value) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return {{index.lower_bound(search_value), index.upper_bound(search_value)}};
+    case ScanType::OpNotEquals:
+      return {{index.cbegin(), index.lower_bound(search_value)}, {index.upper_bound(search_value), index.cend()}};
+    case ScanType::OpLessThan:
+      return {{index.cbegin(), index.lower_bound(search_value)}};
+    case ScanType::OpLessThanEquals:
+      return {{index.cbegin(), index.upper_bound(search_value)}};
+    case ScanType::OpGreaterThan:
+      return {{index.upper_bound(search_value), index.cend()}};
+    case ScanType::OpGreaterThanEquals:
+      return {{index.lower_bound(search_value), index.cend()}};
+    default:
+      Fail("Unknown scan type");
+  }
+  return {};
+}
+
+}  // namespace
+
+IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator> in, const SegmentIndexType index_type,
+                     const ColumnID column_id, const ScanType scan_type, const AllTypeVariant search_value)
+    : AbstractOperator(in),
+      _index_type{index_type},
+      _column_id{column_id},
+      _scan_type{scan_type},
+      _search_value{search_value} {}
+
+SegmentIndexType IndexScan::index_type() const { return _index_type; }
+
+ColumnID IndexScan::column_id() const { return _column_id; }
+
+ScanType IndexScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& IndexScan::search_value() const { return _search_value; }
+
+const std::string IndexScan::name() const { return "IndexScan"; }
+
+const std::string IndexScan::description() const {
+  return name() + " column " + std::to_string(_column_id) + " " + scan_type_to_string(_scan_type) + " " +
+         type_cast<std::string>(_search_value);
+}
+
+void IndexScan::set_fallback_selectivity(const float fallback_selectivity) {
+  _fallback_selectivity = fallback_selectivity;
+}
+
+std::shared_ptr<const Table> IndexScan::_on_execute() {
+  Assert(_input_left != nullptr, "No input available");
+  const auto input_table = _input_table_left();
+
+  // A CrackerIndex does not hand out iterators, the TableScan uses it through its scan method instead
+  if (_index_type == SegmentIndexType::Cracker) return _table_scan();
+
+  // Look up all indexed chunks first. This is cheap and tells us how selective the predicate is. The chunks are kept,
+  // as the table might replace them (e.g., by their compressed versions) in the meantime.
+  const auto chunk_count = input_table->chunk_count();
+  auto chunks = std::vector<std::shared_ptr<const Chunk>>(chunk_count);
+  auto chunk_ranges = std::vector<std::vector<IndexRange>>(chunk_count);
+  auto indexed_chunk_count = size_t{0};
+  auto indexed_row_count = size_t{0};
+  auto match_count = size_t{0};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunks[chunk_id] = input_table->get_chunk(chunk_id);
+    const auto index = chunks[chunk_id]->get_index(_index_type, _column_id);
+    if (!index) continue;
+
+    chunk_ranges[chunk_id] = get_index_ranges(*index, _scan_type, _search_value);
+    for (const auto& [range_begin, range_end] : chunk_ranges[chunk_id]) {
+      match_count += std::distance(range_begin, range_end);
+    }
+
+    ++indexed_chunk_count;
+    indexed_row_count += chunks[chunk_id]->size();
+  }
+
+  if (indexed_chunk_count == 0 || match_count > _fallback_selectivity * indexed_row_count) {
+    return _table_scan();
+  }
+
+  const auto result_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    result_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  // Chunks without an index are scanned sequentially
+  const auto table_scan = std::make_shared<TableScan>(_input_left, _column_id, _scan_type, _search_value);
+  const auto table_scan_impl = table_scan->create_impl(input_table->column_type(_column_id));
+
+  // The output chunks follow the order of the input chunks
+  const auto snapshot = _snapshot();
+  const auto memory_pool = std::make_shared<MemoryPool>();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    // every index lookup yields at least one range
+    if (chunk_ranges[chunk_id].empty()) {
+      auto table_scan_chunk = table_scan_impl->scan_chunk(input_table, *chunks[chunk_id], chunk_id, snapshot);
+      if (table_scan_chunk && table_scan_chunk->size() > 0) result_table->emplace_chunk(std::move(*table_scan_chunk));
+      continue;
+    }
+
+    const auto pos_list = make_pooled_pos_list(memory_pool);
+    for (const auto& [range_begin, range_end] : chunk_ranges[chunk_id]) {
+      pos_list->reserve(pos_list->size() + std::distance(range_begin, range_end));
+      std::for_each(range_begin, range_end,
+                    [&](const auto chunk_offset) { pos_list->emplace_back(RowID{chunk_id, chunk_offset}); });
+    }
+    // The index returns the positions in value order, but consumers expect them in table order
+    std::sort(pos_list->begin(), pos_list->end());
+    remove_invisible_rows(*chunks[chunk_id], snapshot, *pos_list);
+
+    Chunk chunk;
+    add_reference_segments(chunk, input_table, input_table->column_count(), pos_list, memory_pool);
+    result_table->emplace_chunk(std::move(chunk));
+  }
+
+  return result_table;
+}
+
+std::shared_ptr<const Table> IndexScan::_table_scan() const {
+  const auto table_scan = std::make_shared<TableScan>(_input_left, _column_id, _scan_type, _search_value);
+  table_scan->set_transaction_context(_transaction_context);
+  table_scan->execute();
+  return table_scan->get_output();
+}
+
+}  // namespace opossum
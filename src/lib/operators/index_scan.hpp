@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// IndexScan answers the same predicates as TableScan, but uses the indexes of the given type that are attached to
+// the chunks of the input table. Each indexed chunk is answered by one or two lookups with logarithmic costs, the
+// remaining chunks (e.g., the mutable last chunk or all chunks of a reference table) are passed on to a TableScan.
+// The output chunks follow the order of the input chunks. Indexes are only built on chunks that are not appended to
+// anymore (see Chunk::create_index), so they cover all rows of their chunk.
+//
+// When the predicate is not selective, i.e., the indexes report that more than the fallback selectivity of the
+// indexed rows qualify, sorting the positions found by the indexes is more expensive than sequentially scanning the
+// table. In this case, the whole table is handed to a TableScan.
+class IndexScan : public AbstractOperator {
+ public:
+  static constexpr float DEFAULT_FALLBACK_SELECTIVITY = 0.25f;
+
+  IndexScan(const std::shared_ptr<const AbstractOperator> in, const SegmentIndexType index_type,
+            const ColumnID column_id, const ScanType scan_type, const AllTypeVariant search_value);
+
+  SegmentIndexType index_type() const;
+
+  ColumnID column_id() const;
+
+  ScanType scan_type() const;
+
+  const AllTypeVariant& search_value() const;
+
+  const std::string name() const override;
+
+  const std::string description() const override;
+
+  // sets the fraction of qualifying rows above which the IndexScan falls back to a TableScan
+  void set_fallback_selectivity(const float fallback_selectivity);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // scans the whole input table with a TableScan
+  std::shared_ptr<const Table> _table_scan() const;
+
+  const SegmentIndexType _index_type;
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+  float _fallback_selectivity = DEFAULT_FALLBACK_SELECTIVITY;
+};
+
+}  // namespace opossum
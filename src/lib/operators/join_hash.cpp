@@ -0,0 +1,197 @@
+#include "join_hash.hpp"
+
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "runtime_filter.hpp"
+#include "storage/materialize.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_pool.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the table and column that output segments for a column of an input table reference
+using ReferencedColumn = std::pair<std::shared_ptr<const Table>, ColumnID>;
+
+// Segments of reference tables are resolved, so that the output never references ReferenceSegments
+std::vector<ReferencedColumn> get_referenced_columns(const std::shared_ptr<const Table>& table) {
+  auto referenced_columns = std::vector<ReferencedColumn>{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    referenced_columns.emplace_back(table, column_id);
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (chunk->size() == 0) continue;
+
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
+      if (reference_segment) {
+        referenced_columns[column_id] = {reference_segment->referenced_table(),
+                                         reference_segment->referenced_column_id()};
+      }
+    }
+    break;
+  }
+
+  return referenced_columns;
+}
+
+// Returns the positions of the rows of a chunk in the table that the output references. All segments of a chunk of a
+// reference table are expected to share their pos list, as they do in the output of our scans.
+PosList get_row_ids(const Chunk& chunk, const ChunkID chunk_id, const ColumnID column_id) {
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk.get_segment(column_id));
+  if (reference_segment) {
+    if (reference_segment->pos_ranges()) return reference_segment->pos_ranges()->to_pos_list();
+    if (reference_segment->chunk_pos_list()) return reference_segment->chunk_pos_list()->to_pos_list();
+    return *reference_segment->pos_list();
+  }
+
+  auto row_ids = PosList(chunk.size());
+  for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+    row_ids[chunk_offset] = RowID{chunk_id, chunk_offset};
+  }
+  return row_ids;
+}
+
+// Drops the keys and positions of rows of a stored chunk that are not visible in the snapshot. Rows of reference
+// tables were checked by the operator that produced them.
+template <typename T>
+void remove_invisible_rows(const Chunk& chunk, const Snapshot& snapshot, std::vector<T>& keys, PosList& row_ids) {
+  const auto mvcc_data = chunk.mvcc_data();
+  if (!mvcc_data || !mvcc_data->modified()) return;
+
+  auto visible_rows = std::vector<uint8_t>{};
+  mvcc_data->get_visible_rows(snapshot, chunk.size(), visible_rows);
+
+  // Compact both in place. visible_row_count never overtakes the read position.
+  auto visible_row_count = size_t{0};
+  for (size_t position = 0; position < keys.size(); ++position) {
+    keys[visible_row_count] = keys[position];
+    row_ids[visible_row_count] = row_ids[position];
+    visible_row_count += visible_rows[row_ids[position].chunk_offset];
+  }
+  keys.resize(visible_row_count);
+  row_ids.resize(visible_row_count);
+}
+
+}  // namespace
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
+                   const std::shared_ptr<const AbstractOperator> right, const ColumnID left_column_id,
+                   const ColumnID right_column_id)
+    : AbstractOperator(left, right),
+      _left_column_id{left_column_id},
+      _right_column_id{right_column_id},
+      _runtime_filter{std::make_shared<RuntimeFilter>(right, right_column_id)} {}
+
+const std::string JoinHash::name() const { return "JoinHash"; }
+
+const std::string JoinHash::description() const {
+  return name() + " column " + std::to_string(_left_column_id) + " = column " + std::to_string(_right_column_id);
+}
+
+ColumnID JoinHash::left_column_id() const { return _left_column_id; }
+
+ColumnID JoinHash::right_column_id() const { return _right_column_id; }
+
+std::shared_ptr<const RuntimeFilter> JoinHash::runtime_filter() const { return _runtime_filter; }
+
+void JoinHash::_on_reset() { _runtime_filter->reset(); }
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  Assert(_input_left != nullptr && _input_right != nullptr, "JoinHash needs two inputs");
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  const auto data_type = left_table->column_type(_left_column_id);
+  Assert(data_type == right_table->column_type(_right_column_id), "Join columns have different types");
+
+  const auto result_table = std::make_shared<Table>();
+  for (const auto& input_table : {left_table, right_table}) {
+    for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+      result_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+    }
+  }
+
+  const auto left_referenced_columns = get_referenced_columns(left_table);
+  const auto right_referenced_columns = get_referenced_columns(right_table);
+  const auto snapshot = _snapshot();
+
+  // The hash table is released with the build pool at the end of the execution, the output pool lives with the output
+  auto build_pool = MemoryPool{};
+  const auto output_pool = std::make_shared<MemoryPool>();
+
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    // Build phase: map every key of the right input to the positions of its visible rows. The PosLists of the hash
+    // table allocate from the build pool, too.
+    auto hash_table = std::pmr::unordered_map<Type, PosList>{&build_pool};
+    auto keys = std::vector<Type>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < right_table->chunk_count(); ++chunk_id) {
+      const auto chunk = right_table->get_chunk(chunk_id);
+      if (chunk->size() == 0) continue;
+
+      keys.clear();
+      materialize_values(*chunk->get_segment(_right_column_id), keys);
+      auto row_ids = get_row_ids(*chunk, chunk_id, _right_column_id);
+      if (!std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(_right_column_id))) {
+        remove_invisible_rows(*chunk, snapshot, keys, row_ids);
+      }
+      for (size_t position = 0; position < keys.size(); ++position) {
+        hash_table[keys[position]].push_back(row_ids[position]);
+      }
+    }
+
+    // Probe phase: one output chunk per chunk of the left input
+    for (auto chunk_id = ChunkID{0}; chunk_id < left_table->chunk_count(); ++chunk_id) {
+      const auto chunk = left_table->get_chunk(chunk_id);
+      if (chunk->size() == 0) continue;
+
+      keys.clear();
+      materialize_values(*chunk->get_segment(_left_column_id), keys);
+      auto row_ids = get_row_ids(*chunk, chunk_id, _left_column_id);
+      if (!std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(_left_column_id))) {
+        remove_invisible_rows(*chunk, snapshot, keys, row_ids);
+      }
+
+      const auto left_pos_list = make_pooled_pos_list(output_pool);
+      const auto right_pos_list = make_pooled_pos_list(output_pool);
+      for (size_t position = 0; position < keys.size(); ++position) {
+        const auto match = hash_table.find(keys[position]);
+        if (match == hash_table.end()) continue;
+
+        for (const auto& right_row_id : match->second) {
+          left_pos_list->push_back(row_ids[position]);
+          right_pos_list->push_back(right_row_id);
+        }
+      }
+      if (left_pos_list->empty()) continue;
+
+      Chunk output_chunk;
+      for (const auto& [referenced_table, referenced_column_id] : left_referenced_columns) {
+        output_chunk.add_segment(
+            make_pooled_shared<ReferenceSegment>(output_pool, referenced_table, referenced_column_id, left_pos_list));
+      }
+      for (const auto& [referenced_table, referenced_column_id] : right_referenced_columns) {
+        output_chunk.add_segment(
+            make_pooled_shared<ReferenceSegment>(output_pool, referenced_table, referenced_column_id, right_pos_list));
+      }
+      result_table->emplace_chunk(std::move(output_chunk));
+    }
+  });
+
+  return result_table;
+}
+
+}  // namespace opossum
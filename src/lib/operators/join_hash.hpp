@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class RuntimeFilter;
+
+// JoinHash is an inner equi-join. It builds a hash table over the join keys of the right input and probes it with
+// the left input, so the right input should be the smaller one (e.g., a filtered dimension table).
+//
+// The output contains the columns of the left input followed by those of the right input. Like a TableScan, it
+// only holds ReferenceSegments, which point to the tables that the inputs hold or reference. One output chunk is
+// created for every chunk of the left input that has join partners.
+class JoinHash : public AbstractOperator {
+ public:
+  JoinHash(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+           const ColumnID left_column_id, const ColumnID right_column_id);
+
+  const std::string name() const override;
+
+  const std::string description() const override;
+
+  ColumnID left_column_id() const;
+
+  ColumnID right_column_id() const;
+
+  // Returns a Bloom filter over the join keys of the right input. Pass it to the TableScan that produces the left
+  // input (TableScan::add_runtime_filter) to drop rows without a join partner early. Since it is built from the
+  // output of the right input, the right input has to be executed before that scan.
+  std::shared_ptr<const RuntimeFilter> runtime_filter() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  void _on_reset() override;
+
+  const ColumnID _left_column_id;
+  const ColumnID _right_column_id;
+  const std::shared_ptr<RuntimeFilter> _runtime_filter;
+};
+
+}  // namespace opossum
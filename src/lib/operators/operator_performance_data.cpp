@@ -0,0 +1,97 @@
+#include "operator_performance_data.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::string format_duration(const std::chrono::nanoseconds duration) {
+  auto stream = std::stringstream{};
+  stream << std::fixed << std::setprecision(3);
+  if (duration < std::chrono::microseconds{1}) {
+    stream << duration.count() << " ns";
+  } else if (duration < std::chrono::milliseconds{1}) {
+    stream << duration.count() / 1e3 << " us";
+  } else if (duration < std::chrono::seconds{1}) {
+    stream << duration.count() / 1e6 << " ms";
+  } else {
+    stream << duration.count() / 1e9 << " s";
+  }
+  return stream.str();
+}
+
+std::string format_bytes(const uint64_t bytes) {
+  auto stream = std::stringstream{};
+  stream << std::fixed << std::setprecision(1);
+  if (bytes < 1024) {
+    stream << bytes << " B";
+  } else if (bytes < 1024 * 1024) {
+    stream << bytes / 1024.0 << " KiB";
+  } else {
+    stream << bytes / (1024.0 * 1024.0) << " MiB";
+  }
+  return stream.str();
+}
+
+// returns the positions that a ReferenceSegment shares with the other segments of its chunk
+const void* positions_of(const ReferenceSegment& reference_segment) {
+  if (reference_segment.pos_ranges()) return reference_segment.pos_ranges().get();
+  if (reference_segment.chunk_pos_list()) return reference_segment.chunk_pos_list().get();
+  return reference_segment.pos_list().get();
+}
+
+}  // namespace
+
+std::atomic_bool OperatorPerformanceData::_is_enabled{false};
+
+void OperatorPerformanceData::set_enabled(const bool enabled) { _is_enabled = enabled; }
+
+bool OperatorPerformanceData::is_enabled() { return _is_enabled.load(std::memory_order_relaxed); }
+
+uint64_t OperatorPerformanceData::estimate_memory_consumption(const Table& table) {
+  auto bytes = uint64_t{0};
+  // PosLists and PosRanges
+  auto counted_positions = std::unordered_set<const void*>{};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      const auto segment = chunk->get_segment(column_id);
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+      if (reference_segment && !counted_positions.insert(positions_of(*reference_segment)).second) {
+        bytes += sizeof(ReferenceSegment);
+        continue;
+      }
+      bytes += segment->memory_consumption();
+    }
+  }
+
+  return bytes;
+}
+
+std::string OperatorPerformanceData::to_string() const {
+  if (!has_data) return "not recorded";
+
+  auto stream = std::stringstream{};
+  stream << format_duration(walltime) << " wall, " << format_duration(cpu_time) << " CPU, ";
+  stream << input_row_count << " rows / " << input_chunk_count << " chunks in, ";
+  stream << output_row_count << " rows / " << output_chunk_count << " chunks out, " << format_bytes(output_bytes);
+
+  // counters per row of the input, or of the output for operators without input rows (e.g., GetTable)
+  const auto has_counters = std::any_of(counters.values.cbegin(), counters.values.cend(),
+                                       [](const auto& value) { return value.has_value(); });
+  if (has_counters) {
+    stream << ", " << counters.to_string(input_row_count > 0 ? input_row_count : output_row_count);
+  }
+  return stream.str();
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "utils/performance_counters.hpp"
+
+namespace opossum {
+
+class Table;
+
+// OperatorPerformanceData is recorded by AbstractOperator::execute while recording is enabled. Recording is disabled by
+// default, in which case execute only pays for checking the flag.
+struct OperatorPerformanceData {
+  // enables or disables recording for all operators that are executed afterwards
+  static void set_enabled(const bool enabled);
+
+  static bool is_enabled();
+
+  // returns the number of bytes occupied by the segments of the table, counting positions shared by several
+  // ReferenceSegments only once
+  static uint64_t estimate_memory_consumption(const Table& table);
+
+  // returns a one-line summary, e.g., "1.2 ms wall, 1.1 ms CPU, 20 rows / 4 chunks in, 4 rows / 2 chunks out, 512 B"
+  std::string to_string() const;
+
+  bool has_data = false;
+
+  std::chrono::nanoseconds walltime{0};
+
+  // time that the executing thread spent on a CPU. Work that the operator hands to other threads (e.g., the
+  // workers of a Pipeline) is not included.
+  std::chrono::nanoseconds cpu_time{0};
+
+  // summed up over both inputs
+  uint64_t input_row_count = 0;
+  uint64_t input_chunk_count = 0;
+
+  uint64_t output_row_count = 0;
+  uint64_t output_chunk_count = 0;
+
+  // memory occupied by the output table (see estimate_memory_consumption)
+  uint64_t output_bytes = 0;
+
+  // hardware counters of the executing thread, only measured while PerformanceCounters are enabled as well
+  PerformanceCounterValues counters;
+
+ protected:
+  static std::atomic_bool _is_enabled;
+};
+
+}  // namespace opossum
@@ -0,0 +1,172 @@
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "aggregate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/table.hpp"
+#include "table_scan.hpp"
+#include "utils/assert.hpp"
+#include "utils/tracer.hpp"
+
+namespace opossum {
+
+namespace {
+
+// returns the scans of the chain starting at root or, if root is an Aggregate, at its input, the topmost one first
+std::vector<std::shared_ptr<const TableScan>> collect_stages(const std::shared_ptr<const AbstractOperator>& root) {
+  const auto aggregate = std::dynamic_pointer_cast<const Aggregate>(root);
+  auto stages = std::vector<std::shared_ptr<const TableScan>>{};
+  for (auto table_scan = std::dynamic_pointer_cast<const TableScan>(aggregate ? aggregate->input_left() : root);
+       table_scan;
+       table_scan = std::dynamic_pointer_cast<const TableScan>(table_scan->input_left())) {
+    stages.push_back(table_scan);
+  }
+  Assert(!stages.empty(), "A pipeline has to end with a TableScan");
+  return stages;
+}
+
+// Shared by all threads working on the pipeline. Workers that start late, after all chunks were taken, still hold it.
+struct PipelineState {
+  std::shared_ptr<const Table> source_table;
+  Snapshot snapshot;
+  std::vector<std::unique_ptr<BaseTableScanImpl>> table_scan_impls;
+  std::vector<std::optional<Chunk>> output_chunks;
+
+  // If the pipeline ends in an Aggregate, the output chunks are not kept. Every worker aggregates the chunks it
+  // produced and merges its partial result into the accumulator before it marks its last chunk as finished.
+  std::shared_ptr<const Aggregate> aggregate;
+  std::optional<AggregateAccumulator> accumulator;
+
+  std::atomic<uint32_t> next_chunk_id{0};
+  std::atomic<uint32_t> finished_chunk_count{0};
+  std::mutex finished_mutex;
+  std::condition_variable finished_condition;
+  std::exception_ptr exception;
+
+  // takes chunks from the source and runs them through all stages until no chunk is left
+  void work() {
+    const auto chunk_count = static_cast<uint32_t>(source_table->chunk_count());
+    auto worker_accumulator = std::optional<AggregateAccumulator>{};
+    for (auto chunk_id = ChunkID{next_chunk_id++}; chunk_id < chunk_count;) {
+      const auto trace_scope =
+          TraceScope{"chunk", Tracer::is_enabled() ? "Pipeline chunk " + std::to_string(chunk_id) : std::string{}};
+      try {
+        auto chunk =
+            table_scan_impls.front()->scan_chunk(source_table, *source_table->get_chunk(chunk_id), chunk_id, snapshot);
+        for (auto stage = size_t{1}; stage < table_scan_impls.size() && chunk; ++stage) {
+          chunk = table_scan_impls[stage]->scan_chunk(source_table, *chunk, chunk_id, snapshot);
+        }
+
+        if (!aggregate) {
+          output_chunks[chunk_id] = std::move(chunk);
+        } else if (chunk) {
+          if (!worker_accumulator) worker_accumulator.emplace(*source_table, aggregate->aggregates());
+          worker_accumulator->consume(*chunk, snapshot);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(finished_mutex);
+        if (!exception) exception = std::current_exception();
+      }
+
+      const auto next_chunk_id_of_worker = ChunkID{next_chunk_id++};
+      if (next_chunk_id_of_worker >= chunk_count && worker_accumulator) {
+        std::lock_guard<std::mutex> lock(finished_mutex);
+        accumulator->merge(*worker_accumulator);
+      }
+
+      if (++finished_chunk_count == chunk_count) {
+        { std::lock_guard<std::mutex> lock(finished_mutex); }
+        finished_condition.notify_all();
+      }
+      chunk_id = next_chunk_id_of_worker;
+    }
+  }
+};
+
+}  // namespace
+
+Pipeline::Pipeline(const std::shared_ptr<const AbstractOperator>& root)
+    : AbstractOperator(collect_stages(root).back()->input_left()),
+      _stages(collect_stages(root)),
+      _aggregate(std::dynamic_pointer_cast<const Aggregate>(root)) {
+  std::reverse(_stages.begin(), _stages.end());
+}
+
+const std::vector<std::shared_ptr<const TableScan>>& Pipeline::stages() const { return _stages; }
+
+std::shared_ptr<const Aggregate> Pipeline::aggregate() const { return _aggregate; }
+
+const std::string Pipeline::name() const { return "Pipeline"; }
+
+const std::string Pipeline::description() const {
+  auto description = name() + " (";
+  for (auto stage_index = size_t{0}; stage_index < _stages.size(); ++stage_index) {
+    description += (stage_index == 0 ? "" : ", ") + _stages[stage_index]->description();
+  }
+  if (_aggregate) description += ", " + _aggregate->description();
+  return description + ")";
+}
+
+std::shared_ptr<const Table> Pipeline::_on_execute() {
+  const auto state = std::make_shared<PipelineState>();
+  state->source_table = _input_table_left();
+  state->snapshot = _snapshot();
+  const auto chunk_count = static_cast<uint32_t>(state->source_table->chunk_count());
+  if (_aggregate) {
+    state->aggregate = _aggregate;
+    state->accumulator.emplace(*state->source_table, _aggregate->aggregates());
+  } else {
+    state->output_chunks.resize(chunk_count);
+  }
+
+  // All scans of the chain see tables with the same columns. The positions of the chunks passed between them refer
+  // to the tables that the source references, so every scan works on the chunk ids of the source table.
+  for (const auto& stage : _stages) {
+    const auto column_type = state->source_table->column_type(stage->column_id());
+    state->table_scan_impls.push_back(stage->create_impl(column_type));
+  }
+
+  // The calling thread works on the pipeline as well and does not wait for the other workers to pick up their tasks,
+  // so that a pipeline also finishes if all other workers are busy
+  if (CurrentScheduler::is_set()) {
+    const auto worker_count = CurrentScheduler::get()->topology().cpu_count();
+    const auto thread_count = std::min(static_cast<size_t>(chunk_count), worker_count);
+    for (auto helper = size_t{1}; helper < thread_count; ++helper) {
+      std::make_shared<JobTask>([state]() { state->work(); })->schedule();
+    }
+  }
+  state->work();
+
+  {
+    std::unique_lock<std::mutex> lock(state->finished_mutex);
+    state->finished_condition.wait(lock, [&]() { return state->finished_chunk_count == chunk_count; });
+    if (state->exception) std::rethrow_exception(state->exception);
+  }
+
+  if (_aggregate) return state->accumulator->output_table();
+
+  const auto result_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < state->source_table->column_count(); ++column_id) {
+    result_table->add_column_definition(state->source_table->column_name(column_id),
+                                        state->source_table->column_type(column_id));
+  }
+  for (auto& chunk : state->output_chunks) {
+    if (chunk) result_table->emplace_chunk(std::move(*chunk));
+  }
+
+  return result_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+class Aggregate;
+class TableScan;
+
+// Pipeline executes a chain of TableScans chunk by chunk instead of operator by operator. Every chunk of the source
+// (the input of the lowest scan) passes through all scans at once, so that only the output chunks of the topmost scan
+// are kept instead of one full intermediate table per scan. With a CurrentScheduler, the workers take chunks from the
+// source concurrently, while chunks that are further along are already processed by later stages.
+//
+// The Pipeline replaces the topmost operator of the chain: its input is the input of the lowest scan, and its output
+// is what the topmost operator would have returned. The operators themselves are never executed. The chain may end in
+// an Aggregate, which then consumes the output chunks of the topmost scan as they are produced, so that they are
+// dropped right away instead of being collected in an intermediate table.
+class Pipeline : public AbstractOperator {
+ public:
+  // Follows the inputs of root for as long as they are TableScans. root itself has to be a TableScan or an Aggregate
+  // whose input is one.
+  explicit Pipeline(const std::shared_ptr<const AbstractOperator>& root);
+
+  // returns the scans of the pipeline, the lowest one first
+  const std::vector<std::shared_ptr<const TableScan>>& stages() const;
+
+  // returns the Aggregate that ends the pipeline or nullptr if it ends in a scan
+  std::shared_ptr<const Aggregate> aggregate() const;
+
+  const std::string name() const override;
+
+  const std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::vector<std::shared_ptr<const TableScan>> _stages;
+  std::shared_ptr<const Aggregate> _aggregate;
+};
+
+}  // namespace opossum
@@ -8,13 +8,34 @@
 #include <vector>
 
 #include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
 #include "storage/base_segment.hpp"
+#include "storage/materialize.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Returns the values of the segments of a chunk, column by column. They are materialized in bulk instead of through
+// BaseSegment::operator[], which looks up the referenced segment for every row of a ReferenceSegment.
+std::vector<std::vector<AllTypeVariant>> chunk_values(const Table& table, const Chunk& chunk) {
+  auto columns = std::vector<std::vector<AllTypeVariant>>(chunk.column_count());
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      auto values = std::vector<Type>{};
+      materialize_values(*chunk.get_segment(column_id), values);
+      columns[column_id].assign(values.cbegin(), values.cend());
+    });
+  }
+  return columns;
+}
+
+}  // namespace
+
 Print::Print(const std::shared_ptr<const AbstractOperator> in, std::ostream& out) : AbstractOperator(in), _out(out) {}
 
 void Print::print(std::shared_ptr<const Table> table, std::ostream& out) {
@@ -23,6 +44,8 @@ void Print::print(std::shared_ptr<const Table> table, std::ostream& out) {
   Print(table_wrapper, out).execute();
 }
 
+const std::string Print::name() const { return "Print"; }
+
 std::shared_ptr<const Table> Print::_on_execute() {
   PerformanceWarningDisabler pwd;
 
@@ -41,22 +64,22 @@ std::shared_ptr<const Table> Print::_on_execute() {
 
   // print each chunk
   for (ChunkID chunk_id{0}; chunk_id < _input_table_left()->chunk_count(); ++chunk_id) {
-    const auto& chunk = _input_table_left()->get_chunk(chunk_id);
+    const auto chunk = _input_table_left()->get_chunk(chunk_id);
 
     _out << "=== Chunk " << chunk_id << " === " << std::endl;
 
-    if (chunk.size() == 0) {
+    if (chunk->size() == 0) {
       _out << "Empty chunk." << std::endl;
       continue;
     }
 
     // print the rows in the chunk
-    for (size_t row = 0; row < chunk.size(); ++row) {
+    const auto row_count = chunk->size();
+    const auto columns = chunk_values(*_input_table_left(), *chunk);
+    for (size_t row = 0; row < row_count; ++row) {
       _out << "|";
-      for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
-        // well yes, we use BaseSegment::operator[] here, but since Print is not an operation that should
-        // be part of a regular query plan, let's keep things simple here
-        _out << std::setw(widths[column_id]) << (*chunk.get_segment(column_id))[row] << "|" << std::setw(0);
+      for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+        _out << std::setw(widths[column_id]) << columns[column_id][row] << "|" << std::setw(0);
       }
 
       _out << std::endl;
@@ -78,12 +101,13 @@ std::vector<uint16_t> Print::column_string_widths(uint16_t min, uint16_t max, st
 
   // go over all rows and find the maximum length of the printed representation of a value, up to max
   for (ChunkID chunk_id{0}; chunk_id < _input_table_left()->chunk_count(); ++chunk_id) {
-    auto& chunk = _input_table_left()->get_chunk(chunk_id);
+    const auto chunk = _input_table_left()->get_chunk(chunk_id);
+    const auto row_count = chunk->size();
+    const auto columns = chunk_values(*t, *chunk);
 
-    for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
-      for (size_t row = 0; row < chunk.size(); ++row) {
-        auto cell_length =
-            static_cast<uint16_t>(boost::lexical_cast<std::string>((*chunk.get_segment(column_id))[row]).size());
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      for (size_t row = 0; row < row_count; ++row) {
+        auto cell_length = static_cast<uint16_t>(boost::lexical_cast<std::string>(columns[column_id][row]).size());
         widths[column_id] = std::max({min, widths[column_id], std::min(max, cell_length)});
       }
     }
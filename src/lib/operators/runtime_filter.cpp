@@ -0,0 +1,138 @@
+#include "runtime_filter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "resolve_type.hpp"
+#include "storage/bloom_filter.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/materialize.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// number of values that are hashed before the filter is probed for them
+constexpr size_t BATCH_SIZE = 256;
+
+}  // namespace
+
+RuntimeFilter::RuntimeFilter(const std::shared_ptr<const AbstractOperator> build_operator,
+                             const ColumnID build_column_id, const size_t bits_per_value)
+    : _build_operator{build_operator}, _build_column_id{build_column_id}, _bits_per_value{bits_per_value} {}
+
+bool RuntimeFilter::may_match_segment(const BaseSegment& segment) const {
+  _build();
+
+  auto may_match = true;
+  resolve_data_type(_data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    const auto dictionary_segment = dynamic_cast<const DictionarySegment<Type>*>(&segment);
+    if (!dictionary_segment) return;
+
+    may_match = false;
+    for (const auto& value : *dictionary_segment->dictionary()) {
+      if (_bloom_filter->may_contain(value)) {
+        may_match = true;
+        return;
+      }
+    }
+  });
+  return may_match;
+}
+
+void RuntimeFilter::filter(const std::shared_ptr<const Table>& referenced_table, const ColumnID column_id,
+                           const std::shared_ptr<ChunkPosList>& chunk_pos_list) const {
+  const auto may_pass = _may_pass(ReferenceSegment{referenced_table, column_id, chunk_pos_list});
+  chunk_pos_list->remove_if([&](const ChunkOffset, const size_t position) { return !may_pass[position]; });
+}
+
+void RuntimeFilter::filter(const ReferenceSegment& segment, std::vector<ChunkOffset>& positions) const {
+  const auto pos_list = std::make_shared<PosList>(referenced_positions(segment, positions));
+  const auto may_pass =
+      _may_pass(ReferenceSegment{segment.referenced_table(), segment.referenced_column_id(), pos_list});
+
+  // Compact the positions in place. kept_count never overtakes the read position.
+  auto kept_count = size_t{0};
+  for (size_t position = 0; position < may_pass.size(); ++position) {
+    positions[kept_count] = positions[position];
+    kept_count += may_pass[position];
+  }
+  positions.resize(kept_count);
+}
+
+size_t RuntimeFilter::build_key_count() const {
+  _build();
+  return _build_key_count;
+}
+
+void RuntimeFilter::reset() {
+  std::lock_guard<std::mutex> lock(_build_mutex);
+  _is_built = false;
+  _bloom_filter = nullptr;
+}
+
+void RuntimeFilter::_build() const {
+  // The filter is probed for every chunk, so the lock is only taken as long as it is not built
+  if (_is_built) return;
+
+  std::lock_guard<std::mutex> lock(_build_mutex);
+  if (_is_built) return;
+
+  const auto build_table = _build_operator->get_output();
+  _data_type = build_table->column_type(_build_column_id);
+
+  resolve_data_type(_data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    auto keys = std::vector<Type>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < build_table->chunk_count(); ++chunk_id) {
+      const auto chunk = build_table->get_chunk(chunk_id);
+      if (chunk->size() == 0) continue;
+      materialize_values(*chunk->get_segment(_build_column_id), keys);
+    }
+
+    const auto bloom_filter = std::make_shared<BloomFilter>(keys.size(), _bits_per_value);
+    for (const auto& key : keys) bloom_filter->insert(key);
+    _bloom_filter = bloom_filter;
+    _build_key_count = keys.size();
+  });
+
+  _is_built = true;
+}
+
+std::vector<uint8_t> RuntimeFilter::_may_pass(const ReferenceSegment& segment) const {
+  _build();
+  Assert(segment.referenced_table()->column_type(segment.referenced_column_id()) == _data_type,
+         "Runtime filter and column types do not match");
+
+  auto may_pass = std::vector<uint8_t>(segment.size());
+  resolve_data_type(_data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    auto values = std::vector<Type>{};
+    materialize_values(segment, values);
+
+    auto hashes = std::array<uint64_t, BATCH_SIZE>{};
+    for (size_t batch_begin = 0; batch_begin < values.size(); batch_begin += BATCH_SIZE) {
+      const auto batch_size = std::min(BATCH_SIZE, values.size() - batch_begin);
+
+      for (size_t position = 0; position < batch_size; ++position) {
+        hashes[position] = BloomFilter::hash(values[batch_begin + position]);
+      }
+      for (size_t position = 0; position < batch_size; ++position) {
+        may_pass[batch_begin + position] = _bloom_filter->may_contain_hash(hashes[position]);
+      }
+    }
+  });
+  return may_pass;
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class BaseSegment;
+class BloomFilter;
+class ChunkPosList;
+class ReferenceSegment;
+class Table;
+
+// A RuntimeFilter summarizes the join keys of the build side of a join in a Bloom filter. A TableScan on the probe
+// side (see TableScan::add_runtime_filter) uses it to drop rows that cannot find a join partner, so that neither the
+// scan output nor the join has to deal with them (semi-join reduction).
+//
+// The filter is built on first use from the output of the build-side operator, which has to be executed before the
+// probe-side scan. Building is thread-safe. When the plan is reset, the filter is rebuilt on its next use.
+class RuntimeFilter : private Noncopyable {
+ public:
+  static constexpr size_t DEFAULT_BITS_PER_VALUE = 8;
+
+  RuntimeFilter(const std::shared_ptr<const AbstractOperator> build_operator, const ColumnID build_column_id,
+                const size_t bits_per_value = DEFAULT_BITS_PER_VALUE);
+
+  // Returns false if no value of the segment can pass the filter. Only DictionarySegments can answer this cheaply by
+  // checking their dictionary, all other segments return true.
+  bool may_match_segment(const BaseSegment& segment) const;
+
+  // Removes all positions from the chunk_pos_list whose value in the given column of the referenced table cannot pass
+  // the filter. Values are hashed in batches before the filter is probed.
+  void filter(const std::shared_ptr<const Table>& referenced_table, const ColumnID column_id,
+              const std::shared_ptr<ChunkPosList>& chunk_pos_list) const;
+
+  // the same for positions in the given segment, whose values are those of the rows it references
+  void filter(const ReferenceSegment& segment, std::vector<ChunkOffset>& positions) const;
+
+  // returns the number of keys (including duplicates) on the build side
+  size_t build_key_count() const;
+
+  // drops the filter, so that the next use builds it from the new output of the build-side operator
+  void reset();
+
+ protected:
+  void _build() const;
+
+  // returns for every position of the segment whether its value may pass the filter
+  std::vector<uint8_t> _may_pass(const ReferenceSegment& segment) const;
+
+  const std::shared_ptr<const AbstractOperator> _build_operator;
+  const ColumnID _build_column_id;
+  const size_t _bits_per_value;
+
+  // built lazily by _build
+  mutable std::mutex _build_mutex;
+  mutable std::atomic_bool _is_built{false};
+  mutable std::shared_ptr<const BloomFilter> _bloom_filter;
+  mutable DataType _data_type{};
+  mutable size_t _build_key_count = 0;
+};
+
+}  // namespace opossum
@@ -1,52 +1,115 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "../storage/bloom_filter.hpp"
 #include "../storage/dictionary_segment.hpp"
+#include "../storage/index/cracker/cracker_index.hpp"
 #include "../storage/reference_segment.hpp"
 #include "../storage/table.hpp"
 #include "../storage/value_segment.hpp"
 #include "abstract_operator.hpp"
 #include "all_type_variant.hpp"
 #include "resolve_type.hpp"
+#include "runtime_filter.hpp"
+#include "storage/segment_iterables.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_pool.hpp"
+#include "utils/performance_counters.hpp"
 
 namespace opossum {
 
-// Dispatch the comparator function according to the scan type
-template <typename T>
-std::function<bool(T, T)> get_comparator(ScanType scan_type) {
+// Passes the comparison of the scan type on to the functor. Other than a std::function, it can be inlined into the
+// loop that uses it.
+template <typename T, typename Functor>
+void resolve_comparator(const ScanType scan_type, const Functor& functor) {
   switch (scan_type) {
-    case ScanType::OpEquals: {
-      return [](T value, T search_value) { return value == search_value; };
-    }
-    case ScanType::OpNotEquals: {
-      return [](T value, T search_value) { return value != search_value; };
-    }
-    case ScanType::OpGreaterThan: {
-      return [](T value, T search_value) { return value > search_value; };
-    }
-    case ScanType::OpGreaterThanEquals: {
-      return [](T value, T search_value) { return value >= search_value; };
-    }
-    case ScanType::OpLessThan: {
-      return [](T value, T search_value) { return value < search_value; };
-    }
-    case ScanType::OpLessThanEquals: {
-      return [](T value, T search_value) { return value <= search_value; };
-    }
-    default: { throw std::runtime_error("Error: Unknown scan type"); };
+    case ScanType::OpEquals:
+      functor(std::equal_to<T>{});
+      return;
+    case ScanType::OpNotEquals:
+      functor(std::not_equal_to<T>{});
+      return;
+    case ScanType::OpGreaterThan:
+      functor(std::greater<T>{});
+      return;
+    case ScanType::OpGreaterThanEquals:
+      functor(std::greater_equal<T>{});
+      return;
+    case ScanType::OpLessThan:
+      functor(std::less<T>{});
+      return;
+    case ScanType::OpLessThanEquals:
+      functor(std::less_equal<T>{});
+      return;
   }
+  throw std::runtime_error("Error: Unknown scan type");
+}
+
+void remove_invisible_rows(const Chunk& chunk, const Snapshot& snapshot, PosList& pos_list) {
+  const auto mvcc_data = chunk.mvcc_data();
+  if (!mvcc_data || pos_list.empty() || !mvcc_data->modified()) return;
+
+  // The visibility of all rows is checked at once, which is cheaper than checking the positions one by one
+  auto visible_rows = std::vector<uint8_t>{};
+  mvcc_data->get_visible_rows(snapshot, chunk.size(), visible_rows);
+  pos_list.erase(std::remove_if(pos_list.begin(), pos_list.end(),
+                                [&](const auto& row_id) { return !visible_rows[row_id.chunk_offset]; }),
+                 pos_list.end());
+}
+
+void remove_invisible_rows(const Chunk& chunk, const Snapshot& snapshot, ChunkPosList& chunk_pos_list) {
+  const auto mvcc_data = chunk.mvcc_data();
+  if (!mvcc_data || chunk_pos_list.size() == 0 || !mvcc_data->modified()) return;
+
+  auto visible_rows = std::vector<uint8_t>{};
+  mvcc_data->get_visible_rows(snapshot, chunk.size(), visible_rows);
+  chunk_pos_list.remove_if([&](const ChunkOffset chunk_offset, const size_t) { return !visible_rows[chunk_offset]; });
+}
+
+std::string scan_type_to_string(const ScanType scan_type) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return "=";
+    case ScanType::OpNotEquals:
+      return "!=";
+    case ScanType::OpGreaterThan:
+      return ">";
+    case ScanType::OpGreaterThanEquals:
+      return ">=";
+    case ScanType::OpLessThan:
+      return "<";
+    case ScanType::OpLessThanEquals:
+      return "<=";
+  }
+  Fail("Unknown scan type");
+  return {};
 }
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
                      const AllTypeVariant search_value)
-    : AbstractOperator(in), _column_id{column_id}, _scan_type{scan_type}, _search_value{search_value} {}
+    : AbstractOperator(in),
+      _column_id{column_id},
+      _scan_type{scan_type},
+      _search_value{search_value},
+      _is_search_value_bound{true} {}
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                     const ParameterID parameter_id)
+    : AbstractOperator(in),
+      _column_id{column_id},
+      _scan_type{scan_type},
+      _parameter_id{parameter_id},
+      _is_search_value_bound{false} {}
 
 ColumnID TableScan::column_id() const { return _column_id; }
 
@@ -54,158 +117,214 @@ ScanType TableScan::scan_type() const { return _scan_type; }
 
 const AllTypeVariant& TableScan::search_value() const { return _search_value; }
 
+const std::optional<ParameterID>& TableScan::parameter_id() const { return _parameter_id; }
+
+const std::string TableScan::name() const { return "TableScan"; }
+
+const std::string TableScan::description() const {
+  // unbound placeholders are shown as $<parameter id>
+  const auto search_value = _is_search_value_bound ? type_cast<std::string>(_search_value)
+                                                   : "$" + std::to_string(static_cast<uint16_t>(*_parameter_id));
+  return name() + " column " + std::to_string(_column_id) + " " + scan_type_to_string(_scan_type) + " " +
+         search_value;
+}
+
+void TableScan::set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids) {
+  _excluded_chunk_ids = chunk_ids;
+  _impl.reset();
+}
+
+void TableScan::add_runtime_filter(const ColumnID column_id,
+                                   const std::shared_ptr<const RuntimeFilter> runtime_filter) {
+  _runtime_filters.emplace_back(column_id, runtime_filter);
+  _impl.reset();
+}
+
+size_t TableScan::skipped_chunk_count() const { return _skipped_chunk_count; }
+
+std::unique_ptr<BaseTableScanImpl> TableScan::create_impl(const DataType column_type) const {
+  Assert(_is_search_value_bound, "The search value placeholder was not bound");
+
+  // Transfer the scan work to the table_scan_impl instance to dispatch the AllTypeVariant search value
+  return make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(column_type, _column_id, _scan_type,
+                                                                    _search_value, _excluded_chunk_ids,
+                                                                    _runtime_filters);
+}
+
 std::shared_ptr<const Table> TableScan::_on_execute() {
   Assert(_input_left != nullptr, "No input available");
   const auto input_table = _input_table_left();
 
-  // Transfer the scan work to the table_scan_impl instance to dispatch the AllTypeVariant search value
-  const auto table_scan_impl = make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(
-      input_table->column_type(_column_id), input_table, _column_id, _scan_type, _search_value);
-  return table_scan_impl->scan();
+  if (!_impl) _impl = create_impl(input_table->column_type(_column_id));
+
+  const auto result_table = _impl->scan(input_table, _snapshot());
+  _skipped_chunk_count = _impl->skipped_chunk_count();
+  return result_table;
+}
+
+void TableScan::_on_reset() { _skipped_chunk_count = 0; }
+
+void TableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  if (!_parameter_id) return;
+
+  const auto parameter_iter = parameters.find(*_parameter_id);
+  if (parameter_iter == parameters.cend()) return;
+
+  _search_value = parameter_iter->second;
+  _is_search_value_bound = true;
+  // The impl, if there is one already, checks the new value right away
+  if (_impl) _impl->set_search_value(_search_value);
 }
 
 template <typename T>
-TableScan::TableScanImpl<T>::TableScanImpl(const std::shared_ptr<const Table> table, ColumnID column_id,
-                                           const ScanType scan_type, const AllTypeVariant search_value)
-    : _table{table}, _column_id{column_id}, _scan_type{scan_type}, _search_value{type_cast<T>(search_value)} {
-  Assert(
-      // Using a lambda function to keep the check inline
-      [](const std::string& typestr, const AllTypeVariant& value) -> bool {
-        bool cast_successful = true;
-
-        // This function inputs the hana datatype for the given type string
-        resolve_data_type(typestr, [&value, &cast_successful](auto type) {
-          // The parameter type is not usable as C Type, therefore defining the type
-          using Type = typename decltype(type)::type;
-          try {
-            // This check succeeds also for casting float to int, except if both values are equivalent anyway
-            const auto casted_value = type_cast<Type>(value);
-            if (value != AllTypeVariant{casted_value}) {
-              throw std::bad_cast();
-            }
-          } catch (const std::bad_cast& e) {
-            cast_successful = false;
-          }
-        });
-        return cast_successful;
-      }(_table->column_type(_column_id), search_value),
-      "SearchValue Type does not match Column Type");
+TableScan::TableScanImpl<T>::TableScanImpl(ColumnID column_id, const ScanType scan_type,
+                                           const AllTypeVariant search_value,
+                                           const std::vector<ChunkID>& excluded_chunk_ids,
+                                           const std::vector<ColumnRuntimeFilter>& runtime_filters)
+    : _column_id{column_id},
+      _scan_type{scan_type},
+      _excluded_chunk_ids{[&]() {
+        // sorted, so that scan_chunk can look chunks up with a binary search
+        auto chunk_ids = excluded_chunk_ids;
+        std::sort(chunk_ids.begin(), chunk_ids.end());
+        return chunk_ids;
+      }()},
+      _runtime_filters{runtime_filters} {
+  set_search_value(search_value);
+}
+
+template <typename T>
+void TableScan::TableScanImpl<T>::set_search_value(const AllTypeVariant& search_value) {
+  // The cast succeeds also for casting float to int, which is only accepted if both values are equivalent anyway
+  const auto casted_value = type_cast<T>(search_value);
+  Assert(search_value == AllTypeVariant{casted_value}, "SearchValue Type does not match Column Type");
+  _search_value = casted_value;
 }
 
 template <typename T>
-void TableScan::TableScanImpl<T>::_scan_value_segment(const std::shared_ptr<ValueSegment<T>> segment,
-                                                      const std::shared_ptr<PosList> pos_list, const ChunkID chunk_id,
-                                                      const std::function<bool(T, T)> comparator) {
-  const std::vector<T>& values = segment->values();
-  for (ChunkOffset index = 0; index < segment->size(); ++index) {
-    if (comparator(values.at(index), _search_value)) {
-      pos_list->emplace_back(RowID{chunk_id, index});
+void TableScan::TableScanImpl<T>::_scan_segment(const ReferenceSegment& segment,
+                                                std::vector<ChunkOffset>& positions) const {
+  const auto iterable = create_iterable<T>(segment);
+  resolve_comparator<T>(_scan_type, [&](const auto& comparator) {
+    iterable.for_each([&](const T& value, const ChunkOffset position) {
+      if (comparator(value, _search_value)) positions.push_back(position);
+    });
+  });
+}
+
+template <typename T>
+void TableScan::TableScanImpl<T>::_scan_segment(const BaseSegment& segment, ChunkPosList& chunk_pos_list) const {
+  // The loop is compiled for every combination of encoding and scan type
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      Fail("The matches of ReferenceSegments are not in the scanned chunk");
+    } else {
+      const auto iterable = create_iterable<T>(typed_segment);
+      resolve_comparator<T>(_scan_type, [&](const auto& comparator) {
+        iterable.for_each([&](const T& value, const ChunkOffset chunk_offset) {
+          if (comparator(value, _search_value)) chunk_pos_list.append(chunk_offset);
+        });
+      });
     }
+  });
+}
+
+template <typename T>
+bool TableScan::TableScanImpl<T>::_is_pruned(const Chunk& chunk) const {
+  // Bloom filters only exist for segments that hold values
+  const auto bloom_filter = chunk.get_bloom_filter(_column_id);
+  if (_scan_type == ScanType::OpEquals && bloom_filter && !bloom_filter->may_contain(_search_value)) return true;
+
+  for (const auto& [column_id, runtime_filter] : _runtime_filters) {
+    if (!runtime_filter->may_match_segment(*chunk.get_segment(column_id))) return true;
   }
+  return false;
 }
 
 template <typename T>
-void TableScan::TableScanImpl<T>::_scan_dictionary_segment(const std::shared_ptr<DictionarySegment<T>> segment,
-                                                           const std::shared_ptr<PosList> pos_list,
-                                                           const ChunkID chunk_id,
-                                                           const std::function<bool(T, T)> comparator) {
-  const auto& attribute_vector = segment->attribute_vector();
-  for (ChunkOffset index = 0; index < attribute_vector->size(); ++index) {
-    // Decompress dictionary for a value comparison
-    if (comparator(segment->value_by_value_id(attribute_vector->get(index)), _search_value)) {
-      pos_list->emplace_back(RowID{chunk_id, index});
-    }
+void TableScan::TableScanImpl<T>::_apply_runtime_filters(const Chunk& chunk,
+                                                         std::vector<ChunkOffset>& positions) const {
+  for (const auto& [column_id, runtime_filter] : _runtime_filters) {
+    if (positions.empty()) return;
+    runtime_filter->filter(static_cast<const ReferenceSegment&>(*chunk.get_segment(column_id)), positions);
   }
 }
 
 template <typename T>
-void TableScan::TableScanImpl<T>::_scan_reference_segment(const std::shared_ptr<ReferenceSegment> segment,
-                                                          const std::shared_ptr<PosList> pos_list,
-                                                          const ChunkID chunk_id,
-                                                          const std::function<bool(T, T)> comparator) {
-  for (const auto& row_id : *(segment->pos_list())) {
-    // Get the referenced segment
-    const auto& referenced_chunk = segment->referenced_table()->get_chunk(row_id.chunk_id);
-    const auto& referenced_segment = referenced_chunk.get_segment(_column_id);
-
-    T value;
-
-    // Dispatch referenced segment type, nested for performance reasons
-    auto dictionary_segment_ptr = std::dynamic_pointer_cast<DictionarySegment<T>>(referenced_segment);
-    if (dictionary_segment_ptr != nullptr) {
-      value = dictionary_segment_ptr->get(row_id.chunk_offset);
-    } else {
-      auto value_segment_ptr = std::dynamic_pointer_cast<ValueSegment<T>>(referenced_segment);
-      if (value_segment_ptr != nullptr) {
-        value = value_segment_ptr->values()[row_id.chunk_offset];
-      } else {
-        throw std::runtime_error("Cannot scan unknown segment type");
-      }
-    }
-    if (comparator(std::as_const(value), _search_value)) {
-      pos_list->emplace_back(row_id);
-    }
+void TableScan::TableScanImpl<T>::_apply_runtime_filters(const std::shared_ptr<const Table>& table,
+                                                         const std::shared_ptr<ChunkPosList>& chunk_pos_list) const {
+  for (const auto& [column_id, runtime_filter] : _runtime_filters) {
+    if (chunk_pos_list->size() == 0) return;
+    runtime_filter->filter(table, column_id, chunk_pos_list);
   }
 }
 
 template <typename T>
-std::shared_ptr<const Table> TableScan::TableScanImpl<T>::scan() {
-  // Initialize comparator
-  const auto comparator = get_comparator<T>(_scan_type);
+std::shared_ptr<const Table> TableScan::TableScanImpl<T>::scan(const std::shared_ptr<const Table>& table,
+                                                               const Snapshot& snapshot) {
+  _skipped_chunk_count = 0;
+  _memory_pool = std::make_shared<MemoryPool>();
 
   // Prepare result table
   const auto result_table = std::make_shared<Table>();
-  for (auto column_id = ColumnID{0}; column_id < _table->column_count(); column_id++) {
-    result_table->add_column_definition(_table->column_name(column_id), _table->column_type(column_id));
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); column_id++) {
+    result_table->add_column_definition(table->column_name(column_id), table->column_type(column_id));
   }
 
-  // Determine segment type and scan for search value
-  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); chunk_id++) {
-    // Initialize chunk position list
-    const auto chunk_pos_list = std::make_shared<PosList>();
-    const auto segment = _table->get_chunk(chunk_id).get_segment(_column_id);
-
-    const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment);
-    if (dictionary_segment != nullptr) {
-      _scan_dictionary_segment(dictionary_segment, chunk_pos_list, chunk_id, comparator);
-      Chunk chunk;
-      for (auto column_id = ColumnID{0}; column_id < result_table->column_count(); column_id++) {
-        // Create a reference segment for every segment with the current chunk pos list
-        chunk.add_segment(std::make_shared<ReferenceSegment>(_table, column_id, chunk_pos_list));
-      }
-      result_table->emplace_chunk(std::move(chunk));
-      continue;
-    }
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); chunk_id++) {
+    auto chunk = scan_chunk(table, *table->get_chunk(chunk_id), chunk_id, snapshot);
+    if (chunk) result_table->emplace_chunk(std::move(*chunk));
+  }
 
-    const auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment);
-    if (reference_segment != nullptr) {
-      _scan_reference_segment(reference_segment, chunk_pos_list, chunk_id, comparator);
-      Chunk chunk;
-      for (auto column_id = ColumnID{0}; column_id < result_table->column_count(); column_id++) {
-        // Create a reference segment for every segment with the current chunk pos list
-        // The referenced table is equivalent to the referenced table of the ReferenceSegment
-        chunk.add_segment(
-            std::make_shared<ReferenceSegment>(reference_segment->referenced_table(), column_id, chunk_pos_list));
-      }
-      result_table->emplace_chunk(std::move(chunk));
-      continue;
-    }
+  return result_table;
+}
 
-    const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(segment);
-    if (value_segment != nullptr) {
-      _scan_value_segment(value_segment, chunk_pos_list, chunk_id, comparator);
-      Chunk chunk;
-      for (auto column_id = ColumnID{0}; column_id < result_table->column_count(); column_id++) {
-        // Create a reference segment for every segment with the current chunk pos list
-        chunk.add_segment(std::make_shared<ReferenceSegment>(_table, column_id, chunk_pos_list));
-      }
-      result_table->emplace_chunk(std::move(chunk));
-      continue;
-    }
+template <typename T>
+std::optional<Chunk> TableScan::TableScanImpl<T>::scan_chunk(const std::shared_ptr<const Table>& table,
+                                                             const Chunk& input_chunk, const ChunkID chunk_id,
+                                                             const Snapshot& snapshot) {
+  if (std::binary_search(_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend(), chunk_id)) return std::nullopt;
+
+  const auto performance_counter_scope = PerformanceCounterScope{"TableScan chunk", input_chunk.size()};
+
+  const auto segment = input_chunk.get_segment(_column_id);
+  const auto is_pruned = _is_pruned(input_chunk);
+  // No row of a pruned chunk can qualify, the output gets an empty chunk for it
+  if (is_pruned) ++_skipped_chunk_count;
 
-    throw std::runtime_error("Error: Can not scan unknown segment type");
+  Chunk chunk;
+
+  if (const auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
+    // Every output column references the rows that its input column references at the matching positions. The input
+    // columns might reference different tables (e.g., for the output of a JoinHash). The visibility of the rows was
+    // already checked by the operator that produced the ReferenceSegments.
+    auto positions = std::vector<ChunkOffset>{};
+    if (!is_pruned) _scan_segment(*reference_segment, positions);
+    _apply_runtime_filters(input_chunk, positions);
+
+    add_reference_segments(chunk, input_chunk, positions, _memory_pool);
+    return chunk;
   }
 
-  return result_table;
+  // The matches in a stored chunk are written as chunk offsets, without materializing a RowID per match
+  const auto chunk_pos_list = make_pooled_shared<ChunkPosList>(_memory_pool, chunk_id, _memory_pool.get());
+
+  if (!is_pruned) {
+    // A CrackerIndex exists only on ValueSegments. It answers the scan and partitions its copy of the segment further
+    // for upcoming scans.
+    const auto cracker_index = input_chunk.get_index(SegmentIndexType::Cracker, _column_id);
+    if (cracker_index) {
+      std::static_pointer_cast<const CrackerIndex>(cracker_index)->scan(_scan_type, _search_value, *chunk_pos_list);
+    } else {
+      _scan_segment(*segment, *chunk_pos_list);
+    }
+  }
+
+  remove_invisible_rows(input_chunk, snapshot, *chunk_pos_list);
+  _apply_runtime_filters(table, chunk_pos_list);
+
+  add_reference_segments(chunk, table, table->column_count(), chunk_pos_list, _memory_pool);
+  return chunk;
 }
 }  // namespace opossum
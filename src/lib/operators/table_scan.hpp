@@ -1,8 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "../storage/dictionary_segment.hpp"
@@ -13,56 +16,145 @@
 #include "all_type_variant.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_pool.hpp"
 
 namespace opossum {
 
+// The typed part of a TableScan. It is created once per TableScan and reused when the scan is executed again, so that
+// the data type of the column is only resolved once.
 class BaseTableScanImpl {
  public:
-  virtual std::shared_ptr<const Table> scan() = 0;
+  virtual ~BaseTableScanImpl() = default;
+
+  // Scans the table. Rows of stored chunks that the snapshot does not see are not part of the output.
+  virtual std::shared_ptr<const Table> scan(const std::shared_ptr<const Table>& table, const Snapshot& snapshot) = 0;
+
+  // Scans a single chunk of the given table and returns the output chunk for it, or nothing if the chunk is excluded.
+  // The chunk itself may come from a different table with the same columns, as long as it only holds
+  // ReferenceSegments (see Pipeline). Thread-safe.
+  virtual std::optional<Chunk> scan_chunk(const std::shared_ptr<const Table>& table, const Chunk& input_chunk,
+                                          const ChunkID chunk_id, const Snapshot& snapshot) = 0;
+
+  // checks that the search value fits the column type and uses it for upcoming scans
+  virtual void set_search_value(const AllTypeVariant& search_value) = 0;
+
+  // returns the number of chunks that the last scan skipped because their Bloom filter ruled out the search value
+  size_t skipped_chunk_count() const { return _skipped_chunk_count; }
+
+ protected:
+  std::atomic<size_t> _skipped_chunk_count{0};
 };
 
+class RuntimeFilter;
 class Table;
 
+// returns the comparison operator of the scan type, e.g., ">=" for OpGreaterThanEquals
+std::string scan_type_to_string(const ScanType scan_type);
+
+// Removes the positions of rows of a stored chunk that the snapshot does not see. Chunks that no transaction modified
+// are skipped (see MvccData).
+void remove_invisible_rows(const Chunk& chunk, const Snapshot& snapshot, PosList& pos_list);
+void remove_invisible_rows(const Chunk& chunk, const Snapshot& snapshot, ChunkPosList& chunk_pos_list);
+
 class TableScan : public AbstractOperator {
  public:
   TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
             const AllTypeVariant search_value);
 
+  // Creates a scan whose search value is a placeholder. It is bound by set_parameters before every execution, so that
+  // the same scan can answer a query with different search values (see AbstractOperator::reset).
+  TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+            const ParameterID parameter_id);
+
   ~TableScan() override = default;
 
+  const std::string name() const override;
+
+  const std::string description() const override;
+
   ColumnID column_id() const;
 
   ScanType scan_type() const;
 
   const AllTypeVariant& search_value() const;
 
+  // returns the id of the placeholder for the search value, if there is one
+  const std::optional<ParameterID>& parameter_id() const;
+
+  // Chunks that are excluded from the scan, e.g., because they are covered by an IndexScan. The output contains no
+  // chunks for them.
+  void set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids);
+
+  // Adds a runtime filter (usually published by a JoinHash) on the given column. Rows whose value cannot pass the
+  // filter are removed from the output. Chunks whose dictionary has no value that passes the filter are not scanned.
+  void add_runtime_filter(const ColumnID column_id, const std::shared_ptr<const RuntimeFilter> runtime_filter);
+
+  // Returns the number of chunks that were not scanned because a Bloom filter ruled them out, i.e., either the filter
+  // of their segment ruled out the search value (only for OpEquals) or a runtime filter ruled out their dictionary.
+  // The output contains empty chunks for them.
+  size_t skipped_chunk_count() const;
+
+  // Creates the implementation that scans columns of the given type. Used by _on_execute and by Pipeline, which
+  // feeds chunks through several scans without materializing the tables in between.
+  std::unique_ptr<BaseTableScanImpl> create_impl(const DataType column_type) const;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+  void _on_reset() override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
   ColumnID _column_id;
   const ScanType _scan_type;
-  const AllTypeVariant _search_value;
+  AllTypeVariant _search_value;
+  const std::optional<ParameterID> _parameter_id;
+  bool _is_search_value_bound;
+  std::vector<ChunkID> _excluded_chunk_ids;
+  size_t _skipped_chunk_count = 0;
+
+  // created on the first execution and kept by reset
+  std::unique_ptr<BaseTableScanImpl> _impl;
+
+  using ColumnRuntimeFilter = std::pair<ColumnID, std::shared_ptr<const RuntimeFilter>>;
+  std::vector<ColumnRuntimeFilter> _runtime_filters;
 
   template <typename T>
   class TableScanImpl : public BaseTableScanImpl {
    public:
-    TableScanImpl(const std::shared_ptr<const Table> table, ColumnID column_id, const ScanType scan_type,
-                  const AllTypeVariant search_value);
+    TableScanImpl(ColumnID column_id, const ScanType scan_type, const AllTypeVariant search_value,
+                  const std::vector<ChunkID>& excluded_chunk_ids = {},
+                  const std::vector<ColumnRuntimeFilter>& runtime_filters = {});
 
-    std::shared_ptr<const Table> scan() override;
+    std::shared_ptr<const Table> scan(const std::shared_ptr<const Table>& table, const Snapshot& snapshot) override;
+
+    std::optional<Chunk> scan_chunk(const std::shared_ptr<const Table>& table, const Chunk& input_chunk,
+                                    const ChunkID chunk_id, const Snapshot& snapshot) override;
+
+    void set_search_value(const AllTypeVariant& search_value) override;
 
    protected:
-    const std::shared_ptr<const Table> _table;
     const ColumnID _column_id;
     const ScanType _scan_type;
-    const T _search_value;
-    void _scan_reference_segment(const std::shared_ptr<ReferenceSegment> segment,
-                                 const std::shared_ptr<PosList> pos_list, const ChunkID chunk_id,
-                                 const std::function<bool(T, T)> comparator);
-    void _scan_value_segment(const std::shared_ptr<ValueSegment<T>> segment, const std::shared_ptr<PosList> pos_list,
-                             const ChunkID chunk_id, const std::function<bool(T, T)> comparator);
-    void _scan_dictionary_segment(const std::shared_ptr<DictionarySegment<T>> segment,
-                                  const std::shared_ptr<PosList> pos_list, const ChunkID chunk_id,
-                                  const std::function<bool(T, T)> comparator);
+    T _search_value;
+    const std::vector<ChunkID> _excluded_chunk_ids;
+    const std::vector<ColumnRuntimeFilter> _runtime_filters;
+
+    // Holds the PosLists and ReferenceSegments of the output. Every scan starts a new pool, which is kept alive by the
+    // output of the previous scan as long as that is in use.
+    std::shared_ptr<MemoryPool> _memory_pool = std::make_shared<MemoryPool>();
+
+    // returns true if a Bloom filter or a runtime filter shows that no row of the chunk qualifies
+    bool _is_pruned(const Chunk& chunk) const;
+
+    // Removes the positions whose values cannot pass the runtime filters, either positions in a chunk of
+    // ReferenceSegments or the chunk offsets of a stored chunk of the table.
+    void _apply_runtime_filters(const Chunk& chunk, std::vector<ChunkOffset>& positions) const;
+    void _apply_runtime_filters(const std::shared_ptr<const Table>& table,
+                                const std::shared_ptr<ChunkPosList>& chunk_pos_list) const;
+
+    // Appends the positions of the rows of the segment whose value fulfills the scan predicate. The matches in
+    // ReferenceSegments are added as their positions in the segment, those in other segments as chunk offsets.
+    void _scan_segment(const ReferenceSegment& segment, std::vector<ChunkOffset>& positions) const;
+    void _scan_segment(const BaseSegment& segment, ChunkPosList& chunk_pos_list) const;
   };
 };
 
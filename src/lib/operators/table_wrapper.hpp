@@ -16,6 +16,8 @@ class TableWrapper : public AbstractOperator {
  public:
   explicit TableWrapper(const std::shared_ptr<const Table> table);
 
+  const std::string name() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -12,6 +12,8 @@
 #include "all_type_variant.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/value_segment.hpp"
 
 namespace opossum {
@@ -19,10 +21,10 @@ namespace opossum {
 namespace hana = boost::hana;
 
 /**
- * Resolves a type string by creating an instance of a templated class and
+ * Resolves a DataType by creating an instance of a templated class and
  * returning it as a unique_ptr of its non-templated base class.
  *
- * @param type is a string representation of any of the supported data types
+ * @param data_type is any of the supported data types
  * @param args is a list of constructor arguments
  *
  *
@@ -42,14 +44,14 @@ namespace hana = boost::hana;
  *   };
  *
  *   constexpr auto var = 12;
- *   auto impl = make_unique_by_data_type<BaseImpl, Impl>("string", var);
+ *   auto impl = make_unique_by_data_type<BaseImpl, Impl>(DataType::String, var);
  *   impl->execute();
  */
 template <class Base, template <typename...> class Impl, class... TemplateArgs, typename... ConstructorArgs>
-std::unique_ptr<Base> make_unique_by_data_type(const std::string& type, ConstructorArgs&&... args) {
+std::unique_ptr<Base> make_unique_by_data_type(const DataType data_type, ConstructorArgs&&... args) {
   std::unique_ptr<Base> ret = nullptr;
   hana::for_each(data_types, [&](auto x) {
-    if (std::string(hana::first(x)) == type) {
+    if (hana::first(x) == data_type) {
       // The + before hana::second - which returns a reference - converts its return value
       // into a value so that we can access ::type
       using DataType = typename decltype(+hana::second(x))::type;
@@ -57,7 +59,7 @@ std::unique_ptr<Base> make_unique_by_data_type(const std::string& type, Construc
       return;
     }
   });
-  DebugAssert(static_cast<bool>(ret), "unknown type " + type);
+  DebugAssert(static_cast<bool>(ret), "unknown type " + data_type_to_string(data_type));
   return ret;
 }
 
@@ -65,14 +67,15 @@ std::unique_ptr<Base> make_unique_by_data_type(const std::string& type, Construc
  * Convenience function. Calls make_unique_by_data_type and casts the result into a shared_ptr.
  */
 template <class Base, template <typename...> class impl, class... TemplateArgs, class... ConstructorArgs>
-std::shared_ptr<Base> make_shared_by_data_type(const std::string& type, ConstructorArgs&&... args) {
-  return make_unique_by_data_type<Base, impl, TemplateArgs...>(type, std::forward<ConstructorArgs>(args)...);
+std::shared_ptr<Base> make_shared_by_data_type(const DataType data_type, ConstructorArgs&&... args) {
+  return make_unique_by_data_type<Base, impl, TemplateArgs...>(data_type, std::forward<ConstructorArgs>(args)...);
 }
 
 /**
- * Resolves a type string by passing a hana::type object on to a generic lambda
+ * Resolves a DataType by passing a hana::type object on to a generic lambda. The comparisons of the unrolled loop
+ * over all data types are against constants, which the compiler turns into a jump table.
  *
- * @param type_string is a string representation of any of the supported data types
+ * @param data_type is any of the supported data types
  * @param func is a generic lambda or similar accepting a hana::type object
  *
  *
@@ -110,7 +113,7 @@ std::shared_ptr<Base> make_shared_by_data_type(const std::string& type, Construc
  *   template <typename T>
  *   process_type(hana::basic_type<T> type);  // note: parameter type needs to be hana::basic_type not hana::type!
  *
- *   resolve_data_type(type_string, [&](auto type) {
+ *   resolve_data_type(data_type, [&](auto type) {
  *     using Type = typename decltype(type)::type;
  *     const auto var = type_cast<Type>(variant_from_elsewhere);
  *     process_variant(var);
@@ -119,9 +122,9 @@ std::shared_ptr<Base> make_shared_by_data_type(const std::string& type, Construc
  *   });
  */
 template <typename Functor>
-void resolve_data_type(const std::string& type_string, const Functor& func) {
+void resolve_data_type(const DataType data_type, const Functor& func) {
   hana::for_each(data_types, [&](auto x) {
-    if (std::string(hana::first(x)) == type_string) {
+    if (hana::first(x) == data_type) {
       // The + before hana::second - which returns a reference - converts its return value into a value
       func(+hana::second(x));
       return;
@@ -129,4 +132,52 @@ void resolve_data_type(const std::string& type_string, const Functor& func) {
   });
 }
 
+/**
+ * Resolves the data type of a ValueSegment or DictionarySegment by probing the segment for each of the supported data
+ * types and passes the matching hana::type object on to a generic lambda (see resolve_data_type).
+ *
+ * This is meant for places where no DataType is at hand, e.g., when an index is created on a given segment. Since
+ * it may take one dynamic_cast per data type, do not use it in a loop over rows.
+ */
+template <typename Functor>
+void resolve_data_type_of_segment(const BaseSegment& segment, const Functor& func) {
+  auto resolved = false;
+  hana::for_each(types, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    if (resolved) return;
+    if (dynamic_cast<const ValueSegment<Type>*>(&segment) || dynamic_cast<const DictionarySegment<Type>*>(&segment)) {
+      resolved = true;
+      func(type);
+    }
+  });
+  Assert(resolved, "Cannot resolve the data type of this segment type");
+}
+
+/**
+ * Resolves the encoding of a segment of data type T and passes the segment on to a generic lambda as a
+ * const ValueSegment<T>&, const DictionarySegment<T>&, or const ReferenceSegment&. The lambda is instantiated for each
+ * of them, so that the code inside works on the concrete segment type (see segment_iterables.hpp).
+ *
+ * Only call it once per segment, not per row, as it takes up to one dynamic_cast per encoding.
+ *
+ * Example:
+ *
+ *   resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+ *     using SegmentType = std::decay_t<decltype(typed_segment)>;
+ *     if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) { ... }
+ *   });
+ */
+template <typename T, typename Functor>
+void resolve_segment_type(const BaseSegment& segment, const Functor& func) {
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    func(*value_segment);
+  } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    func(*dictionary_segment);
+  } else if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    func(*reference_segment);
+  } else {
+    Fail("Cannot resolve the type of this segment");
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,119 @@
+#include "abstract_task.hpp"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "current_scheduler.hpp"
+#include "node_queue_scheduler.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void AbstractTask::set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor) {
+  DebugAssert(!_is_scheduled && !successor->_is_scheduled, "Dependencies must be set before scheduling");
+  _successors.push_back(successor);
+  ++successor->_pending_predecessor_count;
+}
+
+const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() const { return _successors; }
+
+bool AbstractTask::is_ready() const { return _pending_predecessor_count == 0; }
+
+bool AbstractTask::is_done() const {
+  std::lock_guard<std::mutex> lock(_done_mutex);
+  return _is_done;
+}
+
+void AbstractTask::schedule(const NodeID preferred_node_id) {
+  _scheduler = CurrentScheduler::get();
+  _preferred_node_id = preferred_node_id;
+
+  const auto was_scheduled = _is_scheduled.exchange(true);
+  Assert(!was_scheduled, "Task was scheduled twice");
+
+  _try_enqueue();
+}
+
+void AbstractTask::execute() {
+  DebugAssert(is_ready(), "Task was executed before its predecessors were done");
+
+  // A task whose input failed cannot run, it passes the exception of its predecessor on instead
+  auto exception = std::exception_ptr{};
+  {
+    std::lock_guard<std::mutex> lock(_done_mutex);
+    exception = _exception;
+  }
+
+  if (!exception) {
+    try {
+      _on_execute();
+    } catch (...) {
+      exception = std::current_exception();
+    }
+  }
+
+  auto done_callbacks = std::vector<DoneCallback>{};
+  {
+    std::lock_guard<std::mutex> lock(_done_mutex);
+    _exception = exception;
+    _is_done = true;
+    done_callbacks = std::move(_done_callbacks);
+  }
+  _done_condition.notify_all();
+
+  for (const auto& callback : done_callbacks) callback(exception);
+
+  for (const auto& successor : _successors) {
+    successor->_on_predecessor_done(exception);
+  }
+}
+
+void AbstractTask::join() {
+  {
+    std::unique_lock<std::mutex> lock(_done_mutex);
+    _done_condition.wait(lock, [&]() { return _is_done; });
+  }
+
+  if (_exception) std::rethrow_exception(_exception);
+}
+
+void AbstractTask::add_done_callback(DoneCallback callback) {
+  {
+    std::lock_guard<std::mutex> lock(_done_mutex);
+    if (!_is_done) {
+      _done_callbacks.push_back(std::move(callback));
+      return;
+    }
+  }
+  callback(_exception);
+}
+
+void AbstractTask::_on_predecessor_done(const std::exception_ptr& exception) {
+  if (exception) {
+    // several predecessors may fail concurrently, the first exception is kept
+    std::lock_guard<std::mutex> lock(_done_mutex);
+    if (!_exception) _exception = exception;
+  }
+
+  --_pending_predecessor_count;
+  _try_enqueue();
+}
+
+void AbstractTask::_try_enqueue() {
+  // Scheduling the task and finishing its last predecessor may happen concurrently, so both sides may get here. Only
+  // the first one to see the task scheduled and ready enqueues it.
+  if (!_is_scheduled || !is_ready()) return;
+  if (_is_enqueued.exchange(true)) return;
+
+  // the task does not need the scheduler afterwards, and queued tasks should not keep it alive
+  const auto scheduler = std::move(_scheduler);
+  if (scheduler) {
+    scheduler->schedule(shared_from_this(), _preferred_node_id);
+  } else {
+    execute();
+  }
+}
+
+}  // namespace opossum
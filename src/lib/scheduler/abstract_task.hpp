@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class NodeQueueScheduler;
+
+// Tasks scheduled with this node id are put into the queue of the node of the scheduling worker or, if they are
+// scheduled from outside the scheduler, distributed round-robin
+constexpr NodeID CURRENT_NODE_ID = std::numeric_limits<NodeID>::max();
+
+// AbstractTask is the super class of all units of work that the scheduler runs. Tasks form a DAG: a task becomes
+// ready once all of its predecessors are done, and only ready tasks are handed to the workers.
+//
+// If no scheduler is set (see CurrentScheduler), scheduled tasks are executed in the calling thread as soon as they
+// are ready, so that code using tasks also works single-threaded.
+class AbstractTask : public std::enable_shared_from_this<AbstractTask>, private Noncopyable {
+ public:
+  // receives the exception that the task failed with or nullptr
+  using DoneCallback = std::function<void(const std::exception_ptr&)>;
+
+  AbstractTask() = default;
+  virtual ~AbstractTask() = default;
+
+  // makes successor wait for this task. Both tasks must not be scheduled yet.
+  void set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor);
+
+  const std::vector<std::shared_ptr<AbstractTask>>& successors() const;
+
+  // returns whether all predecessors are done
+  bool is_ready() const;
+
+  bool is_done() const;
+
+  // Hands the task over to the current scheduler, which executes it once it is ready. A task is scheduled only once.
+  void schedule(const NodeID preferred_node_id = CURRENT_NODE_ID);
+
+  // Runs the task in the calling thread, which is what the workers do. The task has to be ready. If a predecessor
+  // failed, the task is not run but fails with the exception of that predecessor.
+  void execute();
+
+  // blocks until the task is done and rethrows the exception it failed with, if any
+  void join();
+
+  // Registers a continuation that is called by the thread that finishes the task, before the successors are
+  // notified. If the task is already done, the callback is called right away. Callbacks must not throw.
+  void add_done_callback(DoneCallback callback);
+
+ protected:
+  virtual void _on_execute() = 0;
+
+  // receives the exception that the predecessor failed with (or forwarded) or nullptr
+  void _on_predecessor_done(const std::exception_ptr& exception);
+
+  // enqueues (or, without a scheduler, executes) the task once it is both scheduled and ready
+  void _try_enqueue();
+
+  std::vector<std::shared_ptr<AbstractTask>> _successors;
+  std::atomic<uint32_t> _pending_predecessor_count{0};
+
+  std::shared_ptr<NodeQueueScheduler> _scheduler;
+  NodeID _preferred_node_id = CURRENT_NODE_ID;
+  std::atomic_bool _is_scheduled{false};
+  std::atomic_bool _is_enqueued{false};
+
+  mutable std::mutex _done_mutex;
+  std::condition_variable _done_condition;
+  bool _is_done = false;
+  std::exception_ptr _exception;
+  std::vector<DoneCallback> _done_callbacks;
+};
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#include "current_scheduler.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "node_queue_scheduler.hpp"
+
+namespace opossum {
+
+std::shared_ptr<NodeQueueScheduler> CurrentScheduler::_instance;
+
+const std::shared_ptr<NodeQueueScheduler>& CurrentScheduler::get() { return _instance; }
+
+void CurrentScheduler::set(const std::shared_ptr<NodeQueueScheduler>& scheduler) {
+  if (_instance) _instance->finish();
+  _instance = scheduler;
+  if (_instance) _instance->begin();
+}
+
+bool CurrentScheduler::is_set() { return _instance != nullptr; }
+
+void CurrentScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  for (const auto& task : tasks) task->schedule();
+  for (const auto& task : tasks) task->join();
+}
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class NodeQueueScheduler;
+
+// CurrentScheduler holds the scheduler that AbstractTask::schedule hands tasks to. No scheduler is set by default,
+// in which case tasks run in the thread that schedules them.
+class CurrentScheduler {
+ public:
+  static const std::shared_ptr<NodeQueueScheduler>& get();
+
+  // replaces the current scheduler, which is finished first, and starts the new one (if not nullptr)
+  static void set(const std::shared_ptr<NodeQueueScheduler>& scheduler);
+
+  static bool is_set();
+
+  // schedules all tasks and blocks until they are done. Rethrows the first exception that one of the tasks failed with.
+  static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+ protected:
+  static std::shared_ptr<NodeQueueScheduler> _instance;
+};
+
+}  // namespace opossum
@@ -0,0 +1,12 @@
+#include "job_task.hpp"
+
+#include <functional>
+#include <utility>
+
+namespace opossum {
+
+JobTask::JobTask(std::function<void()> function) : _function(std::move(function)) {}
+
+void JobTask::_on_execute() { _function(); }
+
+}  // namespace opossum
@@ -0,0 +1,122 @@
+#include "node_queue_scheduler.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "task_queue.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the node of the worker running in this thread, CURRENT_NODE_ID outside of workers
+thread_local NodeID current_worker_node_id = CURRENT_NODE_ID;
+
+// Idle workers wake up this often to look for tasks that they can steal from other nodes
+constexpr auto IDLE_TIMEOUT = std::chrono::microseconds{500};
+
+}  // namespace
+
+NodeQueueScheduler::NodeQueueScheduler(const Topology& topology) : _topology(topology) {
+  for (const auto& node : _topology.nodes()) {
+    _queues.push_back(std::make_shared<TaskQueue>(node.node_id));
+  }
+}
+
+NodeQueueScheduler::~NodeQueueScheduler() {
+  if (_is_active) finish();
+}
+
+void NodeQueueScheduler::begin() {
+  DebugAssert(!_is_active, "Scheduler was already started");
+  _is_active = true;
+  _shutdown_requested = false;
+
+  for (const auto& node : _topology.nodes()) {
+    for (const auto& cpu_id : node.cpu_ids) {
+      _workers.emplace_back(&NodeQueueScheduler::_work, this, node.node_id, cpu_id);
+    }
+  }
+}
+
+void NodeQueueScheduler::finish() {
+  DebugAssert(_is_active, "Scheduler was not started");
+
+  while (_unfinished_task_count > 0) {
+    std::this_thread::sleep_for(IDLE_TIMEOUT);
+  }
+
+  _shutdown_requested = true;
+  for (const auto& queue : _queues) queue->notify_all();
+  for (auto& worker : _workers) worker.join();
+
+  _workers.clear();
+  _is_active = false;
+}
+
+void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, const NodeID preferred_node_id) {
+  DebugAssert(_is_active, "Scheduler was not started");
+  DebugAssert(task->is_ready(), "Only ready tasks can be enqueued");
+
+  auto node_id = preferred_node_id;
+  if (node_id == CURRENT_NODE_ID) node_id = current_worker_node_id;
+  if (node_id == CURRENT_NODE_ID) node_id = _next_node_id++ % _queues.size();
+  DebugAssert(node_id < _queues.size(), "Invalid node id");
+
+  ++_unfinished_task_count;
+  _queues[node_id]->push(std::move(task));
+}
+
+const Topology& NodeQueueScheduler::topology() const { return _topology; }
+
+const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
+
+size_t NodeQueueScheduler::stolen_task_count() const { return _stolen_task_count; }
+
+void NodeQueueScheduler::_work(const NodeID node_id, const CpuID cpu_id) {
+  current_worker_node_id = node_id;
+
+  if (_topology.pins_workers()) {
+    // Pinning is an optimization only, so failures (e.g., because of a restricted CPU set) are ignored
+    auto cpu_set = cpu_set_t{};
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu_id, &cpu_set);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set);
+  }
+
+  auto& queue = *_queues[node_id];
+  while (!_shutdown_requested) {
+    const auto task = _next_task(node_id);
+    if (!task) {
+      queue.wait_for_task(IDLE_TIMEOUT);
+      continue;
+    }
+
+    task->execute();
+    --_unfinished_task_count;
+  }
+}
+
+std::shared_ptr<AbstractTask> NodeQueueScheduler::_next_task(const NodeID node_id) {
+  if (auto task = _queues[node_id]->pull()) return task;
+
+  // Other nodes are visited starting with the next one, so that the stealing load spreads evenly
+  for (auto offset = size_t{1}; offset < _queues.size(); ++offset) {
+    if (auto task = _queues[(node_id + offset) % _queues.size()]->steal()) {
+      ++_stolen_task_count;
+      return task;
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace opossum
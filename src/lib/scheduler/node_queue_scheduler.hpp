@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "topology.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class TaskQueue;
+
+// The NodeQueueScheduler runs tasks on a pool of workers, one per CPU of the topology. Every NUMA node has its own
+// TaskQueue, which its workers pull from. Workers that run out of local tasks steal from the queues of other nodes
+// before going idle, so that a node with few tasks does not leave its CPUs unused.
+//
+// Tasks are usually not scheduled here directly, but by AbstractTask::schedule with this set as the CurrentScheduler.
+class NodeQueueScheduler : private Noncopyable {
+ public:
+  explicit NodeQueueScheduler(const Topology& topology = Topology::from_system());
+
+  // finishes the scheduler if that did not happen yet
+  ~NodeQueueScheduler();
+
+  // starts the workers
+  void begin();
+
+  // waits until all scheduled tasks are done, then stops the workers
+  void finish();
+
+  // Enqueues a ready task into the queue of the given node. CURRENT_NODE_ID refers to the node of the calling worker;
+  // tasks scheduled from other threads are distributed round-robin.
+  void schedule(std::shared_ptr<AbstractTask> task, const NodeID preferred_node_id);
+
+  const Topology& topology() const;
+
+  const std::vector<std::shared_ptr<TaskQueue>>& queues() const;
+
+  // returns the number of tasks that were taken from the queue of another node
+  size_t stolen_task_count() const;
+
+ protected:
+  void _work(const NodeID node_id, const CpuID cpu_id);
+
+  // returns a task of the worker's own node or, if there is none, one stolen from another node, or nullptr
+  std::shared_ptr<AbstractTask> _next_task(const NodeID node_id);
+
+  const Topology _topology;
+  std::vector<std::shared_ptr<TaskQueue>> _queues;
+  std::vector<std::thread> _workers;
+
+  std::atomic_bool _is_active{false};
+  std::atomic_bool _shutdown_requested{false};
+  std::atomic<size_t> _unfinished_task_count{0};
+  std::atomic<size_t> _stolen_task_count{0};
+  std::atomic<NodeID> _next_node_id{0};
+};
+
+}  // namespace opossum
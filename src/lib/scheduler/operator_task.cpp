@@ -0,0 +1,53 @@
+#include "operator_task.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::shared_ptr<OperatorTask> add_operator_tasks(
+    const std::shared_ptr<AbstractOperator>& op,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<OperatorTask>>& task_by_operator,
+    std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  const auto task_iter = task_by_operator.find(op.get());
+  if (task_iter != task_by_operator.cend()) return task_iter->second;
+
+  const auto task = std::make_shared<OperatorTask>(op);
+  for (const auto& input : {op->input_left(), op->input_right()}) {
+    if (!input || input->executed()) continue;
+
+    // Operators only hold their inputs as const, since they must not modify them. Executing them is what the
+    // tasks are for, though.
+    const auto input_task =
+        add_operator_tasks(std::const_pointer_cast<AbstractOperator>(input), task_by_operator, tasks);
+    input_task->set_as_predecessor_of(task);
+  }
+
+  task_by_operator.emplace(op.get(), task);
+  tasks.push_back(task);
+  return task;
+}
+
+}  // namespace
+
+OperatorTask::OperatorTask(std::shared_ptr<AbstractOperator> op) : _operator(std::move(op)) {}
+
+std::vector<std::shared_ptr<AbstractTask>> OperatorTask::make_tasks_from_operator(
+    const std::shared_ptr<AbstractOperator>& op) {
+  auto task_by_operator = std::unordered_map<const AbstractOperator*, std::shared_ptr<OperatorTask>>{};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  add_operator_tasks(op, task_by_operator, tasks);
+  return tasks;
+}
+
+const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _operator; }
+
+void OperatorTask::_on_execute() { _operator->execute(); }
+
+}  // namespace opossum
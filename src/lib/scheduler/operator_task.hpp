@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+// OperatorTask executes a single operator. The tasks of an operator tree depend on each other like the operators
+// do on their inputs, so that independent subtrees (e.g., both sides of a join) run in parallel.
+class OperatorTask : public AbstractTask {
+ public:
+  explicit OperatorTask(std::shared_ptr<AbstractOperator> op);
+
+  // Creates tasks for the given operator and all of its (transitive) inputs that were not executed yet. Inputs that
+  // are shared by several operators get a single task. The tasks are returned in topological order, i.e., the task
+  // of the given operator comes last.
+  static std::vector<std::shared_ptr<AbstractTask>> make_tasks_from_operator(
+      const std::shared_ptr<AbstractOperator>& op);
+
+  const std::shared_ptr<AbstractOperator>& get_operator() const;
+
+ protected:
+  void _on_execute() override;
+
+  const std::shared_ptr<AbstractOperator> _operator;
+};
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#include "task_queue.hpp"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+TaskQueue::TaskQueue(const NodeID node_id) : _node_id(node_id) {}
+
+NodeID TaskQueue::node_id() const { return _node_id; }
+
+void TaskQueue::push(std::shared_ptr<AbstractTask> task) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tasks.push_back(std::move(task));
+  }
+  _condition.notify_one();
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::pull() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_tasks.empty()) return nullptr;
+
+  auto task = std::move(_tasks.front());
+  _tasks.pop_front();
+  return task;
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::steal() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_tasks.empty()) return nullptr;
+
+  auto task = std::move(_tasks.back());
+  _tasks.pop_back();
+  return task;
+}
+
+bool TaskQueue::empty() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _tasks.empty();
+}
+
+void TaskQueue::wait_for_task(const std::chrono::microseconds timeout) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  if (!_tasks.empty()) return;
+  _condition.wait_for(lock, timeout);
+}
+
+void TaskQueue::notify_all() {
+  // taking the lock ensures that no worker is between checking the queue and starting to wait
+  { std::lock_guard<std::mutex> lock(_mutex); }
+  _condition.notify_all();
+}
+
+}  // namespace opossum
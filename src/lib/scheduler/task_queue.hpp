@@ -0,0 +1,45 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+// TaskQueue holds the ready tasks of one NUMA node. The workers of the node pull tasks from its front, while idle
+// workers of other nodes steal from its back, so that they take the tasks which the local workers would reach last.
+class TaskQueue : private Noncopyable {
+ public:
+  explicit TaskQueue(const NodeID node_id);
+
+  NodeID node_id() const;
+
+  void push(std::shared_ptr<AbstractTask> task);
+
+  // returns the oldest task or nullptr if the queue is empty
+  std::shared_ptr<AbstractTask> pull();
+
+  // returns the newest task or nullptr if the queue is empty
+  std::shared_ptr<AbstractTask> steal();
+
+  bool empty() const;
+
+  // blocks until a task is pushed, notify_all is called or the timeout expires
+  void wait_for_task(const std::chrono::microseconds timeout);
+
+  void notify_all();
+
+ protected:
+  const NodeID _node_id;
+  mutable std::mutex _mutex;
+  std::condition_variable _condition;
+  std::deque<std::shared_ptr<AbstractTask>> _tasks;
+};
+
+}  // namespace opossum
@@ -0,0 +1,85 @@
+#include "topology.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Topology::Topology(std::vector<TopologyNode> nodes, const bool pins_workers)
+    : _nodes(std::move(nodes)), _pins_workers(pins_workers) {
+  Assert(!_nodes.empty(), "A topology needs at least one node");
+}
+
+Topology Topology::from_system() {
+  auto nodes = std::vector<TopologyNode>{};
+
+  // Node ids are contiguous on all machines we know of, so we stop at the first missing node
+  for (auto node_id = NodeID{0};; ++node_id) {
+    auto cpu_list_file = std::ifstream{"/sys/devices/system/node/node" + std::to_string(node_id) + "/cpulist"};
+    if (!cpu_list_file) break;
+
+    auto cpu_list = std::string{};
+    std::getline(cpu_list_file, cpu_list);
+    auto cpu_ids = parse_cpu_list(cpu_list);
+    // nodes without CPUs (e.g., memory-only nodes) cannot run workers
+    if (cpu_ids.empty()) continue;
+
+    nodes.push_back({static_cast<NodeID>(nodes.size()), std::move(cpu_ids)});
+  }
+
+  if (nodes.empty()) {
+    auto topology = fake(1, std::max(std::thread::hardware_concurrency(), 1u));
+    topology._pins_workers = true;
+    return topology;
+  }
+
+  return Topology{std::move(nodes), true};
+}
+
+Topology Topology::fake(const uint32_t node_count, const uint32_t cpus_per_node) {
+  auto nodes = std::vector<TopologyNode>(node_count);
+  for (auto node_id = NodeID{0}; node_id < node_count; ++node_id) {
+    nodes[node_id].node_id = node_id;
+    for (auto cpu_index = uint32_t{0}; cpu_index < cpus_per_node; ++cpu_index) {
+      nodes[node_id].cpu_ids.push_back(node_id * cpus_per_node + cpu_index);
+    }
+  }
+  return Topology{std::move(nodes), false};
+}
+
+std::vector<CpuID> Topology::parse_cpu_list(const std::string& cpu_list) {
+  auto cpu_ids = std::vector<CpuID>{};
+  auto stream = std::stringstream{cpu_list};
+  auto range = std::string{};
+
+  while (std::getline(stream, range, ',')) {
+    if (range.empty() || range == "\n") continue;
+
+    const auto dash = range.find('-');
+    const auto first = static_cast<CpuID>(std::stoul(range.substr(0, dash)));
+    const auto last = dash == std::string::npos ? first : static_cast<CpuID>(std::stoul(range.substr(dash + 1)));
+    Assert(first <= last, "Invalid CPU range " + range);
+
+    for (auto cpu_id = first; cpu_id <= last; ++cpu_id) cpu_ids.push_back(cpu_id);
+  }
+
+  return cpu_ids;
+}
+
+const std::vector<TopologyNode>& Topology::nodes() const { return _nodes; }
+
+size_t Topology::cpu_count() const {
+  auto cpu_count = size_t{0};
+  for (const auto& node : _nodes) cpu_count += node.cpu_ids.size();
+  return cpu_count;
+}
+
+bool Topology::pins_workers() const { return _pins_workers; }
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+struct TopologyNode {
+  NodeID node_id;
+  std::vector<CpuID> cpu_ids;
+};
+
+// The Topology describes the NUMA nodes of the machine and the CPUs that belong to them. The NodeQueueScheduler starts
+// one worker per CPU and gives every node its own task queue, so that tasks preferably run close to their data.
+class Topology {
+ public:
+  // Reads the NUMA nodes from /sys/devices/system/node. Machines without NUMA information are treated as a single node
+  // holding all hardware threads.
+  static Topology from_system();
+
+  // Creates a topology of node_count nodes with cpus_per_node CPUs each. The CPU ids do not have to exist, so workers
+  // of a fake topology are not pinned. Used for tests.
+  static Topology fake(const uint32_t node_count, const uint32_t cpus_per_node);
+
+  // parses a CPU list as found in /sys, e.g., "0-3,8,10-11"
+  static std::vector<CpuID> parse_cpu_list(const std::string& cpu_list);
+
+  const std::vector<TopologyNode>& nodes() const;
+
+  size_t cpu_count() const;
+
+  // returns whether workers should be pinned to their CPUs
+  bool pins_workers() const;
+
+ protected:
+  Topology(std::vector<TopologyNode> nodes, const bool pins_workers);
+
+  std::vector<TopologyNode> _nodes;
+  bool _pins_workers;
+};
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "types.hpp"
 
 namespace opossum {
@@ -31,5 +33,8 @@ class BaseAttributeVector : private Noncopyable {
   virtual void reserve(size_t row_count) = 0;
 
   virtual void append(const ValueID value_id) = 0;
+
+  // returns how often each ValueID in [0, value_id_count) occurs, without decoding any value
+  virtual std::vector<size_t> value_id_counts(const size_t value_id_count) const = 0;
 };
 }  // namespace opossum
@@ -28,5 +28,9 @@ class BaseSegment : private Noncopyable {
 
   // returns the number of values
   virtual size_t size() const = 0;
+
+  // Returns the number of bytes occupied by the segment. Memory shared with other segments (e.g., the pos list of a
+  // ReferenceSegment) is included, and heap memory owned by values (e.g., long strings) is not.
+  virtual size_t memory_consumption() const = 0;
 };
 }  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BaseValueSegment is the non-templated super class of ValueSegment. It allows Chunk to let concurrent writers fill
+// a segment without knowing its data type.
+class BaseValueSegment : public BaseSegment {
+ public:
+  // Allocates storage for capacity values up front, so that it is never reallocated. Afterwards, the segment holds the
+  // first *size values only. size is shared by all segments of a chunk, so that a row becomes visible in all columns
+  // at once, and is increased by the chunk once the values of a row are written. append cannot be used anymore.
+  virtual void preallocate(ChunkOffset capacity, std::shared_ptr<const std::atomic<ChunkOffset>> size) = 0;
+
+  // Returns a preallocated segment with storage for capacity values that holds the first size values of this
+  // preallocated segment, which have to be visible.
+  virtual std::shared_ptr<BaseValueSegment> copy_preallocated(
+      ChunkOffset capacity, std::shared_ptr<const std::atomic<ChunkOffset>> size) const = 0;
+
+  // writes a value into the preallocated storage at a position that is not yet visible
+  virtual void write(ChunkOffset chunk_offset, const AllTypeVariant& value) = 0;
+
+  // returns the value converted to the data type of the segment, throws if it cannot be converted
+  virtual AllTypeVariant convert(const AllTypeVariant& value) const = 0;
+};
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BloomFilter::BloomFilter(const size_t value_count, const size_t bits_per_value) {
+  Assert(bits_per_value > 0, "A Bloom filter needs at least one bit per value");
+
+  // Round up to whole 64 bit words. Empty segments still get one word, so that lookups need no special case.
+  const auto word_count = std::max(size_t{1}, (value_count * bits_per_value + 63) / 64);
+  _words.resize(word_count, 0u);
+  _bit_count = word_count * 64;
+
+  // k = b * ln(2) minimizes the false positive rate
+  _hash_function_count = std::clamp(static_cast<size_t>(std::lround(bits_per_value * std::log(2.0))), size_t{1},
+                                    size_t{16});
+}
+
+size_t BloomFilter::bit_count() const { return _bit_count; }
+
+size_t BloomFilter::hash_function_count() const { return _hash_function_count; }
+
+size_t BloomFilter::memory_consumption() const { return _words.size() * sizeof(uint64_t); }
+
+uint64_t BloomFilter::_mix(uint64_t hash) {
+  // finalizer of splitmix64
+  hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+  hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+  return hash ^ (hash >> 31);
+}
+
+// The k bit positions are derived from two halves of one hash (Kirsch and Mitzenmacher, "Less Hashing, Same
+// Performance", ESA 2006), so that every value is hashed only once
+void BloomFilter::insert_hash(const uint64_t hash) {
+  const auto step = (hash >> 32) | 1u;
+  auto position = hash & 0xFFFFFFFFu;
+  for (size_t hash_function = 0; hash_function < _hash_function_count; ++hash_function) {
+    const auto bit = position % _bit_count;
+    _words[bit / 64] |= uint64_t{1} << (bit % 64);
+    position += step;
+  }
+}
+
+bool BloomFilter::may_contain_hash(const uint64_t hash) const {
+  const auto step = (hash >> 32) | 1u;
+  auto position = hash & 0xFFFFFFFFu;
+  for (size_t hash_function = 0; hash_function < _hash_function_count; ++hash_function) {
+    const auto bit = position % _bit_count;
+    if ((_words[bit / 64] & (uint64_t{1} << (bit % 64))) == 0) return false;
+    position += step;
+  }
+  return true;
+}
+
+}  // namespace opossum
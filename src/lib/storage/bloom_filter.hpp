@@ -0,0 +1,60 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A Bloom filter summarizes the values of a segment in a few bits per value. may_contain never returns false for a
+// value that was inserted, but may return true for values that were not (false positive). With k hash functions and
+// b bits per value, the false positive rate is about (1 - e^(-k / b))^k, e.g., 1% for b = 10 and k = 7.
+//
+// Unlike min/max statistics, this also prunes equality predicates on high-cardinality columns such as IDs.
+class BloomFilter : private Noncopyable {
+ public:
+  // creates an empty filter sized for value_count distinct values with the given number of bits per value
+  BloomFilter(const size_t value_count, const size_t bits_per_value);
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BloomFilter(BloomFilter&&) = default;
+  BloomFilter& operator=(BloomFilter&&) = default;
+
+  template <typename T>
+  void insert(const T& value) {
+    insert_hash(hash(value));
+  }
+
+  template <typename T>
+  bool may_contain(const T& value) const {
+    return may_contain_hash(hash(value));
+  }
+
+  // Probing is split into hashing and testing, so that callers can hash a whole batch of values in a tight loop
+  // that the compiler can vectorize before they test the hashes.
+  // std::hash is the identity for integers in some standard libraries, so its result is mixed before use.
+  template <typename T>
+  static uint64_t hash(const T& value) {
+    return _mix(std::hash<T>{}(value));
+  }
+
+  void insert_hash(const uint64_t hash);
+  bool may_contain_hash(const uint64_t hash) const;
+
+  size_t bit_count() const;
+
+  size_t hash_function_count() const;
+
+  size_t memory_consumption() const;
+
+ protected:
+  static uint64_t _mix(uint64_t hash);
+
+  std::vector<uint64_t> _words;
+  size_t _bit_count;
+  size_t _hash_function_count;
+};
+
+}  // namespace opossum
@@ -1,24 +1,46 @@
+#include <algorithm>
 #include <iomanip>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "base_value_segment.hpp"
+#include "bloom_filter.hpp"
 #include "chunk.hpp"
+#include "index/base_index.hpp"
+#include "mvcc_data.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) { _segments.push_back(segment); }
+void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) {
+  if (is_preallocated()) {
+    DebugAssert(size() == 0, "Cannot add a segment to a non-empty preallocated chunk");
+    const auto value_segment = std::dynamic_pointer_cast<BaseValueSegment>(segment);
+    Assert(value_segment, "Preallocated chunks can only hold ValueSegments");
+    value_segment->preallocate(_capacity, _visible_row_count);
+  }
+  _segments.push_back(segment);
+}
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
   DebugAssert(values.size() == column_count(), "Incorrect number of columns");
 
+  if (is_preallocated()) {
+    const auto row = convert_row(values);
+    const auto chunk_offset = reserve_row();
+    Assert(chunk_offset != INVALID_CHUNK_OFFSET, "Chunk is full");
+    write_row(chunk_offset, row);
+    return;
+  }
+
   auto value_iter = values.cbegin();
   std::for_each(_segments.begin(), _segments.end(),
                 [&value_iter](const auto& segment) { segment->append(*value_iter++); });
@@ -29,14 +51,153 @@ std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const { retu
 uint16_t Chunk::column_count() const { return static_cast<uint16_t>(_segments.size()); }
 
 uint32_t Chunk::size() const {
+  if (is_preallocated()) {
+    return _visible_row_count->load(std::memory_order_acquire);
+  }
   if (column_count() > 0) {
     return static_cast<uint32_t>(_segments[0]->size());
   }
   return 0;
 }
 
+void Chunk::preallocate(ChunkOffset capacity) {
+  DebugAssert(!is_preallocated() && size() == 0, "Only empty chunks can be preallocated");
+  _capacity = capacity;
+  _reserved_row_count = std::make_unique<std::atomic<ChunkOffset>>(0);
+  _visible_row_count = std::make_shared<std::atomic<ChunkOffset>>(0);
+
+  for (const auto& segment : _segments) {
+    const auto value_segment = std::dynamic_pointer_cast<BaseValueSegment>(segment);
+    Assert(value_segment, "Preallocated chunks can only hold ValueSegments");
+    value_segment->preallocate(_capacity, _visible_row_count);
+  }
+}
+
+bool Chunk::is_preallocated() const { return _visible_row_count != nullptr; }
+
+ChunkOffset Chunk::capacity() const {
+  DebugAssert(is_preallocated(), "Only preallocated chunks have a capacity");
+  return _capacity;
+}
+
+bool Chunk::is_mutable() const { return is_preallocated() && size() < _capacity; }
+
+std::shared_ptr<Chunk> Chunk::copy_with_capacity(ChunkOffset capacity) const {
+  DebugAssert(is_preallocated(), "Only preallocated chunks can be copied");
+  const auto row_count = size();
+  DebugAssert(row_count <= capacity && _reserved_row_count->load() >= _capacity,
+              "Rows do not fit or can still be reserved");
+
+  const auto chunk = std::make_shared<Chunk>();
+  chunk->_capacity = capacity;
+  chunk->_reserved_row_count = std::make_unique<std::atomic<ChunkOffset>>(row_count);
+  chunk->_visible_row_count = std::make_shared<std::atomic<ChunkOffset>>(row_count);
+
+  for (const auto& segment : _segments) {
+    chunk->_segments.push_back(
+        static_cast<const BaseValueSegment&>(*segment).copy_preallocated(capacity, chunk->_visible_row_count));
+  }
+  chunk->_mvcc_data = _mvcc_data;
+  return chunk;
+}
+
+ChunkOffset Chunk::reserve_row() {
+  DebugAssert(is_preallocated(), "Rows can only be reserved in preallocated chunks");
+
+  // Writers that find the chunk full still increase the counter, which is harmless as long as it does not overflow.
+  // Checking before incrementing would not help, since another writer could take the last row in between.
+  const auto chunk_offset = _reserved_row_count->fetch_add(1, std::memory_order_relaxed);
+  return chunk_offset < _capacity ? chunk_offset : INVALID_CHUNK_OFFSET;
+}
+
+ChunkOffset Chunk::stop_reservations() {
+  DebugAssert(is_preallocated(), "Rows can only be reserved in preallocated chunks");
+  return std::min(_reserved_row_count->exchange(_capacity, std::memory_order_relaxed), _capacity);
+}
+
+void Chunk::write_row(ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values) {
+  DebugAssert(values.size() == column_count(), "Incorrect number of columns");
+  DebugAssert(chunk_offset < _capacity, "Row was not reserved");
+
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    static_cast<BaseValueSegment&>(*_segments[column_id]).write(chunk_offset, values[column_id]);
+  }
+
+  // Rows are published in the order in which they were reserved. The writers of earlier rows are only busy with
+  // writing their values, so waiting for them is short.
+  auto expected_row_count = chunk_offset;
+  while (!_visible_row_count->compare_exchange_weak(expected_row_count, chunk_offset + 1, std::memory_order_release,
+                                                    std::memory_order_relaxed)) {
+    expected_row_count = chunk_offset;
+    std::this_thread::yield();
+  }
+}
+
+std::vector<AllTypeVariant> Chunk::convert_row(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() == column_count(), "Incorrect number of columns");
+
+  auto row = std::vector<AllTypeVariant>{};
+  row.reserve(values.size());
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    row.emplace_back(static_cast<const BaseValueSegment&>(*_segments[column_id]).convert(values[column_id]));
+  }
+  return row;
+}
+
 bool Chunk::compression_started() const { return _compression_started; }
 
 void Chunk::set_compression_start() { _compression_started = true; }
 
+void Chunk::add_index(const ColumnID column_id, std::shared_ptr<BaseIndex> index) {
+  DebugAssert(column_id < column_count(), "Cannot index a column that does not exist");
+  Assert(index->type() == SegmentIndexType::Cracker || !is_mutable(), "Cannot index a chunk that is still appended to");
+  std::unique_lock<std::shared_mutex> lock(*_indices_mutex);
+  _indices.emplace_back(column_id, std::move(index));
+}
+
+std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(const ColumnID column_id) const {
+  std::shared_lock<std::shared_mutex> lock(*_indices_mutex);
+  auto result = std::vector<std::shared_ptr<BaseIndex>>{};
+  for (const auto& [indexed_column_id, index] : _indices) {
+    if (indexed_column_id == column_id) result.push_back(index);
+  }
+  return result;
+}
+
+std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type, const ColumnID column_id) const {
+  std::shared_lock<std::shared_mutex> lock(*_indices_mutex);
+  const auto search_iter = std::find_if(_indices.cbegin(), _indices.cend(), [&](const auto& column_and_index) {
+    return column_and_index.first == column_id && column_and_index.second->type() == index_type;
+  });
+  if (search_iter == _indices.cend()) return nullptr;
+  return search_iter->second;
+}
+
+void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
+  std::unique_lock<std::shared_mutex> lock(*_indices_mutex);
+  const auto search_iter = std::find_if(_indices.cbegin(), _indices.cend(),
+                                        [&](const auto& column_and_index) { return column_and_index.second == index; });
+  DebugAssert(search_iter != _indices.cend(), "Index is not attached to this chunk");
+  _indices.erase(search_iter);
+}
+
+std::vector<std::pair<ColumnID, std::shared_ptr<BaseIndex>>> Chunk::indices() const {
+  std::shared_lock<std::shared_mutex> lock(*_indices_mutex);
+  return _indices;
+}
+
+void Chunk::set_bloom_filter(const ColumnID column_id, std::shared_ptr<const BloomFilter> bloom_filter) {
+  DebugAssert(column_id < column_count(), "Cannot add a Bloom filter to a column that does not exist");
+  _bloom_filters.resize(column_count());
+  _bloom_filters[column_id] = std::move(bloom_filter);
+}
+
+std::shared_ptr<const BloomFilter> Chunk::get_bloom_filter(const ColumnID column_id) const {
+  return static_cast<size_t>(column_id) < _bloom_filters.size() ? _bloom_filters[column_id] : nullptr;
+}
+
+void Chunk::set_mvcc_data(std::shared_ptr<MvccData> mvcc_data) { _mvcc_data = std::move(mvcc_data); }
+
+std::shared_ptr<MvccData> Chunk::mvcc_data() const { return _mvcc_data; }
+
 }  // namespace opossum
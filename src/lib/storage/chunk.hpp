@@ -6,15 +6,21 @@
 #include <atomic>
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+class BloomFilter;
+class CrackerIndex;
+class MvccData;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
@@ -39,9 +45,48 @@ class Chunk : private Noncopyable {
   uint32_t size() const;
 
   // adds a new row, given as a list of values, to the chunk
-  // note this is slow and not thread-safe and should be used for testing purposes only
+  // note this is slow and not thread-safe (unless the chunk is preallocated) and should be used for testing purposes
+  // only. Unless the chunk is preallocated, it must not be read while rows are appended, since the segments might
+  // reallocate their values and size() only looks at the first segment.
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Prepares an empty chunk of ValueSegments for concurrent writers: the segments, including those added later on,
+  // allocate storage for capacity rows. Writers reserve a row with reserve_row and fill it with write_row without
+  // taking a lock. This is what Table::append does.
+  void preallocate(ChunkOffset capacity);
+
+  bool is_preallocated() const;
+
+  // returns the number of rows that a preallocated chunk can hold
+  ChunkOffset capacity() const;
+
+  // Returns whether rows may still be added to the chunk, i.e., whether it is preallocated, but not full. Chunks that
+  // are not preallocated (e.g., compressed ones) are only appended to before they are added to a table.
+  bool is_mutable() const;
+
+  // Returns a preallocated chunk with the given capacity that holds the rows of this preallocated chunk and shares
+  // its MVCC columns. All reserved rows have to be written, and no further rows may be reserved (see
+  // stop_reservations). Indexes are not copied. Table::append uses this to grow a chunk without moving the rows that
+  // readers of this chunk access.
+  std::shared_ptr<Chunk> copy_with_capacity(ChunkOffset capacity) const;
+
+  // Reserves the next row of a preallocated chunk for the calling writer. Returns INVALID_CHUNK_OFFSET if the chunk
+  // is full.
+  ChunkOffset reserve_row();
+
+  // Makes reserve_row fail from now on and returns the number of rows that were reserved until then. Once size()
+  // reaches that number, all rows of the chunk are written. Must only be called once.
+  ChunkOffset stop_reservations();
+
+  // Writes the values into a row reserved with reserve_row. The row becomes visible (i.e., size() includes it) once
+  // the rows reserved before it are visible, so readers never see a row that is only partly written. Later rows wait
+  // for this one, so the values have to be converted (see convert_row) before the row is reserved: writing them must
+  // not fail.
+  void write_row(ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values);
+
+  // returns the values converted to the data types of the chunk's ValueSegments, throws if one cannot be converted
+  std::vector<AllTypeVariant> convert_row(const std::vector<AllTypeVariant>& values) const;
+
   // Returns the segment at a given position
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
@@ -49,9 +94,60 @@ class Chunk : private Noncopyable {
 
   void set_compression_start();
 
+  // Creates an index of the given type (e.g., GroupKeyIndex) on the segment of the given column and attaches it. An
+  // index only covers the rows that the segment holds when it is built, so the chunk must not be mutable anymore. Only
+  // a CrackerIndex, which takes care of values that are appended later on, can be created on a mutable chunk.
+  template <typename Index>
+  std::shared_ptr<BaseIndex> create_index(const ColumnID column_id) {
+    Assert(std::is_same_v<Index, CrackerIndex> || !is_mutable(), "Cannot index a chunk that is still appended to");
+    const auto index = std::make_shared<Index>(get_segment(column_id));
+    add_index(column_id, index);
+    return index;
+  }
+
+  // attaches an already built index on the segment of the given column, which has the same requirements as
+  // create_index
+  void add_index(const ColumnID column_id, std::shared_ptr<BaseIndex> index);
+
+  // returns all indexes on the given column
+  std::vector<std::shared_ptr<BaseIndex>> get_indices(const ColumnID column_id) const;
+
+  // returns the index of the given type on the given column or nullptr if there is none
+  std::shared_ptr<BaseIndex> get_index(const SegmentIndexType index_type, const ColumnID column_id) const;
+
+  void remove_index(const std::shared_ptr<BaseIndex>& index);
+
+  // returns all indexes of this chunk along with the column they cover
+  std::vector<std::pair<ColumnID, std::shared_ptr<BaseIndex>>> indices() const;
+
+  // attaches a Bloom filter over the values of the given column, which scans use to skip the chunk
+  void set_bloom_filter(const ColumnID column_id, std::shared_ptr<const BloomFilter> bloom_filter);
+
+  // returns the Bloom filter of the given column or nullptr if there is none
+  std::shared_ptr<const BloomFilter> get_bloom_filter(const ColumnID column_id) const;
+
+  // Attaches the MVCC columns of the chunk (see MvccData). Chunks without them, e.g., those of operator outputs, are
+  // visible to everyone.
+  void set_mvcc_data(std::shared_ptr<MvccData> mvcc_data);
+
+  // returns the MVCC columns of the chunk or nullptr if there are none
+  std::shared_ptr<MvccData> mvcc_data() const;
+
  protected:
   std::vector<std::shared_ptr<BaseSegment>> _segments;
+  std::vector<std::pair<ColumnID, std::shared_ptr<BaseIndex>>> _indices;
+
+  // Indexes are added while scans look them up (see Table::enable_cracking). The mutex is held by a pointer, so that
+  // the chunk stays movable.
+  std::unique_ptr<std::shared_mutex> _indices_mutex = std::make_unique<std::shared_mutex>();
+  std::vector<std::shared_ptr<const BloomFilter>> _bloom_filters;
   bool _compression_started = false;
+  std::shared_ptr<MvccData> _mvcc_data;
+
+  // only used by preallocated chunks. The atomics are held by pointers, so that the chunk stays movable.
+  ChunkOffset _capacity = 0;
+  std::unique_ptr<std::atomic<ChunkOffset>> _reserved_row_count;
+  std::shared_ptr<std::atomic<ChunkOffset>> _visible_row_count;
 };
 
 }  // namespace opossum
@@ -0,0 +1,55 @@
+#include "chunk_pos_list.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+
+#include "utils/memory_pool.hpp"
+
+namespace opossum {
+
+ChunkPosList::ChunkPosList(const ChunkID chunk_id, std::pmr::memory_resource* memory_resource)
+    : _chunk_id{chunk_id}, _chunk_offsets{memory_resource} {}
+
+ChunkID ChunkPosList::chunk_id() const { return _chunk_id; }
+
+const pmr_vector<ChunkOffset>& ChunkPosList::chunk_offsets() const { return _chunk_offsets; }
+
+size_t ChunkPosList::size() const { return _chunk_offsets.size(); }
+
+void ChunkPosList::sort() {
+  std::sort(_chunk_offsets.begin(), _chunk_offsets.end());
+
+  _run_count = 0;
+  for (size_t position = 0; position < _chunk_offsets.size(); ++position) {
+    _run_count += position == 0 || _chunk_offsets[position - 1] + 1 != _chunk_offsets[position];
+  }
+}
+
+size_t ChunkPosList::run_count() const { return _run_count; }
+
+PosList ChunkPosList::to_pos_list() const {
+  auto pos_list = PosList{};
+  pos_list.reserve(_chunk_offsets.size());
+  for (const auto chunk_offset : _chunk_offsets) pos_list.emplace_back(RowID{_chunk_id, chunk_offset});
+  return pos_list;
+}
+
+size_t ChunkPosList::memory_consumption() const {
+  return sizeof(*this) + _chunk_offsets.capacity() * sizeof(ChunkOffset);
+}
+
+std::shared_ptr<const ChunkPosList> make_chunk_pos_list(const PosList& pos_list,
+                                                        const std::shared_ptr<MemoryPool>& memory_pool) {
+  if (pos_list.empty()) return nullptr;
+
+  const auto chunk_id = pos_list.front().chunk_id;
+  const auto in_chunk = [&](const RowID& row_id) { return row_id.chunk_id == chunk_id; };
+  if (!std::all_of(pos_list.cbegin(), pos_list.cend(), in_chunk)) return nullptr;
+
+  const auto chunk_pos_list = make_pooled_shared<ChunkPosList>(memory_pool, chunk_id, memory_pool.get());
+  for (const auto& row_id : pos_list) chunk_pos_list->append(row_id.chunk_offset);
+  return chunk_pos_list;
+}
+
+}  // namespace opossum
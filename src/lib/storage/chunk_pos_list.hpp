@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class MemoryPool;
+
+// An alternative to a PosList for positions in a single chunk. It stores the chunk id once and a 4-byte ChunkOffset
+// per position instead of an 8-byte RowID (see make_chunk_pos_list and ReferenceSegment). TableScans on stored chunks
+// write their matches into one directly.
+class ChunkPosList : private Noncopyable {
+ public:
+  explicit ChunkPosList(const ChunkID chunk_id,
+                        std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  ChunkID chunk_id() const;
+
+  const pmr_vector<ChunkOffset>& chunk_offsets() const;
+
+  // Adds a position. This is how scans emit their matches, so runs of consecutive offsets are counted on the way.
+  void append(const ChunkOffset chunk_offset) {
+    _run_count += _chunk_offsets.empty() || _chunk_offsets.back() + 1 != chunk_offset;
+    _chunk_offsets.push_back(chunk_offset);
+  }
+
+  // Removes the positions for which remove(chunk_offset, position) returns true. The others keep their order.
+  template <typename Predicate>
+  void remove_if(const Predicate& remove) {
+    auto kept_count = size_t{0};
+    _run_count = 0;
+    for (auto position = size_t{0}; position < _chunk_offsets.size(); ++position) {
+      const auto chunk_offset = _chunk_offsets[position];
+      if (remove(chunk_offset, position)) continue;
+      _run_count += kept_count == 0 || _chunk_offsets[kept_count - 1] + 1 != chunk_offset;
+      _chunk_offsets[kept_count++] = chunk_offset;
+    }
+    _chunk_offsets.resize(kept_count);
+  }
+
+  // sorts the positions, e.g., after a CrackerIndex emitted them in the order of its pieces
+  void sort();
+
+  // returns the number of runs of consecutive offsets, which decides whether PosRanges pay off (see compress_pos_list)
+  size_t run_count() const;
+
+  // returns the number of positions
+  size_t size() const;
+
+  RowID operator[](const size_t position) const { return RowID{_chunk_id, _chunk_offsets[position]}; }
+
+  // returns the positions as RowIDs
+  PosList to_pos_list() const;
+
+  size_t memory_consumption() const;
+
+ protected:
+  const ChunkID _chunk_id;
+  pmr_vector<ChunkOffset> _chunk_offsets;
+  size_t _run_count = 0;
+};
+
+// Returns the positions as a ChunkPosList, allocated from the memory pool, if there is at least one and all of them are
+// in the same chunk. Returns nullptr otherwise.
+std::shared_ptr<const ChunkPosList> make_chunk_pos_list(const PosList& pos_list,
+                                                        const std::shared_ptr<MemoryPool>& memory_pool);
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#include "chunk_vector.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "chunk.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkVector::~ChunkVector() {
+  for (auto chunk_id = ChunkID{0}; chunk_id < size(); ++chunk_id) delete _slot(chunk_id).load();
+}
+
+ChunkID ChunkVector::size() const { return ChunkID{_size.load(std::memory_order_acquire)}; }
+
+std::shared_ptr<Chunk> ChunkVector::get(const ChunkID chunk_id) const {
+  DebugAssert(chunk_id < size(), "Chunk does not exist");
+  const auto guard = RetireList<std::shared_ptr<Chunk>>::ReadGuard{_retire_list};
+  return *_slot(chunk_id).load();
+}
+
+std::shared_ptr<Chunk> ChunkVector::back() const {
+  DebugAssert(size() > 0, "ChunkVector is empty");
+  return get(ChunkID{size() - 1});
+}
+
+void ChunkVector::push_back(std::shared_ptr<Chunk> chunk) {
+  const auto chunk_id = ChunkID{_size.load(std::memory_order_relaxed)};
+  Assert(chunk_id < FIRST_BUCKET_SIZE * ((uint32_t{1} << BUCKET_COUNT) - 1), "Too many chunks");
+
+  const auto [bucket_id, offset] = _bucket_id_and_offset(chunk_id);
+  if (offset == 0) {
+    _buckets[bucket_id] = std::make_unique<Slot[]>(FIRST_BUCKET_SIZE << bucket_id);
+  }
+
+  _slot(chunk_id).store(new std::shared_ptr<Chunk>(std::move(chunk)));
+  _size.store(chunk_id + 1, std::memory_order_release);
+}
+
+void ChunkVector::replace(const ChunkID chunk_id, std::shared_ptr<Chunk> chunk) {
+  DebugAssert(chunk_id < size(), "Chunk does not exist");
+  _retire_list.retire(_slot(chunk_id).exchange(new std::shared_ptr<Chunk>(std::move(chunk))));
+}
+
+std::pair<uint32_t, uint32_t> ChunkVector::_bucket_id_and_offset(const ChunkID chunk_id) {
+  // Bucket b starts at chunk FIRST_BUCKET_SIZE * (2^b - 1), so b is the position of the highest set bit of
+  // chunk_id / FIRST_BUCKET_SIZE + 1
+  const auto bucket_position = static_cast<uint32_t>(chunk_id) / FIRST_BUCKET_SIZE + 1;
+  auto bucket_id = uint32_t{0};
+  while ((bucket_position >> (bucket_id + 1)) != 0) ++bucket_id;
+
+  const auto bucket_begin = FIRST_BUCKET_SIZE * ((uint32_t{1} << bucket_id) - 1);
+  return {bucket_id, static_cast<uint32_t>(chunk_id) - bucket_begin};
+}
+
+ChunkVector::Slot& ChunkVector::_slot(const ChunkID chunk_id) const {
+  const auto [bucket_id, offset] = _bucket_id_and_offset(chunk_id);
+  return _buckets[bucket_id][offset];
+}
+
+}  // namespace opossum
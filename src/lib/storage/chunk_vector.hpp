@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "types.hpp"
+#include "utils/retire_list.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+// The chunk directory of a table. Other than a std::vector, it can be read while chunks are appended or replaced:
+// the chunks are stored in buckets of doubling size, which are never reallocated, so appending does not move the
+// chunks that readers access. A chunk becomes visible once size() includes it.
+//
+// Each slot is an atomic pointer to a heap-allocated shared_ptr of the chunk. Replacing a chunk (e.g., by its
+// compressed version) publishes a new shared_ptr and retires the previous one, which is deleted once no reader can
+// still copy it (see RetireList). Readers keep the chunk they got alive through their copy of the shared_ptr and never
+// take a lock.
+class ChunkVector : private Noncopyable {
+ public:
+  ChunkVector() = default;
+  ~ChunkVector();
+
+  // returns the number of visible chunks
+  ChunkID size() const;
+
+  // returns the chunk with the given id, which has to be visible
+  std::shared_ptr<Chunk> get(const ChunkID chunk_id) const;
+
+  // returns the last visible chunk
+  std::shared_ptr<Chunk> back() const;
+
+  // Appends a chunk and makes it visible. Concurrent calls have to be serialized by the caller (Table holds its
+  // _append_mutex), but readers may run concurrently.
+  void push_back(std::shared_ptr<Chunk> chunk);
+
+  // Replaces a visible chunk. Readers either get the previous or the new chunk.
+  void replace(const ChunkID chunk_id, std::shared_ptr<Chunk> chunk);
+
+ protected:
+  // The first bucket holds FIRST_BUCKET_SIZE chunks, each of the following ones twice as many as its predecessor.
+  // BUCKET_COUNT buckets hold all but the last few ChunkIDs.
+  static constexpr uint32_t FIRST_BUCKET_SIZE = 8;
+  static constexpr uint32_t BUCKET_COUNT = 29;
+
+  // returns the bucket that holds the given chunk and the position of the chunk's slot in it
+  static std::pair<uint32_t, uint32_t> _bucket_id_and_offset(const ChunkID chunk_id);
+
+  using Slot = std::atomic<const std::shared_ptr<Chunk>*>;
+
+  // returns the slot of a chunk, whose bucket has to be allocated
+  Slot& _slot(const ChunkID chunk_id) const;
+
+  // A bucket is allocated by push_back before the first of its chunks becomes visible and is not modified afterwards,
+  // so readers do not need to synchronize on it.
+  std::array<std::unique_ptr<Slot[]>, BUCKET_COUNT> _buckets;
+  std::atomic<uint32_t> _size{0};
+  RetireList<std::shared_ptr<Chunk>> _retire_list;
+};
+
+}  // namespace opossum
@@ -8,10 +8,12 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "base_dictionary_segment.hpp"
 #include "fitted_attribute_vector.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/performance_counters.hpp"
 #include "value_segment.hpp"
 
 namespace opossum {
@@ -25,7 +27,7 @@ constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max(
 
 // Dictionary is a specific segment type that stores all its values in a vector
 template <typename T>
-class DictionarySegment : public BaseSegment {
+class DictionarySegment : public BaseDictionarySegment {
  public:
   /**
    * Creates a Dictionary segment from a given value segment.
@@ -33,12 +35,17 @@ class DictionarySegment : public BaseSegment {
   explicit DictionarySegment(const std::shared_ptr<BaseSegment>& value_base_segment) {
     const auto value_segment = std::static_pointer_cast<ValueSegment<T>>(value_base_segment);
     const auto rows = value_segment->size();
+    const auto performance_counter_scope = PerformanceCounterScope{"DictionarySegment construction", rows};
 
-    _dictionary_vector = _create_dictionary(value_segment->values());
+    // a preallocated segment holds more values than rows
+    const auto& values = value_segment->values();
+    _dictionary_vector = _create_dictionary(values, rows);
     _attribute_vector = _create_fitted_attribute_vector(rows);
 
-    for (const auto& value : value_segment->values()) {
-      const auto search_iter = std::find(_dictionary_vector->cbegin(), _dictionary_vector->cend(), value);
+    // the dictionary is sorted
+    for (auto chunk_offset = size_t{0}; chunk_offset < rows; ++chunk_offset) {
+      const auto& value = values[chunk_offset];
+      const auto search_iter = std::lower_bound(_dictionary_vector->cbegin(), _dictionary_vector->cend(), value);
 
       _attribute_vector->append(
           ValueID(static_cast<const uint32_t&>(std::distance(_dictionary_vector->cbegin(), search_iter))));
@@ -64,7 +71,7 @@ class DictionarySegment : public BaseSegment {
   std::shared_ptr<const std::vector<T>> dictionary() const { return _dictionary_vector; }
 
   // returns an underlying data structure
-  std::shared_ptr<const BaseAttributeVector> attribute_vector() const { return _attribute_vector; }
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const override { return _attribute_vector; }
 
   // return the value represented by a given ValueID
   const T& value_by_value_id(ValueID value_id) const { return _dictionary_vector->at(value_id); }
@@ -80,7 +87,7 @@ class DictionarySegment : public BaseSegment {
   }
 
   // same as lower_bound(T), but accepts an AllTypeVariant
-  ValueID lower_bound(const AllTypeVariant& value) const { return lower_bound(type_cast<T>(value)); }
+  ValueID lower_bound(const AllTypeVariant& value) const override { return lower_bound(type_cast<T>(value)); }
 
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
@@ -93,20 +100,25 @@ class DictionarySegment : public BaseSegment {
   }
 
   // same as upper_bound(T), but accepts an AllTypeVariant
-  ValueID upper_bound(const AllTypeVariant& value) const { return upper_bound(type_cast<T>(value)); }
+  ValueID upper_bound(const AllTypeVariant& value) const override { return upper_bound(type_cast<T>(value)); }
 
   // return the number of unique_values (dictionary entries)
-  size_t unique_values_count() const { return _dictionary_vector->size(); }
+  size_t unique_values_count() const override { return _dictionary_vector->size(); }
 
   // return the number of entries
   size_t size() const override { return _attribute_vector->size(); }
 
+  size_t memory_consumption() const override {
+    return sizeof(*this) + _dictionary_vector->capacity() * sizeof(T) +
+           _attribute_vector->size() * _attribute_vector->width();
+  }
+
  protected:
   std::shared_ptr<std::vector<T>> _dictionary_vector;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 
-  std::shared_ptr<std::vector<T>> _create_dictionary(const std::vector<T>& segment_values) const {
-    auto values_list = std::make_shared<std::vector<T>>(std::move(segment_values));
+  std::shared_ptr<std::vector<T>> _create_dictionary(const std::vector<T>& segment_values, size_t row_count) const {
+    auto values_list = std::make_shared<std::vector<T>>(segment_values.cbegin(), segment_values.cbegin() + row_count);
 
     std::sort(values_list->begin(), values_list->end());
     auto uniqueness_end_iter = std::unique(values_list->begin(), values_list->end());
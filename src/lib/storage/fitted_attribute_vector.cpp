@@ -1,5 +1,7 @@
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 #include "fitted_attribute_vector.hpp"
 
@@ -39,4 +41,46 @@ void FittedAttributeVector<uintX_t>::append(const ValueID value_id) {
   _value_references.push_back(value_id);
 }
 
+template <typename uintX_t>
+std::vector<size_t> FittedAttributeVector<uintX_t>::value_id_counts(const size_t value_id_count) const {
+  // Incrementing a single histogram stalls whenever nearby rows share a ValueID, as every increment waits for the
+  // store of the previous one. Interleaving four histograms breaks these dependencies, so that the unrolled loop
+  // keeps several increments in flight. The histograms are summed up at the end.
+  constexpr auto HISTOGRAM_COUNT = size_t{4};
+  auto histograms = std::vector<uint32_t>(HISTOGRAM_COUNT * value_id_count, 0u);
+  auto* const histogram_0 = histograms.data();
+  auto* const histogram_1 = histogram_0 + value_id_count;
+  auto* const histogram_2 = histogram_1 + value_id_count;
+  auto* const histogram_3 = histogram_2 + value_id_count;
+
+  const auto* const value_ids = _value_references.data();
+  const auto size = _value_references.size();
+  DebugAssert(std::all_of(_value_references.cbegin(), _value_references.cend(),
+                          [&](const auto value_id) { return value_id < value_id_count; }),
+              "value_id_count is too small");
+
+  auto position = size_t{0};
+  for (; position + HISTOGRAM_COUNT <= size; position += HISTOGRAM_COUNT) {
+    ++histogram_0[value_ids[position]];
+    ++histogram_1[value_ids[position + 1]];
+    ++histogram_2[value_ids[position + 2]];
+    ++histogram_3[value_ids[position + 3]];
+  }
+  for (; position < size; ++position) {
+    ++histogram_0[value_ids[position]];
+  }
+
+  auto counts = std::vector<size_t>(value_id_count);
+  for (size_t value_id = 0; value_id < value_id_count; ++value_id) {
+    counts[value_id] = size_t{histogram_0[value_id]} + histogram_1[value_id] + histogram_2[value_id] +
+                       histogram_3[value_id];
+  }
+  return counts;
+}
+
+template class FittedAttributeVector<uint8_t>;
+template class FittedAttributeVector<uint16_t>;
+template class FittedAttributeVector<uint32_t>;
+template class FittedAttributeVector<uint64_t>;
+
 }  // namespace opossum
@@ -30,6 +30,12 @@ class FittedAttributeVector : public BaseAttributeVector {
 
   void append(const ValueID value_id) override;
 
+  std::vector<size_t> value_id_counts(const size_t value_id_count) const override;
+
+  // returns all value ids, so that loops over them are not slowed down by a virtual call per value (see
+  // DictionarySegmentIterable)
+  const std::vector<uintX_t>& value_ids() const { return _value_references; }
+
  protected:
   std::vector<uintX_t> _value_references;
 };
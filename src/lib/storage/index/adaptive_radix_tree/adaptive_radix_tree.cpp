@@ -0,0 +1,484 @@
+#include "adaptive_radix_tree.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+enum class ArtNodeType : uint8_t { Leaf, Node4, Node16, Node48, Node256 };
+
+struct ArtNode : private Noncopyable {
+  explicit ArtNode(const ArtNodeType init_type) : type{init_type} {}
+  virtual ~ArtNode() = default;
+
+  const ArtNodeType type;
+
+  // For inner nodes, the compressed path between the parent and this node, i.e., the bytes that all keys below this
+  // node share after the byte that selects this node in its parent
+  std::string prefix;
+};
+
+namespace {
+
+template <typename Value>
+struct ArtLeaf : public ArtNode {
+  explicit ArtLeaf(const std::string& init_key) : ArtNode{ArtNodeType::Leaf}, key{init_key} {}
+
+  const std::string key;
+  Value value{};
+};
+
+// Node4 and Node16 store the key bytes of their children sorted in an array next to the children
+template <size_t capacity, ArtNodeType node_type>
+struct ArtSortedNode : public ArtNode {
+  ArtSortedNode() : ArtNode{node_type} {}
+
+  uint8_t child_count = 0;
+  std::array<uint8_t, capacity> keys{};
+  std::array<std::unique_ptr<ArtNode>, capacity> children;
+};
+
+using ArtNode4 = ArtSortedNode<4, ArtNodeType::Node4>;
+using ArtNode16 = ArtSortedNode<16, ArtNodeType::Node16>;
+
+// Node48 maps each key byte to the position of its child plus one, so that zero marks a missing child
+struct ArtNode48 : public ArtNode {
+  ArtNode48() : ArtNode{ArtNodeType::Node48} {}
+
+  uint8_t child_count = 0;
+  std::array<uint8_t, 256> child_indexes{};
+  std::array<std::unique_ptr<ArtNode>, 48> children;
+};
+
+struct ArtNode256 : public ArtNode {
+  ArtNode256() : ArtNode{ArtNodeType::Node256} {}
+
+  uint16_t child_count = 0;
+  std::array<std::unique_ptr<ArtNode>, 256> children;
+};
+
+// returns the slot holding the child for the given key byte or nullptr if there is no such child
+std::unique_ptr<ArtNode>* find_child(ArtNode& node, const uint8_t byte) {
+  switch (node.type) {
+    case ArtNodeType::Node4: {
+      auto& node4 = static_cast<ArtNode4&>(node);
+      for (auto position = 0; position < node4.child_count; ++position) {
+        if (node4.keys[position] == byte) return &node4.children[position];
+      }
+      return nullptr;
+    }
+    case ArtNodeType::Node16: {
+      auto& node16 = static_cast<ArtNode16&>(node);
+#if defined(__SSE2__)
+      // compare all 16 key bytes at once
+      const auto keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(node16.keys.data()));
+      const auto comparison = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)), keys);
+      const auto matches = _mm_movemask_epi8(comparison) & ((1 << node16.child_count) - 1);
+      if (matches != 0) return &node16.children[__builtin_ctz(matches)];
+#else
+      for (auto position = 0; position < node16.child_count; ++position) {
+        if (node16.keys[position] == byte) return &node16.children[position];
+      }
+#endif
+      return nullptr;
+    }
+    case ArtNodeType::Node48: {
+      auto& node48 = static_cast<ArtNode48&>(node);
+      const auto child_index = node48.child_indexes[byte];
+      return child_index != 0 ? &node48.children[child_index - 1] : nullptr;
+    }
+    case ArtNodeType::Node256: {
+      auto& node256 = static_cast<ArtNode256&>(node);
+      return node256.children[byte] ? &node256.children[byte] : nullptr;
+    }
+    default:
+      return nullptr;
+  }
+}
+
+const ArtNode* find_child(const ArtNode& node, const uint8_t byte) {
+  const auto child = find_child(const_cast<ArtNode&>(node), byte);
+  return child ? child->get() : nullptr;
+}
+
+// returns the child with the smallest key byte greater than after_byte (pass -1 to get the first child)
+const ArtNode* next_child(const ArtNode& node, const int16_t after_byte) {
+  const auto next_of_sorted_node = [&](const auto& sorted_node) -> const ArtNode* {
+    for (auto position = 0; position < sorted_node.child_count; ++position) {
+      if (sorted_node.keys[position] > after_byte) return sorted_node.children[position].get();
+    }
+    return nullptr;
+  };
+
+  switch (node.type) {
+    case ArtNodeType::Node4:
+      return next_of_sorted_node(static_cast<const ArtNode4&>(node));
+    case ArtNodeType::Node16:
+      return next_of_sorted_node(static_cast<const ArtNode16&>(node));
+    case ArtNodeType::Node48: {
+      const auto& node48 = static_cast<const ArtNode48&>(node);
+      for (auto byte = after_byte + 1; byte < 256; ++byte) {
+        const auto child_index = node48.child_indexes[byte];
+        if (child_index != 0) return node48.children[child_index - 1].get();
+      }
+      return nullptr;
+    }
+    case ArtNodeType::Node256: {
+      const auto& node256 = static_cast<const ArtNode256&>(node);
+      for (auto byte = after_byte + 1; byte < 256; ++byte) {
+        if (node256.children[byte]) return node256.children[byte].get();
+      }
+      return nullptr;
+    }
+    default:
+      return nullptr;
+  }
+}
+
+template <typename SortedNode>
+void insert_sorted(SortedNode& node, const uint8_t byte, std::unique_ptr<ArtNode> child) {
+  auto position = size_t{node.child_count};
+  while (position > 0 && node.keys[position - 1] > byte) {
+    node.keys[position] = node.keys[position - 1];
+    node.children[position] = std::move(node.children[position - 1]);
+    --position;
+  }
+  node.keys[position] = byte;
+  node.children[position] = std::move(child);
+  ++node.child_count;
+}
+
+// Adds a child to the node in node_slot. If the node is full, it is replaced by the next bigger node type.
+void add_child(std::unique_ptr<ArtNode>& node_slot, const uint8_t byte, std::unique_ptr<ArtNode> child) {
+  switch (node_slot->type) {
+    case ArtNodeType::Node4: {
+      auto& node4 = static_cast<ArtNode4&>(*node_slot);
+      if (node4.child_count < 4) {
+        insert_sorted(node4, byte, std::move(child));
+        return;
+      }
+
+      auto node16 = std::make_unique<ArtNode16>();
+      node16->prefix = std::move(node4.prefix);
+      for (auto position = 0; position < 4; ++position) {
+        node16->keys[position] = node4.keys[position];
+        node16->children[position] = std::move(node4.children[position]);
+      }
+      node16->child_count = 4;
+      insert_sorted(*node16, byte, std::move(child));
+      node_slot = std::move(node16);
+      return;
+    }
+    case ArtNodeType::Node16: {
+      auto& node16 = static_cast<ArtNode16&>(*node_slot);
+      if (node16.child_count < 16) {
+        insert_sorted(node16, byte, std::move(child));
+        return;
+      }
+
+      auto node48 = std::make_unique<ArtNode48>();
+      node48->prefix = std::move(node16.prefix);
+      for (auto position = 0; position < 16; ++position) {
+        node48->child_indexes[node16.keys[position]] = position + 1;
+        node48->children[position] = std::move(node16.children[position]);
+      }
+      node48->child_count = 16;
+      node_slot = std::move(node48);
+      add_child(node_slot, byte, std::move(child));
+      return;
+    }
+    case ArtNodeType::Node48: {
+      auto& node48 = static_cast<ArtNode48&>(*node_slot);
+      // Children are never removed, so the first free position is the one after the last child
+      if (node48.child_count < 48) {
+        node48.children[node48.child_count] = std::move(child);
+        node48.child_indexes[byte] = ++node48.child_count;
+        return;
+      }
+
+      auto node256 = std::make_unique<ArtNode256>();
+      node256->prefix = std::move(node48.prefix);
+      for (auto key_byte = 0; key_byte < 256; ++key_byte) {
+        const auto child_index = node48.child_indexes[key_byte];
+        if (child_index != 0) node256->children[key_byte] = std::move(node48.children[child_index - 1]);
+      }
+      node256->child_count = 48;
+      node_slot = std::move(node256);
+      add_child(node_slot, byte, std::move(child));
+      return;
+    }
+    case ArtNodeType::Node256: {
+      auto& node256 = static_cast<ArtNode256&>(*node_slot);
+      node256.children[byte] = std::move(child);
+      ++node256.child_count;
+      return;
+    }
+    default:
+      Fail("Cannot add a child to a leaf");
+  }
+}
+
+template <typename Value>
+const ArtLeaf<Value>* minimum_leaf(const ArtNode* node) {
+  while (node->type != ArtNodeType::Leaf) node = next_child(*node, -1);
+  return static_cast<const ArtLeaf<Value>*>(node);
+}
+
+// returns the leaf with the smallest key >= key (or > key if strict) below node
+template <typename Value>
+const ArtLeaf<Value>* leaf_lower_bound(const ArtNode* node, const std::string& key, size_t depth, const bool strict) {
+  if (node->type == ArtNodeType::Leaf) {
+    const auto leaf = static_cast<const ArtLeaf<Value>*>(node);
+    const auto comparison = leaf->key.compare(key);
+    return (comparison > 0 || (comparison == 0 && !strict)) ? leaf : nullptr;
+  }
+
+  // std::char_traits<char> compares bytes as unsigned chars, which is what our keys need
+  const auto& prefix = node->prefix;
+  const auto comparison = prefix.compare(0, prefix.size(), key, depth, prefix.size());
+  // All keys below this node are greater than the search key
+  if (comparison > 0) return minimum_leaf<Value>(node);
+  // All keys below this node are smaller than the search key
+  if (comparison < 0) return nullptr;
+
+  depth += prefix.size();
+  const auto byte = static_cast<uint8_t>(key[depth]);
+  if (const auto child = find_child(*node, byte)) {
+    if (const auto leaf = leaf_lower_bound<Value>(child, key, depth + 1, strict)) return leaf;
+  }
+
+  const auto greater_child = next_child(*node, byte);
+  return greater_child ? minimum_leaf<Value>(greater_child) : nullptr;
+}
+
+template <typename Value>
+size_t node_memory_consumption(const ArtNode& node) {
+  switch (node.type) {
+    case ArtNodeType::Leaf:
+      return sizeof(ArtLeaf<Value>) + static_cast<const ArtLeaf<Value>&>(node).key.size();
+    case ArtNodeType::Node4:
+      return sizeof(ArtNode4) + node.prefix.size();
+    case ArtNodeType::Node16:
+      return sizeof(ArtNode16) + node.prefix.size();
+    case ArtNodeType::Node48:
+      return sizeof(ArtNode48) + node.prefix.size();
+    case ArtNodeType::Node256:
+      return sizeof(ArtNode256) + node.prefix.size();
+  }
+  return 0;
+}
+
+template <typename Value>
+size_t subtree_memory_consumption(const ArtNode& node) {
+  auto memory_consumption = node_memory_consumption<Value>(node);
+  if (node.type == ArtNodeType::Leaf) return memory_consumption;
+
+  for (auto byte = 0; byte < 256; ++byte) {
+    if (const auto child = find_child(node, static_cast<uint8_t>(byte))) {
+      memory_consumption += subtree_memory_consumption<Value>(*child);
+    }
+  }
+  return memory_consumption;
+}
+
+}  // namespace
+
+template <typename Value>
+AdaptiveRadixTree<Value>::AdaptiveRadixTree() = default;
+
+template <typename Value>
+AdaptiveRadixTree<Value>::~AdaptiveRadixTree() = default;
+
+template <typename Value>
+AdaptiveRadixTree<Value>::AdaptiveRadixTree(AdaptiveRadixTree&&) = default;
+
+template <typename Value>
+AdaptiveRadixTree<Value>& AdaptiveRadixTree<Value>::operator=(AdaptiveRadixTree&&) = default;
+
+template <typename Value>
+Value& AdaptiveRadixTree<Value>::insert(const std::string& key) {
+  auto node_slot = &_root;
+  auto depth = size_t{0};
+
+  // creates the leaf for the new key, which the callers below hang into the tree
+  auto new_leaf = [&]() {
+    ++_size;
+    return std::make_unique<ArtLeaf<Value>>(key);
+  };
+
+  while (true) {
+    if (!*node_slot) {
+      auto leaf = new_leaf();
+      auto& value = leaf->value;
+      *node_slot = std::move(leaf);
+      return value;
+    }
+
+    auto& node = **node_slot;
+
+    if (node.type == ArtNodeType::Leaf) {
+      auto& leaf = static_cast<ArtLeaf<Value>&>(node);
+      if (leaf.key == key) return leaf.value;
+
+      // Replace the leaf by an inner node that holds both the old and the new leaf. Since keys are prefix-free, they
+      // differ before one of them ends.
+      auto mismatch = depth;
+      while (leaf.key[mismatch] == key[mismatch]) ++mismatch;
+
+      auto inner_node = std::unique_ptr<ArtNode>{std::make_unique<ArtNode4>()};
+      inner_node->prefix = key.substr(depth, mismatch - depth);
+      const auto leaf_byte = static_cast<uint8_t>(leaf.key[mismatch]);
+      add_child(inner_node, leaf_byte, std::move(*node_slot));
+
+      auto leaf_for_key = new_leaf();
+      auto& value = leaf_for_key->value;
+      add_child(inner_node, static_cast<uint8_t>(key[mismatch]), std::move(leaf_for_key));
+      *node_slot = std::move(inner_node);
+      return value;
+    }
+
+    const auto prefix_size = node.prefix.size();
+    auto matched = size_t{0};
+    while (matched < prefix_size && node.prefix[matched] == key[depth + matched]) ++matched;
+
+    if (matched < prefix_size) {
+      // Split the compressed path: a new inner node takes the common part, the old node keeps the rest
+      auto inner_node = std::unique_ptr<ArtNode>{std::make_unique<ArtNode4>()};
+      inner_node->prefix = node.prefix.substr(0, matched);
+      const auto node_byte = static_cast<uint8_t>(node.prefix[matched]);
+      node.prefix = node.prefix.substr(matched + 1);
+      add_child(inner_node, node_byte, std::move(*node_slot));
+
+      auto leaf_for_key = new_leaf();
+      auto& value = leaf_for_key->value;
+      add_child(inner_node, static_cast<uint8_t>(key[depth + matched]), std::move(leaf_for_key));
+      *node_slot = std::move(inner_node);
+      return value;
+    }
+
+    depth += prefix_size;
+    const auto byte = static_cast<uint8_t>(key[depth]);
+    const auto child_slot = find_child(node, byte);
+    if (!child_slot) {
+      auto leaf = new_leaf();
+      auto& value = leaf->value;
+      add_child(*node_slot, byte, std::move(leaf));
+      return value;
+    }
+
+    node_slot = child_slot;
+    ++depth;
+  }
+}
+
+template <typename Value>
+const Value* AdaptiveRadixTree<Value>::find(const std::string& key) const {
+  const auto* node = _root.get();
+  auto depth = size_t{0};
+
+  while (node) {
+    if (node->type == ArtNodeType::Leaf) {
+      const auto& leaf = static_cast<const ArtLeaf<Value>&>(*node);
+      return leaf.key == key ? &leaf.value : nullptr;
+    }
+
+    if (key.compare(depth, node->prefix.size(), node->prefix) != 0) return nullptr;
+    depth += node->prefix.size();
+    if (depth >= key.size()) return nullptr;
+
+    node = find_child(*node, static_cast<uint8_t>(key[depth]));
+    ++depth;
+  }
+
+  return nullptr;
+}
+
+template <typename Value>
+void AdaptiveRadixTree<Value>::find_batch(const std::vector<std::string>& keys,
+                                          std::vector<const Value*>& results) const {
+  results.assign(keys.size(), nullptr);
+  if (!_root) return;
+
+  for (auto batch_begin = size_t{0}; batch_begin < keys.size(); batch_begin += BATCH_SIZE) {
+    const auto batch_size = std::min(BATCH_SIZE, keys.size() - batch_begin);
+
+    auto nodes = std::array<const ArtNode*, BATCH_SIZE>{};
+    auto depths = std::array<size_t, BATCH_SIZE>{};
+    std::fill_n(nodes.begin(), batch_size, _root.get());
+    auto active_count = batch_size;
+
+    // Every round moves each key of the batch one node further down, so the prefetch of a key's next node has the
+    // rest of the round to complete
+    while (active_count > 0) {
+      for (auto batch_position = size_t{0}; batch_position < batch_size; ++batch_position) {
+        auto& node = nodes[batch_position];
+        if (!node) continue;
+
+        const auto& key = keys[batch_begin + batch_position];
+        auto& depth = depths[batch_position];
+
+        if (node->type == ArtNodeType::Leaf) {
+          const auto& leaf = static_cast<const ArtLeaf<Value>&>(*node);
+          if (leaf.key == key) results[batch_begin + batch_position] = &leaf.value;
+          node = nullptr;
+          --active_count;
+          continue;
+        }
+
+        if (key.compare(depth, node->prefix.size(), node->prefix) != 0 || depth + node->prefix.size() >= key.size()) {
+          node = nullptr;
+          --active_count;
+          continue;
+        }
+
+        depth += node->prefix.size();
+        node = find_child(*node, static_cast<uint8_t>(key[depth]));
+        ++depth;
+
+        if (node) {
+          __builtin_prefetch(node);
+        } else {
+          --active_count;
+        }
+      }
+    }
+  }
+}
+
+template <typename Value>
+const Value* AdaptiveRadixTree<Value>::lower_bound(const std::string& key) const {
+  if (!_root) return nullptr;
+  const auto leaf = leaf_lower_bound<Value>(_root.get(), key, 0, false);
+  return leaf ? &leaf->value : nullptr;
+}
+
+template <typename Value>
+const Value* AdaptiveRadixTree<Value>::upper_bound(const std::string& key) const {
+  if (!_root) return nullptr;
+  const auto leaf = leaf_lower_bound<Value>(_root.get(), key, 0, true);
+  return leaf ? &leaf->value : nullptr;
+}
+
+template <typename Value>
+size_t AdaptiveRadixTree<Value>::size() const {
+  return _size;
+}
+
+template <typename Value>
+size_t AdaptiveRadixTree<Value>::memory_consumption() const {
+  return _root ? subtree_memory_consumption<Value>(*_root) : 0;
+}
+
+// The per-chunk index stores positions, the table-wide index stores RowIDs
+template class AdaptiveRadixTree<size_t>;
+template class AdaptiveRadixTree<PosList>;
+
+}  // namespace opossum
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Appends the binary-comparable representation of a value to an ART key, i.e., a byte sequence for which memcmp
+ * yields the same order as operator< on the values:
+ *
+ *  - integers are stored in big-endian order with a flipped sign bit
+ *  - floating point numbers are stored like integers, but negative numbers have all their bits flipped
+ *  - strings are stored as they are, followed by a terminating zero byte
+ *
+ * All keys of one data type are prefix-free, which the tree relies on. Strings must therefore not contain zero bytes.
+ */
+template <typename T>
+void append_art_key(const T& value, std::string& key) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    DebugAssert(value.find('\0') == std::string::npos, "ART keys must not contain zero bytes");
+    key.append(value);
+    key.push_back('\0');
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    static_assert(sizeof(T) == sizeof(Bits), "Unsupported key type");
+
+    constexpr auto sign_bit = Bits{1} << (sizeof(Bits) * 8 - 1);
+    auto bits = Bits{};
+    std::memcpy(&bits, &value, sizeof(T));
+
+    if constexpr (std::is_floating_point_v<T>) {
+      bits = (bits & sign_bit) ? ~bits : (bits | sign_bit);
+    } else {
+      bits ^= sign_bit;
+    }
+
+    for (auto shift = static_cast<int>(sizeof(Bits) * 8) - 8; shift >= 0; shift -= 8) {
+      key.push_back(static_cast<char>((bits >> shift) & 0xFF));
+    }
+  }
+}
+
+struct ArtNode;
+
+/**
+ * An adaptive radix tree (Leis et al., "The Adaptive Radix Tree: ARTful Indexing for Main-Memory Databases", ICDE 2013)
+ * that maps binary-comparable keys (see append_art_key) to values.
+ *
+ * Inner nodes grow from 4 over 16 and 48 to 256 children as needed, so that sparse nodes stay small and dense nodes
+ * are accessed without any search. Paths without branches are compressed into the prefix of the next inner node.
+ * Since keys are prefix-free, values are only stored in leaves.
+ *
+ * The tree does not support removals. Values are stored in the leaves and keep their address once inserted.
+ */
+template <typename Value>
+class AdaptiveRadixTree : private Noncopyable {
+ public:
+  // Number of keys that find_batch traverses in lockstep
+  static constexpr size_t BATCH_SIZE = 16;
+
+  AdaptiveRadixTree();
+  ~AdaptiveRadixTree();
+
+  AdaptiveRadixTree(AdaptiveRadixTree&&);
+  AdaptiveRadixTree& operator=(AdaptiveRadixTree&&);
+
+  // returns the value of the given key, which is default-constructed if the key was not present yet
+  Value& insert(const std::string& key);
+
+  // returns the value of the given key or nullptr if the key is not present
+  const Value* find(const std::string& key) const;
+
+  // Looks up many keys at once and stores their values (or nullptr) in results. Groups of BATCH_SIZE keys descend the
+  // tree together, one level per round. Each round prefetches the next node of every key, so that the cache misses of
+  // the group overlap instead of being paid one after another.
+  void find_batch(const std::vector<std::string>& keys, std::vector<const Value*>& results) const;
+
+  // returns the value of the smallest key >= the given key or nullptr if there is no such key
+  const Value* lower_bound(const std::string& key) const;
+
+  // returns the value of the smallest key > the given key or nullptr if there is no such key
+  const Value* upper_bound(const std::string& key) const;
+
+  // returns the number of keys
+  size_t size() const;
+
+  // returns the number of bytes occupied by the nodes (excluding memory owned by the values)
+  size_t memory_consumption() const;
+
+ protected:
+  std::unique_ptr<ArtNode> _root;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::shared_ptr<const BaseSegment>& segment)
+    : BaseIndex{SegmentIndexType::AdaptiveRadixTree} {
+  resolve_data_type_of_segment(*segment, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    auto values = std::vector<Type>{};
+    if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<Type>>(segment)) {
+      values.assign(value_segment->values().cbegin(), value_segment->values().cbegin() + value_segment->size());
+    } else {
+      const auto dictionary_segment = std::static_pointer_cast<const DictionarySegment<Type>>(segment);
+      values.reserve(dictionary_segment->size());
+      for (size_t chunk_offset = 0; chunk_offset < dictionary_segment->size(); ++chunk_offset) {
+        values.push_back(dictionary_segment->get(chunk_offset));
+      }
+    }
+
+    // Sort the chunk offsets by their values. The sort is stable, so the offsets of equal values stay ascending.
+    _chunk_offsets.resize(values.size());
+    std::iota(_chunk_offsets.begin(), _chunk_offsets.end(), ChunkOffset{0});
+    std::stable_sort(_chunk_offsets.begin(), _chunk_offsets.end(),
+                     [&values](const auto& left, const auto& right) { return values[left] < values[right]; });
+
+    // Every distinct value becomes a key that points to the first of its chunk offsets
+    auto key = std::string{};
+    for (size_t position = 0; position < _chunk_offsets.size(); ++position) {
+      const auto& value = values[_chunk_offsets[position]];
+      if (position > 0 && values[_chunk_offsets[position - 1]] == value) continue;
+
+      key.clear();
+      append_art_key(value, key);
+      _tree.insert(key) = position;
+    }
+
+    _append_key = [](const AllTypeVariant& value, std::string& key) { append_art_key(type_cast<Type>(value), key); };
+  });
+}
+
+size_t AdaptiveRadixTreeIndex::memory_consumption() const {
+  return _tree.memory_consumption() + _chunk_offsets.size() * sizeof(ChunkOffset);
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const AllTypeVariant& value) const {
+  auto key = std::string{};
+  _append_key(value, key);
+  return _position(_tree.lower_bound(key));
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const AllTypeVariant& value) const {
+  auto key = std::string{};
+  _append_key(value, key);
+  return _position(_tree.upper_bound(key));
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _chunk_offsets.cbegin(); }
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _chunk_offsets.cend(); }
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_position(const size_t* value) const {
+  return value ? _chunk_offsets.cbegin() + *value : _chunk_offsets.cend();
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "adaptive_radix_tree.hpp"
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// AdaptiveRadixTreeIndex is an index on a ValueSegment or DictionarySegment. Each distinct value of the segment is
+// a key of an AdaptiveRadixTree, which points to the first chunk offset of that value. This makes point lookups on
+// columns with many distinct values (e.g., IDs) cheap, because the tree depth only depends on the key length.
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  explicit AdaptiveRadixTreeIndex(const std::shared_ptr<const BaseSegment>& segment);
+
+  size_t memory_consumption() const override;
+
+ protected:
+  Iterator _lower_bound(const AllTypeVariant& value) const override;
+  Iterator _upper_bound(const AllTypeVariant& value) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+
+  // returns the position in _chunk_offsets that a value of the tree points to, or the end if there is none
+  Iterator _position(const size_t* value) const;
+
+  // encodes a search value as a key, using the data type of the indexed segment
+  std::function<void(const AllTypeVariant&, std::string&)> _append_key;
+
+  AdaptiveRadixTree<size_t> _tree;
+
+  // all chunk offsets of the segment, ordered by their values
+  std::vector<ChunkOffset> _chunk_offsets;
+};
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#include "adaptive_radix_tree_table_index.hpp"
+
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterables.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+AdaptiveRadixTreeTableIndex::AdaptiveRadixTreeTableIndex(const DataType data_type) {
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    _append_key = [](const AllTypeVariant& value, std::string& key) { append_art_key(type_cast<Type>(value), key); };
+  });
+}
+
+void AdaptiveRadixTreeTableIndex::insert(const AllTypeVariant& value, const RowID& row_id) {
+  auto key = std::string{};
+  _append_key(value, key);
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  _tree.insert(key).push_back(row_id);
+  ++_row_count;
+}
+
+void AdaptiveRadixTreeTableIndex::insert_segment(const BaseSegment& segment, const ChunkID chunk_id) {
+  resolve_data_type_of_segment(segment, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    // Consecutive rows often hold the same value, so we only descend the tree when the value changes
+    auto key = std::string{};
+    auto previous_key = std::string{};
+    PosList* row_ids = nullptr;
+
+    const auto insert_value = [&](const Type& value, const ChunkOffset chunk_offset) {
+      key.clear();
+      append_art_key(value, key);
+      if (!row_ids || key != previous_key) {
+        row_ids = &_tree.insert(key);
+        previous_key.swap(key);
+      }
+      row_ids->push_back(RowID{chunk_id, chunk_offset});
+    };
+
+    resolve_segment_type<Type>(segment, [&](const auto& typed_segment) {
+      using SegmentType = std::decay_t<decltype(typed_segment)>;
+      if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+        Fail("Table indexes can only index Value/DictionarySegments");
+      } else {
+        std::unique_lock<std::shared_mutex> lock(_mutex);
+        create_iterable<Type>(typed_segment).for_each([&](const Type& value, const ChunkOffset chunk_offset) {
+          insert_value(value, chunk_offset);
+          ++_row_count;
+        });
+      }
+    });
+  });
+}
+
+PosList AdaptiveRadixTreeTableIndex::lookup(const AllTypeVariant& value) const {
+  auto key = std::string{};
+  _append_key(value, key);
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  const auto row_ids = _tree.find(key);
+  return row_ids ? *row_ids : PosList{};
+}
+
+size_t AdaptiveRadixTreeTableIndex::key_count() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _tree.size();
+}
+
+size_t AdaptiveRadixTreeTableIndex::memory_consumption() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _tree.memory_consumption() + _row_count * sizeof(RowID);
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#pragma once
+
+// the linter wants this to be above everything else
+#include <shared_mutex>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "adaptive_radix_tree.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// AdaptiveRadixTreeTableIndex maps the values of one column of a whole table to the RowIDs of the rows holding them.
+// It is created by Table::create_table_index, which also keeps it up to date when rows or chunks are added. Lookups
+// may run while rows are inserted: they share a lock that inserts take exclusively, and return copies of the RowIDs,
+// since the PosLists in the tree grow with later inserts.
+class AdaptiveRadixTreeTableIndex : private Noncopyable {
+ public:
+  // creates an empty index for a column of the given data type
+  explicit AdaptiveRadixTreeTableIndex(const DataType data_type);
+
+  // adds a single row
+  void insert(const AllTypeVariant& value, const RowID& row_id);
+
+  // adds all rows of a ValueSegment or DictionarySegment, which is stored in the given chunk
+  void insert_segment(const BaseSegment& segment, const ChunkID chunk_id);
+
+  // returns the RowIDs of all rows holding the given value in the order in which they were added
+  PosList lookup(const AllTypeVariant& value) const;
+
+  // Looks up many values at once, which is considerably faster than calling lookup for each of them (see
+  // AdaptiveRadixTree::find_batch). T has to be the data type of the indexed column. For every value, results holds
+  // the RowIDs of the rows holding it, which are empty if there are none.
+  template <typename T>
+  void lookup_batch(const std::vector<T>& values, std::vector<PosList>& results) const {
+    auto keys = std::vector<std::string>(values.size());
+    for (size_t position = 0; position < values.size(); ++position) {
+      append_art_key(values[position], keys[position]);
+    }
+
+    auto row_ids = std::vector<const PosList*>{};
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    _tree.find_batch(keys, row_ids);
+
+    results.resize(values.size());
+    for (size_t position = 0; position < values.size(); ++position) {
+      if (row_ids[position]) {
+        results[position] = *row_ids[position];
+      } else {
+        results[position].clear();
+      }
+    }
+  }
+
+  // returns the number of distinct values
+  size_t key_count() const;
+
+  size_t memory_consumption() const;
+
+ protected:
+  // encodes a value as a key, using the data type of the indexed column
+  std::function<void(const AllTypeVariant&, std::string&)> _append_key;
+
+  AdaptiveRadixTree<PosList> _tree;
+  size_t _row_count = 0;
+
+  // shared by lookups, held exclusively by inserts
+  mutable std::shared_mutex _mutex;
+};
+}  // namespace opossum
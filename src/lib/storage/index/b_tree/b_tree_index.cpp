@@ -0,0 +1,27 @@
+#include "b_tree_index.hpp"
+
+#include <memory>
+
+#include "b_tree_index_impl.hpp"
+#include "resolve_type.hpp"
+
+namespace opossum {
+
+BTreeIndex::BTreeIndex(const std::shared_ptr<const BaseSegment>& segment) : BaseIndex{SegmentIndexType::BTree} {
+  resolve_data_type_of_segment(*segment, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    _impl = std::make_shared<BTreeIndexImpl<Type>>(segment);
+  });
+}
+
+size_t BTreeIndex::memory_consumption() const { return _impl->memory_consumption(); }
+
+BTreeIndex::Iterator BTreeIndex::_lower_bound(const AllTypeVariant& value) const { return _impl->lower_bound(value); }
+
+BTreeIndex::Iterator BTreeIndex::_upper_bound(const AllTypeVariant& value) const { return _impl->upper_bound(value); }
+
+BTreeIndex::Iterator BTreeIndex::_cbegin() const { return _impl->cbegin(); }
+
+BTreeIndex::Iterator BTreeIndex::_cend() const { return _impl->cend(); }
+
+}  // namespace opossum
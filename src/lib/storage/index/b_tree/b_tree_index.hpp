@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseBTreeIndexImpl;
+class BaseSegment;
+
+// BTreeIndex is an index on a ValueSegment. Since the values of a ValueSegment are not ordered, lookups are answered
+// by a bulk-loaded B+-tree over the distinct values (see BTreeIndexImpl).
+class BTreeIndex : public BaseIndex {
+ public:
+  explicit BTreeIndex(const std::shared_ptr<const BaseSegment>& segment);
+
+  size_t memory_consumption() const override;
+
+ protected:
+  Iterator _lower_bound(const AllTypeVariant& value) const override;
+  Iterator _upper_bound(const AllTypeVariant& value) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+
+  std::shared_ptr<const BaseBTreeIndexImpl> _impl;
+};
+}  // namespace opossum
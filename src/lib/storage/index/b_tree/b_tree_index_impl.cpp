@@ -0,0 +1,124 @@
+#include "b_tree_index_impl.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+BTreeIndexImpl<T>::BTreeIndexImpl(const std::shared_ptr<const BaseSegment>& segment) {
+  const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment);
+  Assert(value_segment != nullptr, "BTreeIndex requires a ValueSegment");
+  const auto& values = value_segment->values();
+
+  // Sort the chunk offsets by their values. The sort is stable, so the offsets of equal values stay ascending.
+  _chunk_offsets.resize(value_segment->size());
+  std::iota(_chunk_offsets.begin(), _chunk_offsets.end(), ChunkOffset{0});
+  std::stable_sort(_chunk_offsets.begin(), _chunk_offsets.end(),
+                   [&values](const auto& left, const auto& right) { return values[left] < values[right]; });
+
+  // Every distinct value becomes a leaf key
+  _levels.emplace_back();
+  auto& leaves = _levels.front();
+  for (size_t position = 0; position < _chunk_offsets.size(); ++position) {
+    const auto& value = values[_chunk_offsets[position]];
+    if (leaves.empty() || leaves.back() != value) {
+      leaves.push_back(value);
+      _key_offsets.push_back(position);
+    }
+  }
+  // sentinel, so that the offsets of key i are always [_key_offsets[i], _key_offsets[i + 1])
+  _key_offsets.push_back(_chunk_offsets.size());
+
+  _build_inner_levels();
+}
+
+template <typename T>
+void BTreeIndexImpl<T>::_build_inner_levels() {
+  while (_levels.back().size() > NODE_SIZE) {
+    const auto& lower_level = _levels.back();
+
+    auto upper_level = std::vector<T>{};
+    upper_level.reserve(lower_level.size() / NODE_SIZE + 1);
+    for (size_t node_begin = 0; node_begin < lower_level.size(); node_begin += NODE_SIZE) {
+      const auto node_end = std::min(node_begin + NODE_SIZE, lower_level.size());
+      upper_level.push_back(lower_level[node_end - 1]);
+    }
+
+    _levels.emplace_back(std::move(upper_level));
+  }
+}
+
+template <typename T>
+template <typename Comparator>
+size_t BTreeIndexImpl<T>::_find_leaf_position(const T& value, const Comparator& key_is_before_value) const {
+  auto level_id = _levels.size() - 1;
+  auto node_begin = size_t{0};
+
+  while (true) {
+    const auto& level = _levels[level_id];
+    const auto node_end = std::min(node_begin + NODE_SIZE, level.size());
+
+    // Nodes are small enough for a linear search to beat a binary search
+    auto position = node_begin;
+    while (position < node_end && key_is_before_value(level[position], value)) ++position;
+
+    if (level_id == 0) return position;
+
+    // Only possible in the root: all keys are before the value
+    if (position == node_end) return _levels.front().size();
+
+    node_begin = position * NODE_SIZE;
+    --level_id;
+  }
+}
+
+template <typename T>
+typename BTreeIndexImpl<T>::Iterator BTreeIndexImpl<T>::lower_bound(const T& value) const {
+  const auto position = _find_leaf_position(value, [](const T& key, const T& search_value) { return key < search_value; });
+  return _chunk_offsets.cbegin() + _key_offsets[position];
+}
+
+template <typename T>
+typename BTreeIndexImpl<T>::Iterator BTreeIndexImpl<T>::upper_bound(const T& value) const {
+  const auto position =
+      _find_leaf_position(value, [](const T& key, const T& search_value) { return key <= search_value; });
+  return _chunk_offsets.cbegin() + _key_offsets[position];
+}
+
+template <typename T>
+typename BTreeIndexImpl<T>::Iterator BTreeIndexImpl<T>::lower_bound(const AllTypeVariant& value) const {
+  return lower_bound(type_cast<T>(value));
+}
+
+template <typename T>
+typename BTreeIndexImpl<T>::Iterator BTreeIndexImpl<T>::upper_bound(const AllTypeVariant& value) const {
+  return upper_bound(type_cast<T>(value));
+}
+
+template <typename T>
+typename BTreeIndexImpl<T>::Iterator BTreeIndexImpl<T>::cbegin() const {
+  return _chunk_offsets.cbegin();
+}
+
+template <typename T>
+typename BTreeIndexImpl<T>::Iterator BTreeIndexImpl<T>::cend() const {
+  return _chunk_offsets.cend();
+}
+
+template <typename T>
+size_t BTreeIndexImpl<T>::memory_consumption() const {
+  auto key_count = size_t{0};
+  for (const auto& level : _levels) key_count += level.size();
+  return sizeof(T) * key_count + sizeof(size_t) * _key_offsets.size() + sizeof(ChunkOffset) * _chunk_offsets.size();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(BTreeIndexImpl);
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// Non-templated interface of BTreeIndexImpl, so that BTreeIndex does not need to know the data type
+class BaseBTreeIndexImpl : private Noncopyable {
+ public:
+  using Iterator = BaseIndex::Iterator;
+
+  BaseBTreeIndexImpl() = default;
+  virtual ~BaseBTreeIndexImpl() = default;
+
+  virtual Iterator lower_bound(const AllTypeVariant& value) const = 0;
+  virtual Iterator upper_bound(const AllTypeVariant& value) const = 0;
+  virtual Iterator cbegin() const = 0;
+  virtual Iterator cend() const = 0;
+  virtual size_t memory_consumption() const = 0;
+};
+
+// A static (bulk-loaded) B+-tree over the values of a ValueSegment.
+//
+// The leaf level holds the distinct values of the segment in sorted order. It is cut into nodes of NODE_SIZE keys.
+// Each inner level holds the largest key of every node of the level below, i.e., level i + 1 has
+// ceil(|level i| / NODE_SIZE) keys. Searching for the first key >= x starts at the (at most NODE_SIZE keys wide) root
+// level and descends into exactly one node per level. Nodes are contiguous in memory, so that each step touches only
+// a few cache lines.
+//
+// For every distinct value, _key_offsets points to the first of its chunk offsets in _chunk_offsets.
+template <typename T>
+class BTreeIndexImpl : public BaseBTreeIndexImpl {
+ public:
+  static constexpr size_t NODE_SIZE = 16;
+
+  explicit BTreeIndexImpl(const std::shared_ptr<const BaseSegment>& segment);
+
+  Iterator lower_bound(const AllTypeVariant& value) const override;
+  Iterator upper_bound(const AllTypeVariant& value) const override;
+  Iterator cbegin() const override;
+  Iterator cend() const override;
+  size_t memory_consumption() const override;
+
+  Iterator lower_bound(const T& value) const;
+  Iterator upper_bound(const T& value) const;
+
+ protected:
+  // returns the position of the first leaf key for which the comparator returns false, i.e., with
+  // std::less the first key >= value and with std::less_equal the first key > value
+  template <typename Comparator>
+  size_t _find_leaf_position(const T& value, const Comparator& key_is_before_value) const;
+
+  void _build_inner_levels();
+
+  // _levels[0] holds the leaves, _levels.back() the root
+  std::vector<std::vector<T>> _levels;
+  std::vector<size_t> _key_offsets;
+  std::vector<ChunkOffset> _chunk_offsets;
+};
+
+}  // namespace opossum
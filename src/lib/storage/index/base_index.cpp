@@ -0,0 +1,17 @@
+#include "base_index.hpp"
+
+namespace opossum {
+
+BaseIndex::BaseIndex(const SegmentIndexType type) : _type{type} {}
+
+BaseIndex::Iterator BaseIndex::lower_bound(const AllTypeVariant& value) const { return _lower_bound(value); }
+
+BaseIndex::Iterator BaseIndex::upper_bound(const AllTypeVariant& value) const { return _upper_bound(value); }
+
+BaseIndex::Iterator BaseIndex::cbegin() const { return _cbegin(); }
+
+BaseIndex::Iterator BaseIndex::cend() const { return _cend(); }
+
+SegmentIndexType BaseIndex::type() const { return _type; }
+
+}  // namespace opossum
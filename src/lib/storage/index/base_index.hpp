@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BaseIndex is the abstract super class for all secondary indexes that can be attached to a chunk,
+// e.g., GroupKeyIndex or BTreeIndex.
+//
+// An index covers the segment of a single column. It exposes the chunk offsets of that segment ordered by their
+// values, so that every point or range predicate is answered by one or two contiguous ranges of offsets:
+//
+//   value == x:  [lower_bound(x), upper_bound(x))
+//   value <  x:  [cbegin(), lower_bound(x))
+//   value >= x:  [lower_bound(x), cend())
+//
+// Chunk offsets that refer to the same value are stored in ascending order. Adaptive indexes (CrackerIndex) only
+// guarantee the ranges above, but not the order of the chunk offsets within them.
+class BaseIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  explicit BaseIndex(const SegmentIndexType type);
+  virtual ~BaseIndex() = default;
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  BaseIndex(BaseIndex&&) = default;
+  BaseIndex& operator=(BaseIndex&&) = default;
+
+  // returns an iterator to the first chunk offset whose value is not less than the given value
+  Iterator lower_bound(const AllTypeVariant& value) const;
+
+  // returns an iterator to the first chunk offset whose value is greater than the given value
+  Iterator upper_bound(const AllTypeVariant& value) const;
+
+  // returns an iterator to the chunk offset of the smallest value
+  Iterator cbegin() const;
+
+  // returns an iterator past the chunk offset of the largest value
+  Iterator cend() const;
+
+  SegmentIndexType type() const;
+
+  // returns the number of bytes occupied by the index structures
+  virtual size_t memory_consumption() const = 0;
+
+ protected:
+  virtual Iterator _lower_bound(const AllTypeVariant& value) const = 0;
+  virtual Iterator _upper_bound(const AllTypeVariant& value) const = 0;
+  virtual Iterator _cbegin() const = 0;
+  virtual Iterator _cend() const = 0;
+
+  SegmentIndexType _type;
+};
+}  // namespace opossum
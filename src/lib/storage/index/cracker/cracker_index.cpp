@@ -0,0 +1,48 @@
+#include "cracker_index.hpp"
+
+#include <memory>
+
+#include "cracker_index_impl.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CrackerIndex::CrackerIndex(const std::shared_ptr<const BaseSegment>& segment) : BaseIndex{SegmentIndexType::Cracker} {
+  resolve_data_type_of_segment(*segment, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    _impl = std::make_shared<CrackerIndexImpl<Type>>(segment);
+  });
+}
+
+void CrackerIndex::scan(const ScanType scan_type, const AllTypeVariant& search_value,
+                        ChunkPosList& chunk_pos_list) const {
+  _impl->scan(scan_type, search_value, chunk_pos_list);
+}
+
+CrackerStatistics CrackerIndex::statistics() const { return _impl->statistics(); }
+
+size_t CrackerIndex::memory_consumption() const { return _impl->memory_consumption(); }
+
+// The cracked copy is reorganized by every lookup, so iterators into it would not stay valid
+CrackerIndex::Iterator CrackerIndex::_lower_bound(const AllTypeVariant&) const {
+  Fail("CrackerIndex only answers predicates via scan()");
+  return {};
+}
+
+CrackerIndex::Iterator CrackerIndex::_upper_bound(const AllTypeVariant&) const {
+  Fail("CrackerIndex only answers predicates via scan()");
+  return {};
+}
+
+CrackerIndex::Iterator CrackerIndex::_cbegin() const {
+  Fail("CrackerIndex only answers predicates via scan()");
+  return {};
+}
+
+CrackerIndex::Iterator CrackerIndex::_cend() const {
+  Fail("CrackerIndex only answers predicates via scan()");
+  return {};
+}
+
+}  // namespace opossum
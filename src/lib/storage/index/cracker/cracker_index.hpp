@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCrackerIndexImpl;
+class BaseSegment;
+class ChunkPosList;
+
+// Counters describing how far a CrackerIndex has converged
+struct CrackerStatistics {
+  // number of scans and bound lookups answered by the index
+  size_t query_count = 0;
+
+  // number of partitioning steps, i.e., bounds that were not known yet
+  size_t crack_count = 0;
+
+  // number of pieces the cracked copy of the segment is split into
+  size_t piece_count = 1;
+
+  // number of values that were read while partitioning
+  size_t touched_value_count = 0;
+
+  // number of times values appended to the segment were merged into the cracked copy, which drops all cracks
+  size_t merge_count = 0;
+};
+
+// CrackerIndex is an adaptive index on a ValueSegment (Idreos et al., "Database Cracking", CIDR 2007). It is not built
+// upfront, but keeps a copy of the segment that every query partitions a bit further: a scan for value < x splits
+// the piece of the copy that contains x into the values < x and the rest and remembers the split position. Later
+// scans only need to touch the pieces that contain their bounds, so repeated range scans converge towards the cost
+// of a sorted index.
+//
+// TableScan uses the index transparently via scan(). Values appended to the segment after the index was created are
+// scanned sequentially until they make up a considerable part of the segment. Then they are merged into the copy,
+// which starts the cracking anew.
+//
+// Unlike other indexes, lookups modify the index. Iterators into the cracked copy would be invalidated by the next
+// lookup of another thread, so the index answers predicates only via scan(), which holds the lock throughout, and
+// the iterator lookups of the BaseIndex interface fail.
+class CrackerIndex : public BaseIndex {
+ public:
+  explicit CrackerIndex(const std::shared_ptr<const BaseSegment>& segment);
+
+  // Adds the chunk offsets of all rows that match the predicate to the empty chunk_pos_list (in ascending order) and
+  // refines the index on the way. Safe to call from multiple threads.
+  void scan(const ScanType scan_type, const AllTypeVariant& search_value, ChunkPosList& chunk_pos_list) const;
+
+  CrackerStatistics statistics() const;
+
+  size_t memory_consumption() const override;
+
+ protected:
+  Iterator _lower_bound(const AllTypeVariant& value) const override;
+  Iterator _upper_bound(const AllTypeVariant& value) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+
+  // not const, because lookups refine the index
+  std::shared_ptr<BaseCrackerIndexImpl> _impl;
+};
+}  // namespace opossum
@@ -0,0 +1,172 @@
+#include "cracker_index_impl.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk_pos_list.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+CrackerIndexImpl<T>::CrackerIndexImpl(const std::shared_ptr<const BaseSegment>& segment)
+    : _segment{std::dynamic_pointer_cast<const ValueSegment<T>>(segment)} {
+  Assert(_segment != nullptr, "CrackerIndex requires a ValueSegment");
+
+  // The copy starts as a single piece in table order
+  const auto& segment_values = _segment->values();
+  _values.assign(segment_values.cbegin(), segment_values.cbegin() + _segment->size());
+  _chunk_offsets.resize(_values.size());
+  std::iota(_chunk_offsets.begin(), _chunk_offsets.end(), ChunkOffset{0});
+}
+
+template <typename T>
+void CrackerIndexImpl<T>::scan(const ScanType scan_type, const AllTypeVariant& search_value,
+                               ChunkPosList& chunk_pos_list) {
+  DebugAssert(chunk_pos_list.size() == 0, "Positions are only added to an empty ChunkPosList");
+  const auto value = type_cast<T>(search_value);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _merge_appended_values(_values.size() / MERGE_RATIO + 1);
+  ++_statistics.query_count;
+
+  // The qualifying values of the cracked copy form at most two ranges
+  const auto size = _values.size();
+  auto ranges = std::vector<std::pair<size_t, size_t>>{};
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      ranges.emplace_back(_crack({value, false}), _crack({value, true}));
+      break;
+    case ScanType::OpNotEquals:
+      ranges.emplace_back(0, _crack({value, false}));
+      ranges.emplace_back(_crack({value, true}), size);
+      break;
+    case ScanType::OpLessThan:
+      ranges.emplace_back(0, _crack({value, false}));
+      break;
+    case ScanType::OpLessThanEquals:
+      ranges.emplace_back(0, _crack({value, true}));
+      break;
+    case ScanType::OpGreaterThan:
+      ranges.emplace_back(_crack({value, true}), size);
+      break;
+    case ScanType::OpGreaterThanEquals:
+      ranges.emplace_back(_crack({value, false}), size);
+      break;
+    default:
+      Fail("Unknown scan type");
+  }
+
+  for (const auto& [range_begin, range_end] : ranges) {
+    for (auto position = range_begin; position < range_end; ++position) {
+      chunk_pos_list.append(_chunk_offsets[position]);
+    }
+  }
+
+  // Values that were appended since the last merge are not part of the cracked copy yet
+  const auto& segment_values = _segment->values();
+  const auto segment_size = _segment->size();
+  for (auto chunk_offset = static_cast<ChunkOffset>(size); chunk_offset < segment_size; ++chunk_offset) {
+    const auto& segment_value = segment_values[chunk_offset];
+    auto matches = false;
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        matches = segment_value == value;
+        break;
+      case ScanType::OpNotEquals:
+        matches = segment_value != value;
+        break;
+      case ScanType::OpLessThan:
+        matches = segment_value < value;
+        break;
+      case ScanType::OpLessThanEquals:
+        matches = segment_value <= value;
+        break;
+      case ScanType::OpGreaterThan:
+        matches = segment_value > value;
+        break;
+      case ScanType::OpGreaterThanEquals:
+        matches = segment_value >= value;
+        break;
+    }
+    if (matches) chunk_pos_list.append(chunk_offset);
+  }
+
+  // Pieces are not ordered, but consumers expect the positions in table order
+  chunk_pos_list.sort();
+}
+
+template <typename T>
+CrackerStatistics CrackerIndexImpl<T>::statistics() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto statistics = _statistics;
+  statistics.piece_count = _cracks.size() + 1;
+  return statistics;
+}
+
+template <typename T>
+size_t CrackerIndexImpl<T>::memory_consumption() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  // a std::map node holds three pointers and the color next to its value
+  const auto crack_size = sizeof(std::pair<const Bound, size_t>) + 4 * sizeof(void*);
+  return _values.size() * (sizeof(T) + sizeof(ChunkOffset)) + _cracks.size() * crack_size;
+}
+
+template <typename T>
+size_t CrackerIndexImpl<T>::_crack(const Bound& bound) {
+  const auto next_crack = _cracks.lower_bound(bound);
+  if (next_crack != _cracks.end() && next_crack->first == bound) return next_crack->second;
+
+  // The bound falls into the piece between the previous and the next crack
+  const auto piece_begin = next_crack == _cracks.begin() ? size_t{0} : std::prev(next_crack)->second;
+  const auto piece_end = next_crack == _cracks.end() ? _values.size() : next_crack->second;
+
+  const auto& [bound_value, bound_inclusive] = bound;
+  const auto is_in_front = [&](const T& value) { return bound_inclusive ? value <= bound_value : value < bound_value; };
+
+  // Partition the piece in place by swapping misplaced values from both ends
+  auto left = piece_begin;
+  auto right = piece_end;
+  while (true) {
+    while (left < right && is_in_front(_values[left])) ++left;
+    while (left < right && !is_in_front(_values[right - 1])) --right;
+    if (left == right) break;
+
+    std::swap(_values[left], _values[right - 1]);
+    std::swap(_chunk_offsets[left], _chunk_offsets[right - 1]);
+    ++left;
+    --right;
+  }
+
+  ++_statistics.crack_count;
+  _statistics.touched_value_count += piece_end - piece_begin;
+  _cracks.emplace_hint(next_crack, bound, left);
+  return left;
+}
+
+template <typename T>
+void CrackerIndexImpl<T>::_merge_appended_values(const size_t min_count) {
+  const auto& segment_values = _segment->values();
+  const auto segment_size = _segment->size();
+  const auto appended_count = segment_size - _values.size();
+  if (appended_count == 0 || appended_count < min_count) return;
+
+  // The appended values could belong to any piece, so the cracks cannot be kept
+  for (auto chunk_offset = static_cast<ChunkOffset>(_values.size()); chunk_offset < segment_size; ++chunk_offset) {
+    _values.push_back(segment_values[chunk_offset]);
+    _chunk_offsets.push_back(chunk_offset);
+  }
+  _cracks.clear();
+  ++_statistics.merge_count;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(CrackerIndexImpl);
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "cracker_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+template <typename T>
+class ValueSegment;
+
+// Non-templated interface of CrackerIndexImpl, so that CrackerIndex does not need to know the data type
+class BaseCrackerIndexImpl : private Noncopyable {
+ public:
+  BaseCrackerIndexImpl() = default;
+  virtual ~BaseCrackerIndexImpl() = default;
+
+  virtual void scan(const ScanType scan_type, const AllTypeVariant& search_value, ChunkPosList& chunk_pos_list) = 0;
+  virtual CrackerStatistics statistics() const = 0;
+  virtual size_t memory_consumption() const = 0;
+};
+
+// The cracked copy of the segment consists of _values and the aligned _chunk_offsets. _cracks maps every bound that
+// was cracked on to its position in the copy: all values in front of the position of (x, false) are < x, all values
+// in front of the position of (x, true) are <= x. Two neighboring cracks enclose a piece, which is not ordered.
+template <typename T>
+class CrackerIndexImpl : public BaseCrackerIndexImpl {
+ public:
+  // Appended values are merged into the cracked copy once there is one of them for every MERGE_RATIO cracked values
+  static constexpr size_t MERGE_RATIO = 8;
+
+  explicit CrackerIndexImpl(const std::shared_ptr<const BaseSegment>& segment);
+
+  void scan(const ScanType scan_type, const AllTypeVariant& search_value, ChunkPosList& chunk_pos_list) override;
+  CrackerStatistics statistics() const override;
+  size_t memory_consumption() const override;
+
+ protected:
+  using Bound = std::pair<T, bool>;
+
+  // returns the position of the bound in the cracked copy, partitioning its piece if the bound is new
+  size_t _crack(const Bound& bound);
+
+  // merges the values appended to the segment into the cracked copy if there are at least min_count of them
+  void _merge_appended_values(const size_t min_count);
+
+  const std::shared_ptr<const ValueSegment<T>> _segment;
+  std::vector<T> _values;
+  std::vector<ChunkOffset> _chunk_offsets;
+  std::map<Bound, size_t> _cracks;
+  CrackerStatistics _statistics;
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
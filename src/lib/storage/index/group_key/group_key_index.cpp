@@ -0,0 +1,61 @@
+#include "group_key_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "storage/base_attribute_vector.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GroupKeyIndex::GroupKeyIndex(const std::shared_ptr<const BaseSegment>& segment)
+    : BaseIndex{SegmentIndexType::GroupKey},
+      _indexed_segment{std::dynamic_pointer_cast<const BaseDictionarySegment>(segment)} {
+  Assert(_indexed_segment != nullptr, "GroupKeyIndex requires a DictionarySegment");
+
+  const auto attribute_vector = _indexed_segment->attribute_vector();
+  const auto row_count = attribute_vector->size();
+
+  // Count the occurrences of each ValueID. The counts are shifted by one so that the prefix sum below directly turns
+  // them into the start offsets of each ValueID's postings.
+  _value_id_offsets.resize(_indexed_segment->unique_values_count() + 1, 0u);
+  for (size_t chunk_offset = 0; chunk_offset < row_count; ++chunk_offset) {
+    ++_value_id_offsets[attribute_vector->get(chunk_offset) + 1];
+  }
+  for (size_t value_id = 1; value_id < _value_id_offsets.size(); ++value_id) {
+    _value_id_offsets[value_id] += _value_id_offsets[value_id - 1];
+  }
+
+  // Scatter the chunk offsets to their ValueID's postings. Since we iterate in ascending order, the postings of each
+  // ValueID are sorted.
+  auto next_posting = std::vector<size_t>(_value_id_offsets.cbegin(), _value_id_offsets.cend() - 1);
+  _postings.resize(row_count);
+  for (ChunkOffset chunk_offset = 0; chunk_offset < row_count; ++chunk_offset) {
+    _postings[next_posting[attribute_vector->get(chunk_offset)]++] = chunk_offset;
+  }
+}
+
+size_t GroupKeyIndex::memory_consumption() const {
+  return sizeof(size_t) * _value_id_offsets.size() + sizeof(ChunkOffset) * _postings.size();
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_lower_bound(const AllTypeVariant& value) const {
+  return _postings_begin(_indexed_segment->lower_bound(value));
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_upper_bound(const AllTypeVariant& value) const {
+  return _postings_begin(_indexed_segment->upper_bound(value));
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::_cbegin() const { return _postings.cbegin(); }
+
+GroupKeyIndex::Iterator GroupKeyIndex::_cend() const { return _postings.cend(); }
+
+GroupKeyIndex::Iterator GroupKeyIndex::_postings_begin(const ValueID value_id) const {
+  if (value_id == INVALID_VALUE_ID) return _postings.cend();
+  return _postings.cbegin() + _value_id_offsets[value_id];
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+class BaseSegment;
+
+// GroupKeyIndex is an index on a DictionarySegment. Since the dictionary is sorted, the ValueIDs of the attribute
+// vector already define the order of the values. The index therefore only stores, for every ValueID, the postings
+// (i.e., chunk offsets) of the rows holding that ValueID:
+//
+//   attribute vector:  [2, 0, 1, 0, 2]
+//   _value_id_offsets: [0, 2, 3, 5]      (postings of ValueID i are [_value_id_offsets[i], _value_id_offsets[i + 1]))
+//   _postings:         [1, 3, 2, 0, 4]
+//
+// A lookup is a binary search in the dictionary followed by one access to _value_id_offsets.
+class GroupKeyIndex : public BaseIndex {
+ public:
+  explicit GroupKeyIndex(const std::shared_ptr<const BaseSegment>& segment);
+
+  size_t memory_consumption() const override;
+
+ protected:
+  Iterator _lower_bound(const AllTypeVariant& value) const override;
+  Iterator _upper_bound(const AllTypeVariant& value) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+
+  // returns the postings iterator of the first row holding the given ValueID (INVALID_VALUE_ID refers to cend)
+  Iterator _postings_begin(const ValueID value_id) const;
+
+  const std::shared_ptr<const BaseDictionarySegment> _indexed_segment;
+  std::vector<size_t> _value_id_offsets;
+  std::vector<ChunkOffset> _postings;
+};
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "segment_iterables.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Appends the values of a ValueSegment, DictionarySegment or ReferenceSegment to values. T has to be the data type of
+// the segment. Other than BaseSegment::operator[], this does not create an AllTypeVariant per value.
+// ReferenceSegments are materialized in bulk (see ReferenceSegmentIterable::materialize).
+template <typename T>
+void materialize_values(const BaseSegment& segment, std::vector<T>& values) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      ReferenceSegmentIterable<T>{typed_segment}.materialize(values);
+    } else {
+      // Rows may be appended to a ValueSegment concurrently, so its size is only an estimate here
+      values.reserve(values.size() + typed_segment.size());
+      create_iterable<T>(typed_segment).for_each([&](const T& value, const ChunkOffset) { values.push_back(value); });
+    }
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,172 @@
+#include "mvcc_data.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// A row is visible if a transaction committed its insert but not its delete up to the snapshot and the reader's own
+// transaction does not hold it (i.e., did not delete it), or if the reader's own transaction inserted it. Uses bitwise
+// operators instead of && and || to avoid branches.
+bool is_row_visible(const Snapshot& snapshot, const CommitID begin_commit_id, const CommitID end_commit_id,
+                    const TransactionID transaction_id) {
+  const auto own_row =
+      (transaction_id == snapshot.transaction_id) & (snapshot.transaction_id != INVALID_TRANSACTION_ID);
+  const auto committed = (begin_commit_id <= snapshot.commit_id) & (end_commit_id > snapshot.commit_id);
+  const auto own_insert = own_row & (begin_commit_id == MAX_COMMIT_ID);
+  return (committed & !own_row) | own_insert;
+}
+
+// the entries of rows that no transaction touched, which are therefore visible to everyone
+constexpr auto UNTOUCHED_BEGIN_COMMIT_ID = CommitID{0};
+constexpr auto UNTOUCHED_END_COMMIT_ID = MAX_COMMIT_ID;
+constexpr auto UNTOUCHED_TRANSACTION_ID = INVALID_TRANSACTION_ID;
+
+}  // namespace
+
+MvccData::MvccData(const ChunkOffset capacity) : _capacity{capacity} {
+  for (auto& block : _blocks) block.store(nullptr, std::memory_order_relaxed);
+}
+
+MvccData::~MvccData() {
+  for (auto& block : _blocks) delete block.load(std::memory_order_relaxed);
+}
+
+MvccData::Block::Block(const uint64_t size)
+    : begin_commit_ids{std::make_unique<std::atomic<CommitID>[]>(size)},
+      end_commit_ids{std::make_unique<std::atomic<CommitID>[]>(size)},
+      transaction_ids{std::make_unique<std::atomic<TransactionID>[]>(size)} {
+  for (auto offset = uint64_t{0}; offset < size; ++offset) {
+    begin_commit_ids[offset].store(UNTOUCHED_BEGIN_COMMIT_ID, std::memory_order_relaxed);
+    end_commit_ids[offset].store(UNTOUCHED_END_COMMIT_ID, std::memory_order_relaxed);
+    transaction_ids[offset].store(UNTOUCHED_TRANSACTION_ID, std::memory_order_relaxed);
+  }
+}
+
+ChunkOffset MvccData::capacity() const { return _capacity; }
+
+CommitID MvccData::begin_commit_id(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < _capacity, "Row does not exist");
+  const auto [block_id, offset] = _block_id_and_offset(chunk_offset);
+  const auto block = _block(block_id);
+  return block ? block->begin_commit_ids[offset].load(std::memory_order_relaxed) : UNTOUCHED_BEGIN_COMMIT_ID;
+}
+
+CommitID MvccData::end_commit_id(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < _capacity, "Row does not exist");
+  const auto [block_id, offset] = _block_id_and_offset(chunk_offset);
+  const auto block = _block(block_id);
+  return block ? block->end_commit_ids[offset].load(std::memory_order_relaxed) : UNTOUCHED_END_COMMIT_ID;
+}
+
+TransactionID MvccData::transaction_id(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < _capacity, "Row does not exist");
+  const auto [block_id, offset] = _block_id_and_offset(chunk_offset);
+  const auto block = _block(block_id);
+  return block ? block->transaction_ids[offset].load(std::memory_order_relaxed) : UNTOUCHED_TRANSACTION_ID;
+}
+
+// Stores are relaxed: they are published to readers by the release of the chunk size (inserts) or of the last commit
+// id (commits), and readers that do not synchronize with them yet do not see the row either way.
+void MvccData::set_begin_commit_id(const ChunkOffset chunk_offset, const CommitID commit_id) {
+  DebugAssert(chunk_offset < _capacity, "Row does not exist");
+  const auto [block_id, offset] = _block_id_and_offset(chunk_offset);
+  _writable_block(block_id).begin_commit_ids[offset].store(commit_id, std::memory_order_relaxed);
+}
+
+void MvccData::set_end_commit_id(const ChunkOffset chunk_offset, const CommitID commit_id) {
+  DebugAssert(chunk_offset < _capacity, "Row does not exist");
+  const auto [block_id, offset] = _block_id_and_offset(chunk_offset);
+  _writable_block(block_id).end_commit_ids[offset].store(commit_id, std::memory_order_relaxed);
+}
+
+void MvccData::set_transaction_id(const ChunkOffset chunk_offset, const TransactionID transaction_id) {
+  DebugAssert(chunk_offset < _capacity, "Row does not exist");
+  const auto [block_id, offset] = _block_id_and_offset(chunk_offset);
+  _writable_block(block_id).transaction_ids[offset].store(transaction_id, std::memory_order_relaxed);
+}
+
+bool MvccData::try_lock(const ChunkOffset chunk_offset, const TransactionID transaction_id) {
+  DebugAssert(chunk_offset < _capacity, "Row does not exist");
+  const auto [block_id, offset] = _block_id_and_offset(chunk_offset);
+  auto expected_transaction_id = INVALID_TRANSACTION_ID;
+  return _writable_block(block_id).transaction_ids[offset].compare_exchange_strong(
+      expected_transaction_id, transaction_id, std::memory_order_acq_rel);
+}
+
+bool MvccData::modified() const { return _modified.load(std::memory_order_acquire); }
+
+void MvccData::set_modified() { _modified.store(true, std::memory_order_release); }
+
+bool MvccData::is_visible(const Snapshot& snapshot, const ChunkOffset chunk_offset) const {
+  return is_row_visible(snapshot, begin_commit_id(chunk_offset), end_commit_id(chunk_offset),
+                        transaction_id(chunk_offset));
+}
+
+void MvccData::get_visible_rows(const Snapshot& snapshot, const ChunkOffset row_count,
+                                std::vector<uint8_t>& visible) const {
+  DebugAssert(row_count <= _capacity, "Rows do not exist");
+  visible.resize(row_count);
+
+  for (auto block_id = uint32_t{0}; _block_begin(block_id) < row_count; ++block_id) {
+    const auto block_begin = _block_begin(block_id);
+    const auto block_end = std::min(block_begin + _block_size(block_id), uint64_t{row_count});
+    const auto block = _block(block_id);
+
+    if (!block) {
+      const auto untouched_row_visible =
+          is_row_visible(snapshot, UNTOUCHED_BEGIN_COMMIT_ID, UNTOUCHED_END_COMMIT_ID, UNTOUCHED_TRANSACTION_ID);
+      std::fill(visible.begin() + block_begin, visible.begin() + block_end, untouched_row_visible);
+      continue;
+    }
+
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      const auto offset = chunk_offset - block_begin;
+      visible[chunk_offset] = is_row_visible(snapshot, block->begin_commit_ids[offset].load(std::memory_order_relaxed),
+                                             block->end_commit_ids[offset].load(std::memory_order_relaxed),
+                                             block->transaction_ids[offset].load(std::memory_order_relaxed));
+    }
+  }
+}
+
+uint64_t MvccData::_block_begin(const uint32_t block_id) {
+  return FIRST_BLOCK_SIZE * ((uint64_t{1} << block_id) - 1);
+}
+
+std::pair<uint32_t, uint64_t> MvccData::_block_id_and_offset(const ChunkOffset chunk_offset) {
+  // Block b starts at row FIRST_BLOCK_SIZE * (2^b - 1), so b is the position of the highest set bit of
+  // chunk_offset / FIRST_BLOCK_SIZE + 1
+  const auto block_position = uint64_t{chunk_offset} / FIRST_BLOCK_SIZE + 1;
+  auto block_id = uint32_t{0};
+  while ((block_position >> (block_id + 1)) != 0) ++block_id;
+
+  return {block_id, chunk_offset - _block_begin(block_id)};
+}
+
+uint64_t MvccData::_block_size(const uint32_t block_id) const {
+  return std::min(FIRST_BLOCK_SIZE << block_id, uint64_t{_capacity} - _block_begin(block_id));
+}
+
+const MvccData::Block* MvccData::_block(const uint32_t block_id) const {
+  return _blocks[block_id].load(std::memory_order_acquire);
+}
+
+MvccData::Block& MvccData::_writable_block(const uint32_t block_id) {
+  auto block = _blocks[block_id].load(std::memory_order_acquire);
+  if (block) return *block;
+
+  auto new_block = std::make_unique<Block>(_block_size(block_id));
+  if (_blocks[block_id].compare_exchange_strong(block, new_block.get(), std::memory_order_acq_rel)) {
+    return *new_block.release();
+  }
+  // another writer was faster, block now points to its block
+  return *block;
+}
+
+}  // namespace opossum
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// What a reader sees: all rows that were inserted and not deleted by transactions that committed up to commit_id,
+// plus the uncommitted inserts and minus the uncommitted deletes of its own transaction (if transaction_id is valid).
+struct Snapshot {
+  CommitID commit_id;
+  TransactionID transaction_id;
+};
+
+// The MVCC columns of a chunk. For every row, they hold the commit ids of the transactions that inserted and deleted
+// it (begin and end commit id) and the id of the transaction that currently holds it, i.e., that inserted it and did
+// not commit yet, or that deleted it. Rows that are appended without a transaction have a begin commit id of 0, so
+// they are visible to everyone.
+//
+// The columns are stored in blocks of doubling size, which are never reallocated while readers check the visibility
+// of rows (like the chunks of a table, see ChunkVector). A block is only allocated once a transaction touches one of
+// its rows, so chunks that are filled without transactions do not pay for the columns. All entries are atomics, as
+// writers change them while readers scan the chunk.
+class MvccData : private Noncopyable {
+ public:
+  // capacity is the maximum number of rows, no memory is allocated for them up front
+  explicit MvccData(const ChunkOffset capacity);
+  ~MvccData();
+
+  ChunkOffset capacity() const;
+
+  CommitID begin_commit_id(const ChunkOffset chunk_offset) const;
+  CommitID end_commit_id(const ChunkOffset chunk_offset) const;
+  TransactionID transaction_id(const ChunkOffset chunk_offset) const;
+
+  void set_begin_commit_id(const ChunkOffset chunk_offset, const CommitID commit_id);
+  void set_end_commit_id(const ChunkOffset chunk_offset, const CommitID commit_id);
+  void set_transaction_id(const ChunkOffset chunk_offset, const TransactionID transaction_id);
+
+  // Locks the row for the given transaction, e.g., to delete it. Returns false if another transaction holds it.
+  bool try_lock(const ChunkOffset chunk_offset, const TransactionID transaction_id);
+
+  // Returns whether a transaction ever touched a row of the chunk. If not, all rows are visible to everyone and
+  // readers skip the visibility check. Writers set it before their change can become visible to others.
+  bool modified() const;
+  void set_modified();
+
+  bool is_visible(const Snapshot& snapshot, const ChunkOffset chunk_offset) const;
+
+  // Checks the visibility of the first row_count rows at once and stores 1 for every visible row and 0 otherwise. The
+  // loop has no branches, so that the compiler can vectorize it.
+  void get_visible_rows(const Snapshot& snapshot, const ChunkOffset row_count, std::vector<uint8_t>& visible) const;
+
+ protected:
+  struct Block {
+    explicit Block(const uint64_t size);
+
+    std::unique_ptr<std::atomic<CommitID>[]> begin_commit_ids;
+    std::unique_ptr<std::atomic<CommitID>[]> end_commit_ids;
+    std::unique_ptr<std::atomic<TransactionID>[]> transaction_ids;
+  };
+
+  // The first block holds FIRST_BLOCK_SIZE rows, each of the following ones twice as many as its predecessor, so
+  // that BLOCK_COUNT blocks hold every ChunkOffset. Blocks of small chunks end at the capacity.
+  static constexpr uint64_t FIRST_BLOCK_SIZE = 1'024;
+  static constexpr uint32_t BLOCK_COUNT = 23;
+
+  static uint64_t _block_begin(const uint32_t block_id);
+
+  // returns the block that holds the given row and the position of the row in it
+  static std::pair<uint32_t, uint64_t> _block_id_and_offset(const ChunkOffset chunk_offset);
+
+  uint64_t _block_size(const uint32_t block_id) const;
+
+  // returns the block with the given id, or nullptr if no row of it was touched yet
+  const Block* _block(const uint32_t block_id) const;
+
+  // Returns the block with the given id and allocates it if necessary. Concurrent writers may both allocate it, only
+  // the first one publishes its block. Rows in a new block are visible to everyone, as if no transaction had touched
+  // them.
+  Block& _writable_block(const uint32_t block_id);
+
+  const ChunkOffset _capacity;
+  std::array<std::atomic<Block*>, BLOCK_COUNT> _blocks;
+  std::atomic<bool> _modified{false};
+};
+
+}  // namespace opossum
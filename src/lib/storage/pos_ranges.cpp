@@ -0,0 +1,93 @@
+#include "pos_ranges.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+
+#include "chunk_pos_list.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_pool.hpp"
+
+namespace opossum {
+
+PosRanges::PosRanges(const ChunkID chunk_id, std::pmr::memory_resource* memory_resource)
+    : _chunk_id{chunk_id}, _ranges{memory_resource}, _first_positions{memory_resource} {}
+
+void PosRanges::append(const ChunkOffset chunk_offset) {
+  if (!_ranges.empty() && _ranges.back().end == chunk_offset) {
+    ++_ranges.back().end;
+  } else {
+    _ranges.push_back(Range{chunk_offset, chunk_offset + 1});
+    _first_positions.push_back(_size);
+  }
+  ++_size;
+}
+
+ChunkID PosRanges::chunk_id() const { return _chunk_id; }
+
+size_t PosRanges::size() const { return _size; }
+
+const pmr_vector<PosRanges::Range>& PosRanges::ranges() const { return _ranges; }
+
+size_t PosRanges::first_position(const size_t range_index) const { return _first_positions[range_index]; }
+
+RowID PosRanges::operator[](const size_t position) const {
+  DebugAssert(position < _size, "Position does not exist");
+  // the last range that starts at or before the position
+  const auto range_index =
+      std::distance(_first_positions.cbegin(),
+                    std::upper_bound(_first_positions.cbegin(), _first_positions.cend(), position)) -
+      1;
+  const auto chunk_offset = _ranges[range_index].begin + (position - _first_positions[range_index]);
+  return RowID{_chunk_id, static_cast<ChunkOffset>(chunk_offset)};
+}
+
+PosList PosRanges::to_pos_list() const {
+  auto pos_list = PosList{};
+  pos_list.reserve(_size);
+  for (const auto& range : _ranges) {
+    for (auto chunk_offset = range.begin; chunk_offset < range.end; ++chunk_offset) {
+      pos_list.emplace_back(RowID{_chunk_id, chunk_offset});
+    }
+  }
+  return pos_list;
+}
+
+size_t PosRanges::memory_consumption() const {
+  return sizeof(*this) + _ranges.capacity() * sizeof(Range) + _first_positions.capacity() * sizeof(size_t);
+}
+
+std::shared_ptr<const PosRanges> compress_pos_list(const PosList& pos_list,
+                                                   const std::shared_ptr<MemoryPool>& memory_pool) {
+  if (pos_list.empty()) return nullptr;
+
+  // Counting the runs first avoids building ranges that are not used. Scattered positions are given up on early.
+  const auto chunk_id = pos_list.front().chunk_id;
+  const auto max_run_count = pos_list.size() / POS_RANGES_MIN_AVERAGE_RUN_LENGTH;
+  auto run_count = size_t{1};
+  for (auto position = size_t{1}; position < pos_list.size(); ++position) {
+    const auto& row_id = pos_list[position];
+    if (row_id.chunk_id != chunk_id) return nullptr;
+    run_count += row_id.chunk_offset != pos_list[position - 1].chunk_offset + 1;
+    if (run_count > max_run_count) return nullptr;
+  }
+  if (run_count > max_run_count) return nullptr;
+
+  const auto pos_ranges = make_pooled_shared<PosRanges>(memory_pool, chunk_id, memory_pool.get());
+  for (const auto& row_id : pos_list) pos_ranges->append(row_id.chunk_offset);
+  return pos_ranges;
+}
+
+std::shared_ptr<const PosRanges> compress_pos_list(const ChunkPosList& chunk_pos_list,
+                                                   const std::shared_ptr<MemoryPool>& memory_pool) {
+  // The runs were counted while the positions were added, so positions that do not qualify are not touched again
+  const auto& chunk_offsets = chunk_pos_list.chunk_offsets();
+  if (chunk_offsets.empty()) return nullptr;
+  if (chunk_pos_list.run_count() > chunk_offsets.size() / POS_RANGES_MIN_AVERAGE_RUN_LENGTH) return nullptr;
+
+  const auto pos_ranges = make_pooled_shared<PosRanges>(memory_pool, chunk_pos_list.chunk_id(), memory_pool.get());
+  for (const auto chunk_offset : chunk_offsets) pos_ranges->append(chunk_offset);
+  return pos_ranges;
+}
+
+}  // namespace opossum
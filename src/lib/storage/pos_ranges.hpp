@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class ChunkPosList;
+class MemoryPool;
+
+// A range-encoded alternative to a PosList for positions in a single chunk. Scans whose matches form long runs of
+// consecutive rows, e.g., on sorted data, store one range per run instead of one RowID per row (see
+// compress_pos_list and ReferenceSegment).
+class PosRanges : private Noncopyable {
+ public:
+  // the chunk offsets [begin, end)
+  struct Range {
+    ChunkOffset begin;
+    ChunkOffset end;
+  };
+
+  explicit PosRanges(const ChunkID chunk_id,
+                     std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  // Adds the position of a row. Positions that directly follow the last one extend its range.
+  void append(const ChunkOffset chunk_offset);
+
+  ChunkID chunk_id() const;
+
+  // returns the number of positions
+  size_t size() const;
+
+  const pmr_vector<Range>& ranges() const;
+
+  // returns the position of the first row of the range with the given index
+  size_t first_position(const size_t range_index) const;
+
+  // returns the RowID at the given position, which takes a binary search over the ranges
+  RowID operator[](const size_t position) const;
+
+  // returns the positions as RowIDs
+  PosList to_pos_list() const;
+
+  size_t memory_consumption() const;
+
+ protected:
+  const ChunkID _chunk_id;
+  pmr_vector<Range> _ranges;
+  pmr_vector<size_t> _first_positions;
+  size_t _size = 0;
+};
+
+// Ranges pay off once the runs are this long on average
+constexpr size_t POS_RANGES_MIN_AVERAGE_RUN_LENGTH = 4;
+
+// Returns the positions as PosRanges, allocated from the memory pool, if they are all in the same chunk and form runs
+// of at least POS_RANGES_MIN_AVERAGE_RUN_LENGTH rows on average. Returns nullptr otherwise.
+std::shared_ptr<const PosRanges> compress_pos_list(const PosList& pos_list,
+                                                   const std::shared_ptr<MemoryPool>& memory_pool);
+
+// The same for the chunk offsets that a TableScan wrote for a stored chunk. This uses the runs that the ChunkPosList
+// counted while the scan added the positions instead of looking for them again.
+std::shared_ptr<const PosRanges> compress_pos_list(const ChunkPosList& chunk_pos_list,
+                                                   const std::shared_ptr<MemoryPool>& memory_pool);
+
+}  // namespace opossum
@@ -2,6 +2,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -10,6 +11,7 @@
 #include "base_segment.hpp"
 #include "dictionary_segment.hpp"
 #include "table.hpp"
+#include "utils/memory_pool.hpp"
 #include "value_segment.hpp"
 
 namespace opossum {
@@ -19,14 +21,153 @@ namespace opossum {
 ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced_table,
                                    const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
     : _referenced_table{referenced_table}, _referenced_column_id{referenced_column_id}, _pos{pos} {}
+
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced_table,
+                                   const ColumnID referenced_column_id,
+                                   const std::shared_ptr<const PosRanges> pos_ranges)
+    : _referenced_table{referenced_table}, _referenced_column_id{referenced_column_id}, _pos_ranges{pos_ranges} {}
+
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced_table,
+                                   const ColumnID referenced_column_id,
+                                   const std::shared_ptr<const ChunkPosList> chunk_pos_list)
+    : _referenced_table{referenced_table},
+      _referenced_column_id{referenced_column_id},
+      _chunk_pos_list{chunk_pos_list} {}
+
 const AllTypeVariant ReferenceSegment::operator[](const size_t i) const {
   DebugAssert(i < _referenced_table->row_count(), "Index out of bounds");
-  RowID row{_pos->operator[](i)};
-  return _referenced_table->get_chunk(row.chunk_id).get_segment(_referenced_column_id)->operator[](row.chunk_offset);
+  RowID row{_pos_ranges ? (*_pos_ranges)[i] : _chunk_pos_list ? (*_chunk_pos_list)[i] : _pos->operator[](i)};
+  return _referenced_table->get_chunk(row.chunk_id)->get_segment(_referenced_column_id)->operator[](row.chunk_offset);
+}
+size_t ReferenceSegment::size() const {
+  if (_pos_ranges) return _pos_ranges->size();
+  if (_chunk_pos_list) return _chunk_pos_list->size();
+  return _pos->size();
+}
+size_t ReferenceSegment::memory_consumption() const {
+  if (_pos_ranges) return sizeof(*this) + _pos_ranges->memory_consumption();
+  if (_chunk_pos_list) return sizeof(*this) + _chunk_pos_list->memory_consumption();
+  return sizeof(*this) + _pos->capacity() * sizeof(RowID);
+}
+const std::shared_ptr<const PosList> ReferenceSegment::pos_list() const {
+  if (_pos_ranges) std::call_once(_pos_flag, [&]() { _pos = std::make_shared<PosList>(_pos_ranges->to_pos_list()); });
+  if (_chunk_pos_list) {
+    std::call_once(_pos_flag, [&]() { _pos = std::make_shared<PosList>(_chunk_pos_list->to_pos_list()); });
+  }
+  return _pos;
 }
-size_t ReferenceSegment::size() const { return _pos->size(); }
-const std::shared_ptr<const PosList> ReferenceSegment::pos_list() const { return _pos; }
+const std::shared_ptr<const PosRanges> ReferenceSegment::pos_ranges() const { return _pos_ranges; }
+const std::shared_ptr<const ChunkPosList> ReferenceSegment::chunk_pos_list() const { return _chunk_pos_list; }
 const std::shared_ptr<const Table> ReferenceSegment::referenced_table() const { return _referenced_table; }
 ColumnID ReferenceSegment::referenced_column_id() const { return _referenced_column_id; }
 
+namespace {
+
+// the positions of ReferenceSegments in the most compact form that holds them, only one of the pointers is set
+struct CompactPositions {
+  std::shared_ptr<const PosRanges> pos_ranges;
+  std::shared_ptr<const ChunkPosList> chunk_pos_list;
+  std::shared_ptr<const PosList> pos_list;
+};
+
+CompactPositions compact_positions(const std::shared_ptr<const PosList>& pos_list,
+                                   const std::shared_ptr<MemoryPool>& memory_pool) {
+  // Matches on sorted or clustered data form long runs, which are stored as ranges instead of one RowID per row. Other
+  // positions in a single chunk, which is the common case for scans, do not need to store the chunk id per row.
+  if (auto pos_ranges = compress_pos_list(*pos_list, memory_pool)) return {std::move(pos_ranges), nullptr, nullptr};
+  if (auto chunk_pos_list = make_chunk_pos_list(*pos_list, memory_pool)) {
+    return {nullptr, std::move(chunk_pos_list), nullptr};
+  }
+  return {nullptr, nullptr, pos_list};
+}
+
+std::shared_ptr<ReferenceSegment> make_reference_segment(const std::shared_ptr<const Table>& referenced_table,
+                                                         const ColumnID referenced_column_id,
+                                                         const CompactPositions& positions,
+                                                         const std::shared_ptr<MemoryPool>& memory_pool) {
+  if (positions.pos_ranges) {
+    return make_pooled_shared<ReferenceSegment>(memory_pool, referenced_table, referenced_column_id,
+                                                positions.pos_ranges);
+  }
+  if (positions.chunk_pos_list) {
+    return make_pooled_shared<ReferenceSegment>(memory_pool, referenced_table, referenced_column_id,
+                                                positions.chunk_pos_list);
+  }
+  return make_pooled_shared<ReferenceSegment>(memory_pool, referenced_table, referenced_column_id, positions.pos_list);
+}
+
+// calls the functor with the positions of the segment in the form in which the segment stores them
+template <typename Functor>
+void resolve_positions(const ReferenceSegment& segment, const Functor& functor) {
+  if (segment.pos_ranges()) {
+    functor(*segment.pos_ranges());
+  } else if (segment.chunk_pos_list()) {
+    functor(*segment.chunk_pos_list());
+  } else {
+    functor(*segment.pos_list());
+  }
+}
+
+}  // namespace
+
+void add_reference_segments(Chunk& chunk, const std::shared_ptr<const Table>& referenced_table,
+                            const uint16_t column_count, const std::shared_ptr<const PosList>& pos_list,
+                            const std::shared_ptr<MemoryPool>& memory_pool) {
+  const auto positions = compact_positions(pos_list, memory_pool);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    chunk.add_segment(make_reference_segment(referenced_table, column_id, positions, memory_pool));
+  }
+}
+
+void add_reference_segments(Chunk& chunk, const std::shared_ptr<const Table>& referenced_table,
+                            const uint16_t column_count, const std::shared_ptr<const ChunkPosList>& chunk_pos_list,
+                            const std::shared_ptr<MemoryPool>& memory_pool) {
+  const auto pos_ranges = compress_pos_list(*chunk_pos_list, memory_pool);
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (pos_ranges) {
+      chunk.add_segment(make_pooled_shared<ReferenceSegment>(memory_pool, referenced_table, column_id, pos_ranges));
+    } else {
+      chunk.add_segment(
+          make_pooled_shared<ReferenceSegment>(memory_pool, referenced_table, column_id, chunk_pos_list));
+    }
+  }
+}
+
+void add_reference_segments(Chunk& chunk, const Chunk& input_chunk, const std::vector<ChunkOffset>& positions,
+                            const std::shared_ptr<MemoryPool>& memory_pool) {
+  // The output positions of every distinct input positions, identified by the address of the latter
+  auto output_positions = std::unordered_map<const void*, CompactPositions>{};
+
+  for (auto column_id = ColumnID{0}; column_id < input_chunk.column_count(); ++column_id) {
+    const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(input_chunk.get_segment(column_id));
+    Assert(segment, "Chunk has to consist of ReferenceSegments");
+
+    const void* input_positions = nullptr;
+    resolve_positions(*segment, [&](const auto& segment_positions) { input_positions = &segment_positions; });
+
+    auto output_positions_iter = output_positions.find(input_positions);
+    if (output_positions_iter == output_positions.end()) {
+      const auto pos_list = make_pooled_pos_list(memory_pool);
+      pos_list->reserve(positions.size());
+      resolve_positions(*segment, [&](const auto& segment_positions) {
+        for (const auto position : positions) pos_list->emplace_back(segment_positions[position]);
+      });
+      output_positions_iter = output_positions.emplace(input_positions, compact_positions(pos_list, memory_pool)).first;
+    }
+
+    chunk.add_segment(make_reference_segment(segment->referenced_table(), segment->referenced_column_id(),
+                                             output_positions_iter->second, memory_pool));
+  }
+}
+
+PosList referenced_positions(const ReferenceSegment& segment, const std::vector<ChunkOffset>& positions) {
+  auto pos_list = PosList{};
+  pos_list.reserve(positions.size());
+  resolve_positions(segment, [&](const auto& segment_positions) {
+    for (const auto position : positions) pos_list.emplace_back(segment_positions[position]);
+  });
+  return pos_list;
+}
+
 }  // namespace opossum
@@ -2,13 +2,16 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "chunk_pos_list.hpp"
 #include "dictionary_segment.hpp"
+#include "pos_ranges.hpp"
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -16,7 +19,8 @@
 
 namespace opossum {
 
-// ReferenceSegment is a specific segment type that stores all its values as position list of a referenced segment
+// ReferenceSegment is a specific segment type that stores all its values as position list of a referenced segment.
+// The positions are a PosList, or, if they are all in one chunk, PosRanges (for long runs) or a ChunkPosList.
 class ReferenceSegment : public BaseSegment {
  public:
   // creates a reference segment
@@ -24,13 +28,30 @@ class ReferenceSegment : public BaseSegment {
   ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
                    const std::shared_ptr<const PosList> pos);
 
+  ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                   const std::shared_ptr<const PosRanges> pos_ranges);
+
+  ReferenceSegment(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                   const std::shared_ptr<const ChunkPosList> chunk_pos_list);
+
   const AllTypeVariant operator[](const size_t i) const override;
 
   void append(const AllTypeVariant&) override { throw std::logic_error("ReferenceSegment is immutable"); };
 
   size_t size() const override;
 
+  size_t memory_consumption() const override;
+
+  // Returns the positions as RowIDs. If the segment holds PosRanges or a ChunkPosList, the RowIDs are created on the
+  // first call, so consumers that read many rows should use the ReferenceSegmentIterable instead.
   const std::shared_ptr<const PosList> pos_list() const;
+
+  // returns the range-encoded positions or nullptr if the segment holds other positions
+  const std::shared_ptr<const PosRanges> pos_ranges() const;
+
+  // returns the chunk-local positions or nullptr if the segment holds other positions
+  const std::shared_ptr<const ChunkPosList> chunk_pos_list() const;
+
   const std::shared_ptr<const Table> referenced_table() const;
 
   ColumnID referenced_column_id() const;
@@ -38,7 +59,36 @@ class ReferenceSegment : public BaseSegment {
  protected:
   std::shared_ptr<const Table> _referenced_table;
   ColumnID _referenced_column_id;
-  std::shared_ptr<const PosList> _pos;
+  std::shared_ptr<const PosRanges> _pos_ranges;
+  std::shared_ptr<const ChunkPosList> _chunk_pos_list;
+
+  // created from the PosRanges or the ChunkPosList on demand
+  mutable std::shared_ptr<const PosList> _pos;
+  mutable std::once_flag _pos_flag;
 };
 
+class MemoryPool;
+
+// Adds a ReferenceSegment for each of the first column_count columns of the referenced table to the chunk. The segments
+// share the positions, which are stored as PosRanges or a ChunkPosList if possible. Positions and segments are
+// allocated from the memory pool.
+void add_reference_segments(Chunk& chunk, const std::shared_ptr<const Table>& referenced_table,
+                            const uint16_t column_count, const std::shared_ptr<const PosList>& pos_list,
+                            const std::shared_ptr<MemoryPool>& memory_pool);
+
+// the same for positions in a single chunk, which are stored as PosRanges if they form long runs
+void add_reference_segments(Chunk& chunk, const std::shared_ptr<const Table>& referenced_table,
+                            const uint16_t column_count, const std::shared_ptr<const ChunkPosList>& chunk_pos_list,
+                            const std::shared_ptr<MemoryPool>& memory_pool);
+
+// Adds a ReferenceSegment for each segment of the input chunk, which has to consist of ReferenceSegments, to the
+// chunk. Each one references what its input segment references at the given positions of the input chunk, so the
+// output columns keep referencing the tables and columns of the input columns, which might differ (e.g., for the
+// output of a JoinHash). Input segments that share their positions share them in the output as well.
+void add_reference_segments(Chunk& chunk, const Chunk& input_chunk, const std::vector<ChunkOffset>& positions,
+                            const std::shared_ptr<MemoryPool>& memory_pool);
+
+// returns the rows that the segment references at the given positions
+PosList referenced_positions(const ReferenceSegment& segment, const std::vector<ChunkOffset>& positions);
+
 }  // namespace opossum
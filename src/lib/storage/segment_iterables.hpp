@@ -0,0 +1,310 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "dictionary_segment.hpp"
+#include "chunk_pos_list.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "pos_ranges.hpp"
+#include "reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/gather.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+// the chunk offset of the positions of PosLists and ChunkPosLists, used by for_each_position
+inline ChunkOffset chunk_offset_of(const RowID& row_id) { return row_id.chunk_offset; }
+inline ChunkOffset chunk_offset_of(const ChunkOffset chunk_offset) { return chunk_offset; }
+
+/**
+ * Iterables give operators a loop over the values of a segment that is specialized for its encoding at compile time.
+ * Other than BaseSegment::operator[], they do not create an AllTypeVariant per value, and the encoding is only resolved
+ * once per segment instead of once per row.
+ *
+ * for_each calls the functor with every value and its position in the iterated segment:
+ *
+ *   segment_for_each<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) { ... });
+ *
+ * Operators that handle some encodings differently, e.g., to emit the RowIDs of a ReferenceSegment, resolve the
+ * segment themselves and create the iterable for it:
+ *
+ *   resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+ *     create_iterable<T>(typed_segment).for_each(...);
+ *   });
+ *
+ * Iterables of segments that hold values also offer for_each_position, for_each_in_range, and gather, which are used by
+ * the ReferenceSegmentIterable to access the positions that it references. A new encoding needs an iterable with
+ * these four methods, a create_iterable overload, and a case in resolve_segment_type.
+ */
+
+template <typename T>
+class ValueSegmentIterable {
+ public:
+  explicit ValueSegmentIterable(const ValueSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    const auto& values = _segment.values();
+    const auto size = static_cast<ChunkOffset>(_segment.size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      functor(values[chunk_offset], chunk_offset);
+    }
+  }
+
+  // Calls the functor with the values at the chunk offsets of the given RowIDs or ChunkOffsets. The position passed to
+  // the functor counts up from first_position.
+  template <typename Iterator, typename Functor>
+  void for_each_position(const Iterator begin, const Iterator end, ChunkOffset first_position,
+                         const Functor& functor) const {
+    const auto& values = _segment.values();
+    for (auto iter = begin; iter != end; ++iter) functor(values[chunk_offset_of(*iter)], first_position++);
+  }
+
+  // like for_each_position, for the chunk offsets [begin, end)
+  template <typename Functor>
+  void for_each_in_range(const ChunkOffset begin, const ChunkOffset end, ChunkOffset first_position,
+                         const Functor& functor) const {
+    const auto& values = _segment.values();
+    for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) functor(values[chunk_offset], first_position++);
+  }
+
+  // writes the values at the given chunk offsets to output, using SIMD gathers where possible
+  void gather(const ChunkOffset* chunk_offsets, const size_t count, T* output) const {
+    opossum::gather(_segment.values().data(), chunk_offsets, count, output);
+  }
+
+ protected:
+  const ValueSegment<T>& _segment;
+};
+
+template <typename T>
+class DictionarySegmentIterable {
+ public:
+  explicit DictionarySegmentIterable(const DictionarySegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    _resolve_value_ids([&](const auto& value_ids, const auto& dictionary) {
+      const auto size = static_cast<ChunkOffset>(value_ids.size());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+        functor(dictionary[value_ids[chunk_offset]], chunk_offset);
+      }
+    });
+  }
+
+  // see ValueSegmentIterable::for_each_position
+  template <typename Iterator, typename Functor>
+  void for_each_position(const Iterator begin, const Iterator end, ChunkOffset first_position,
+                         const Functor& functor) const {
+    _resolve_value_ids([&](const auto& value_ids, const auto& dictionary) {
+      for (auto iter = begin; iter != end; ++iter) {
+        functor(dictionary[value_ids[chunk_offset_of(*iter)]], first_position++);
+      }
+    });
+  }
+
+  // see ValueSegmentIterable::for_each_in_range
+  template <typename Functor>
+  void for_each_in_range(const ChunkOffset begin, const ChunkOffset end, ChunkOffset first_position,
+                         const Functor& functor) const {
+    _resolve_value_ids([&](const auto& value_ids, const auto& dictionary) {
+      for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+        functor(dictionary[value_ids[chunk_offset]], first_position++);
+      }
+    });
+  }
+
+  // Writes the values at the given chunk offsets to output. The value ids of a batch are gathered first and then
+  // decoded with a second gather from the dictionary.
+  void gather(const ChunkOffset* chunk_offsets, const size_t count, T* output) const {
+    _resolve_value_ids([&](const auto& value_ids, const auto& dictionary) {
+      // Narrow value ids are widened, so that the dictionary can be gathered with 32-bit indices
+      using ValueIdType = typename std::decay_t<decltype(value_ids)>::value_type;
+      using IndexType = std::conditional_t<sizeof(ValueIdType) <= sizeof(uint32_t), uint32_t, ValueIdType>;
+
+      auto indices = std::array<IndexType, GATHER_BATCH_SIZE>{};
+      for (auto batch_begin = size_t{0}; batch_begin < count; batch_begin += GATHER_BATCH_SIZE) {
+        const auto batch_size = std::min(GATHER_BATCH_SIZE, count - batch_begin);
+        opossum::gather(value_ids.data(), chunk_offsets + batch_begin, batch_size, indices.data());
+        opossum::gather(dictionary.data(), indices.data(), batch_size, output + batch_begin);
+      }
+    });
+  }
+
+ protected:
+  // passes the value ids of the width that the segment uses, as well as the dictionary, on to the functor
+  template <typename Functor>
+  void _resolve_value_ids(const Functor& functor) const {
+    const auto& dictionary = *_segment.dictionary();
+    const auto& attribute_vector = *_segment.attribute_vector();
+    switch (attribute_vector.width()) {
+      case 1:
+        functor(static_cast<const FittedAttributeVector<uint8_t>&>(attribute_vector).value_ids(), dictionary);
+        return;
+      case 2:
+        functor(static_cast<const FittedAttributeVector<uint16_t>&>(attribute_vector).value_ids(), dictionary);
+        return;
+      case 4:
+        functor(static_cast<const FittedAttributeVector<uint32_t>&>(attribute_vector).value_ids(), dictionary);
+        return;
+      case 8:
+        functor(static_cast<const FittedAttributeVector<uint64_t>&>(attribute_vector).value_ids(), dictionary);
+        return;
+    }
+    Fail("Unknown attribute vector width");
+  }
+
+  const DictionarySegment<T>& _segment;
+};
+
+template <typename T>
+class ReferenceSegmentIterable;
+
+template <typename T>
+ValueSegmentIterable<T> create_iterable(const ValueSegment<T>& segment) {
+  return ValueSegmentIterable<T>{segment};
+}
+
+template <typename T>
+DictionarySegmentIterable<T> create_iterable(const DictionarySegment<T>& segment) {
+  return DictionarySegmentIterable<T>{segment};
+}
+
+template <typename T>
+ReferenceSegmentIterable<T> create_iterable(const ReferenceSegment& segment) {
+  return ReferenceSegmentIterable<T>{segment};
+}
+
+// Iterates over the referenced values in the order of the pos list. Positions are usually grouped by chunk, so the
+// referenced segment is resolved once per run of positions in the same chunk, and the run is handed to the iterable
+// of the referenced segment.
+template <typename T>
+class ReferenceSegmentIterable {
+ public:
+  explicit ReferenceSegmentIterable(const ReferenceSegment& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    if (_segment.pos_ranges()) {
+      _for_each_in_ranges(*_segment.pos_ranges(), functor);
+      return;
+    }
+    if (_segment.chunk_pos_list()) {
+      _for_each_in_chunk(*_segment.chunk_pos_list(), functor);
+      return;
+    }
+
+    _for_each_run([&](const auto& iterable, const auto run_begin, const auto run_end, const ChunkOffset run_position) {
+      iterable.for_each_position(run_begin, run_end, run_position, functor);
+    });
+  }
+
+  // Appends the referenced values to values. Other than for_each, the values of a run of positions in the same chunk
+  // are gathered from the referenced segment in bulk (see gather).
+  void materialize(std::vector<T>& values) const {
+    const auto first_position = values.size();
+    values.resize(first_position + _segment.size());
+    const auto output = values.data() + first_position;
+
+    if (_segment.pos_ranges()) {
+      // Ranges are copied sequentially anyway
+      _for_each_in_ranges(*_segment.pos_ranges(),
+                          [&](const T& value, const ChunkOffset position) { output[position] = value; });
+      return;
+    }
+    if (_segment.chunk_pos_list()) {
+      const auto& chunk_pos_list = *_segment.chunk_pos_list();
+      _resolve_referenced_segment(chunk_pos_list.chunk_id(), [&](const auto& iterable) {
+        iterable.gather(chunk_pos_list.chunk_offsets().data(), chunk_pos_list.size(), output);
+      });
+      return;
+    }
+
+    // The chunk offsets of the RowIDs are copied to a buffer, batch by batch
+    auto chunk_offsets = std::array<ChunkOffset, GATHER_BATCH_SIZE>{};
+    _for_each_run([&](const auto& iterable, const auto run_begin, const auto run_end, const ChunkOffset run_position) {
+      const auto run_size = static_cast<size_t>(std::distance(run_begin, run_end));
+      for (auto batch_begin = size_t{0}; batch_begin < run_size; batch_begin += GATHER_BATCH_SIZE) {
+        const auto batch_size = std::min(GATHER_BATCH_SIZE, run_size - batch_begin);
+        std::transform(run_begin + batch_begin, run_begin + batch_begin + batch_size, chunk_offsets.begin(),
+                       [](const RowID& row_id) { return row_id.chunk_offset; });
+        iterable.gather(chunk_offsets.data(), batch_size, output + run_position + batch_begin);
+      }
+    });
+  }
+
+ protected:
+  // PosRanges reference a single chunk, so the referenced segment is resolved only once
+  template <typename Functor>
+  void _for_each_in_ranges(const PosRanges& pos_ranges, const Functor& functor) const {
+    _resolve_referenced_segment(pos_ranges.chunk_id(), [&](const auto& iterable) {
+      const auto& ranges = pos_ranges.ranges();
+      for (auto range_index = size_t{0}; range_index < ranges.size(); ++range_index) {
+        const auto first_position = static_cast<ChunkOffset>(pos_ranges.first_position(range_index));
+        iterable.for_each_in_range(ranges[range_index].begin, ranges[range_index].end, first_position, functor);
+      }
+    });
+  }
+
+  template <typename Functor>
+  void _for_each_in_chunk(const ChunkPosList& chunk_pos_list, const Functor& functor) const {
+    _resolve_referenced_segment(chunk_pos_list.chunk_id(), [&](const auto& iterable) {
+      const auto& chunk_offsets = chunk_pos_list.chunk_offsets();
+      iterable.for_each_position(chunk_offsets.cbegin(), chunk_offsets.cend(), ChunkOffset{0}, functor);
+    });
+  }
+
+  // Splits the pos list into runs of positions in the same chunk and passes the iterable of the referenced segment,
+  // the run, and the position of its first row on to the functor
+  template <typename Functor>
+  void _for_each_run(const Functor& functor) const {
+    const auto& pos_list = *_segment.pos_list();
+
+    auto run_begin = pos_list.cbegin();
+    while (run_begin != pos_list.cend()) {
+      const auto chunk_id = run_begin->chunk_id;
+      auto run_end = run_begin;
+      while (run_end != pos_list.cend() && run_end->chunk_id == chunk_id) ++run_end;
+
+      const auto first_position = static_cast<ChunkOffset>(std::distance(pos_list.cbegin(), run_begin));
+      _resolve_referenced_segment(chunk_id,
+                                  [&](const auto& iterable) { functor(iterable, run_begin, run_end, first_position); });
+
+      run_begin = run_end;
+    }
+  }
+
+  // Passes the iterable of the referenced segment in the given chunk on to the functor. The chunk is held, so that it
+  // stays alive if it is compressed in the meantime.
+  template <typename Functor>
+  void _resolve_referenced_segment(const ChunkID chunk_id, const Functor& functor) const {
+    const auto referenced_chunk = _segment.referenced_table()->get_chunk(chunk_id);
+    const auto& referenced_segment = *referenced_chunk->get_segment(_segment.referenced_column_id());
+    resolve_segment_type<T>(referenced_segment, [&](const auto& typed_segment) {
+      using SegmentType = std::decay_t<decltype(typed_segment)>;
+      if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+        Fail("ReferenceSegments can only reference Value/DictionarySegments");
+      } else {
+        functor(create_iterable<T>(typed_segment));
+      }
+    });
+  }
+
+  const ReferenceSegment& _segment;
+};
+
+// calls the functor with every value of the segment and its chunk offset, T has to be the data type of the segment
+template <typename T, typename Functor>
+void segment_for_each(const BaseSegment& segment, const Functor& functor) {
+  resolve_segment_type<T>(segment,
+                          [&](const auto& typed_segment) { create_iterable<T>(typed_segment).for_each(functor); });
+}
+
+}  // namespace opossum
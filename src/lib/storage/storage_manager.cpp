@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -11,47 +12,66 @@
 
 namespace opossum {
 
+StorageManager::~StorageManager() { delete _tables.load(); }
+
 StorageManager& StorageManager::get() {
   static StorageManager singleton_instance;
   return singleton_instance;
 }
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  _tables[name] = std::move(table);
+  std::lock_guard<std::mutex> lock(_ddl_mutex);
+  auto tables = new TableMap(*_tables.load());
+  (*tables)[name] = std::move(table);
+  _publish_tables(tables);
 }
 
 void StorageManager::drop_table(const std::string& name) {
-  auto result = _tables.erase(name);
+  std::lock_guard<std::mutex> lock(_ddl_mutex);
+  auto tables = new TableMap(*_tables.load());
+  auto result = tables->erase(name);
   DebugAssert(result == 1, "Table '" + name + "' not found");
+  _publish_tables(tables);
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
-  DebugAssert(has_table(name), "Table " + name + " does not exist");
-  // Fun fact: <map>.operator[] is no 'const' operator and therefore cannot be used here
-  return _tables.at(name);
+  // Look the table up in a single version of the catalog, as it might be dropped between two loads
+  const auto guard = RetireList<TableMap>::ReadGuard{_retire_list};
+  const auto& tables = _load_tables();
+  const auto iter = tables.find(name);
+  Assert(iter != tables.cend(), "Table " + name + " does not exist");
+  return iter->second;
 }
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.count(name) != 0; }
+bool StorageManager::has_table(const std::string& name) const {
+  const auto guard = RetireList<TableMap>::ReadGuard{_retire_list};
+  return _load_tables().count(name) != 0;
+}
 
 std::vector<std::string> StorageManager::table_names() const {
+  const auto guard = RetireList<TableMap>::ReadGuard{_retire_list};
+  const auto& tables = _load_tables();
   std::vector<std::string> names;
 
-  names.reserve(_tables.size());
+  names.reserve(tables.size());
 
-  std::transform(_tables.cbegin(), _tables.cend(), std::back_inserter(names),
+  std::transform(tables.cbegin(), tables.cend(), std::back_inserter(names),
                  [](auto const& tables_map_entry) { return tables_map_entry.first; });
 
   return names;
 }
 
 void StorageManager::print(std::ostream& out) const {
+  const auto guard = RetireList<TableMap>::ReadGuard{_retire_list};
+  const auto& tables = _load_tables();
+
   // header
   out << "-----------------------------------------------" << std::endl
       << "| Name | #Columns | #Rows | #Chunks |" << std::endl
       << "-----------------------------------------------" << std::endl;
 
   // content
-  std::for_each(_tables.cbegin(), _tables.cend(), [&out](auto const& tables_map_entry) {
+  std::for_each(tables.cbegin(), tables.cend(), [&out](auto const& tables_map_entry) {
     auto table = tables_map_entry.second;
     out << "| " << tables_map_entry.first << " | " << table->column_count() << " | " << table->row_count() << " | "
         << table->chunk_count() << " |" << std::endl;
@@ -61,5 +81,14 @@ void StorageManager::print(std::ostream& out) const {
   out << "-----------------------------------------------" << std::endl;
 }
 
-void StorageManager::reset() { get() = StorageManager(); }
+void StorageManager::reset() {
+  auto& storage_manager = get();
+  std::lock_guard<std::mutex> lock(storage_manager._ddl_mutex);
+  storage_manager._publish_tables(new TableMap{});
+}
+
+const StorageManager::TableMap& StorageManager::_load_tables() const { return *_tables.load(); }
+
+void StorageManager::_publish_tables(const TableMap* tables) { _retire_list.retire(_tables.exchange(tables)); }
+
 }  // namespace opossum
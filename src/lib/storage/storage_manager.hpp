@@ -1,19 +1,27 @@
 #pragma once
 
+#include <atomic>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "storage/table.hpp"
 #include "types.hpp"
+#include "utils/retire_list.hpp"
 
 namespace opossum {
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+//
+// The catalog is copy-on-write: add_table and drop_table are serialized, copy the map, publish the new version through
+// an atomic pointer, and retire the previous one (see RetireList). Readers load the pointer and look tables up under
+// a ReadGuard, so they never take a lock. Tables are handed out as shared_ptrs, so a table that is dropped stays alive
+// until the last query that looked it up releases it.
 class StorageManager : private Noncopyable {
  public:
   static StorageManager& get();
@@ -36,14 +44,25 @@ class StorageManager : private Noncopyable {
   // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
   void print(std::ostream& out = std::cout) const;
 
-  // deletes the entire StorageManager and creates a new one, used especially in tests
+  // removes all tables from the StorageManager, used especially in tests
   static void reset();
 
-  StorageManager(StorageManager&&) = delete;
-
  protected:
-  StorageManager() {}
-  StorageManager& operator=(StorageManager&&) = default;
-  std::unordered_map<std::string, std::shared_ptr<Table>> _tables;
+  using TableMap = std::unordered_map<std::string, std::shared_ptr<Table>>;
+
+  StorageManager() = default;
+
+  ~StorageManager();
+
+  // Returns the current version of the catalog, which is not affected by later DDL. It is only valid as long as the
+  // caller holds a ReadGuard.
+  const TableMap& _load_tables() const;
+
+  // publishes a new version of the catalog, _ddl_mutex has to be held
+  void _publish_tables(const TableMap* tables);
+
+  RetireList<TableMap> _retire_list;
+  std::atomic<const TableMap*> _tables{new TableMap{}};
+  std::mutex _ddl_mutex;
 };
 }  // namespace opossum
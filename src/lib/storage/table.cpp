@@ -6,32 +6,37 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "bloom_filter.hpp"
+#include "concurrency/transaction_context.hpp"
 #include "dictionary_segment.hpp"
+#include "index/adaptive_radix_tree/adaptive_radix_tree_table_index.hpp"
+#include "index/cracker/cracker_index.hpp"
+#include "mvcc_data.hpp"
 #include "value_segment.hpp"
 
 #include "resolve_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/tracer.hpp"
 
 namespace opossum {
 
-std::mutex chunks_mutex;
-
 Table::Table(const uint32_t chunk_size) {
   _max_chunk_size = chunk_size;
-  _chunks.push_back(std::make_shared<Chunk>());
+  _add_append_chunk();
 }
 
-void Table::add_column_definition(const std::string& name, const std::string& type) {
+void Table::add_column_definition(const std::string& name, const DataType type) {
   _column_names.push_back(name);
   _column_types.push_back(type);
 }
 
-void Table::add_column(const std::string& name, const std::string& type) {
-  DebugAssert(_chunks.front()->size() == 0, "Tried to add column to a non empty table");
+void Table::add_column(const std::string& name, const DataType type) {
+  DebugAssert(_chunks.get(ChunkID{0})->size() == 0, "Tried to add column to a non empty table");
 
   _column_names.push_back(name);
   _column_types.push_back(type);
@@ -39,33 +44,171 @@ void Table::add_column(const std::string& name, const std::string& type) {
   _chunks.back()->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type));
 }
 
-void Table::append(std::vector<AllTypeVariant> values) {
-  std::lock_guard<std::mutex> lock(chunks_mutex);
+void Table::append(std::vector<AllTypeVariant> values) { _append(values, nullptr); }
+
+void Table::append(std::vector<AllTypeVariant> values, TransactionContext& transaction_context) {
+  _append(values, &transaction_context);
+}
+
+void Table::_append(const std::vector<AllTypeVariant>& values, TransactionContext* transaction_context) {
+  DebugAssert(values.size() == column_count(), "Incorrect number of columns");
+
+  // A reserved row has to be written, as the rows after it only become visible once it is. So the values are
+  // converted, which throws if one does not match its column, before a row is reserved (see Chunk::write_row).
+  auto row = std::vector<AllTypeVariant>{};
+  row.reserve(values.size());
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    resolve_data_type(_column_types[column_id], [&](auto data_type) {
+      using Type = typename decltype(data_type)::type;
+      row.emplace_back(type_cast<Type>(values[column_id]));
+    });
+  }
 
-  if (_chunks.back()->size() >= _max_chunk_size) {
-    // latest chunk is full
-    const auto new_chunk = std::make_shared<Chunk>();
-    for (const auto& type : _column_types) {
-      new_chunk->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type));
+  // Rows are written into the preallocated chunk without locking, unless table indexes have to be maintained. The
+  // flag is checked again after every failed reservation. A row that was reserved before the first table index was
+  // created is written here nevertheless, create_table_index waits for it and indexes it.
+  auto append_chunk = std::atomic_load(&_append_chunk);
+  while (append_chunk && !_has_table_indexes.load()) {
+    const auto chunk_offset = append_chunk->reserve_row();
+    if (chunk_offset != INVALID_CHUNK_OFFSET) {
+      _write_row(*append_chunk, chunk_offset, row, transaction_context);
+      return;
     }
+    append_chunk = _roll_over_append_chunk(append_chunk);
+  }
+
+  std::lock_guard<std::mutex> lock(_append_mutex);
+
+  auto chunk = _chunks.back();
+  auto chunk_offset = chunk->is_preallocated() ? chunk->reserve_row() : INVALID_CHUNK_OFFSET;
+  if (chunk_offset == INVALID_CHUNK_OFFSET) {
+    // latest chunk is full, does not take rows anymore (see create_table_index), or was emplaced
+    chunk = _make_room_for_rows();
+    chunk_offset = chunk->reserve_row();
+  }
+
+  _write_row(*chunk, chunk_offset, row, transaction_context);
+
+  if (!_table_indexes.empty()) {
+    const auto row_id = RowID{ChunkID{_chunks.size() - 1}, chunk_offset};
+    for (const auto& [column_id, table_index] : _table_indexes) {
+      table_index->insert(row[column_id], row_id);
+    }
+  }
+}
+
+void Table::_write_row(Chunk& chunk, const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values,
+                       TransactionContext* transaction_context) {
+  if (transaction_context) {
+    // The row has to be marked as uncommitted before it becomes visible
+    const auto mvcc_data = chunk.mvcc_data();
+    Assert(mvcc_data, "Transactions can only append to chunks with MVCC columns, i.e., not to emplaced ones");
+    mvcc_data->set_begin_commit_id(chunk_offset, MAX_COMMIT_ID);
+    mvcc_data->set_transaction_id(chunk_offset, transaction_context->transaction_id());
+    mvcc_data->set_modified();
+    transaction_context->register_insert(mvcc_data, chunk_offset);
+  }
+
+  chunk.write_row(chunk_offset, values);
+}
+
+bool Table::delete_row(const RowID row_id, TransactionContext& transaction_context) {
+  const auto chunk = get_chunk(row_id.chunk_id);
+  const auto mvcc_data = chunk->mvcc_data();
+  Assert(mvcc_data, "Transactions require chunks with MVCC columns, i.e., chunks created by append");
+  DebugAssert(row_id.chunk_offset < chunk->size() && mvcc_data->is_visible(transaction_context.snapshot(),
+                                                                           row_id.chunk_offset),
+              "Row is not visible to the transaction");
+
+  // Another transaction that holds the row either deletes it or has not committed its insert yet
+  if (!mvcc_data->try_lock(row_id.chunk_offset, transaction_context.transaction_id())) return false;
+
+  mvcc_data->set_modified();
+  transaction_context.register_delete(mvcc_data, row_id.chunk_offset);
+  return true;
+}
+
+std::shared_ptr<Chunk> Table::_roll_over_append_chunk(const std::shared_ptr<Chunk>& full_chunk) {
+  std::lock_guard<std::mutex> lock(_append_mutex);
+
+  // another writer might have created the next chunk while we waited for the lock
+  const auto append_chunk = std::atomic_load(&_append_chunk);
+  if (append_chunk != full_chunk) return append_chunk;
+
+  _make_room_for_rows();
+  return std::atomic_load(&_append_chunk);
+}
+
+std::shared_ptr<Chunk> Table::_make_room_for_rows() {
+  const auto last_chunk = _chunks.back();
+  if (!last_chunk->is_preallocated()) {
+    _add_append_chunk();
+    return _chunks.back();
+  }
+
+  // Writers that reserved rows in the append chunk might still be writing them, and the copy has to include them. If
+  // the last chunk is not the append chunk, only writers that held _append_mutex added rows to it.
+  if (std::atomic_load(&_append_chunk) == last_chunk) {
+    const auto reserved_row_count = last_chunk->stop_reservations();
+    while (last_chunk->size() < reserved_row_count) std::this_thread::yield();
+  }
+  const auto row_count = last_chunk->size();
+
+  // A chunk that stopped taking rows before it was full (see create_table_index) is continued in a copy of the same
+  // capacity, since the writers that might still try to reserve rows in it must not succeed
+  auto capacity = uint64_t{last_chunk->capacity()};
+  if (row_count == capacity) {
+    if (capacity >= _max_chunk_size) {
+      _add_append_chunk();
+      return _chunks.back();
+    }
+    capacity = std::min(capacity * 2, uint64_t{_max_chunk_size});
+  }
+
+  const auto chunk = last_chunk->copy_with_capacity(static_cast<ChunkOffset>(capacity));
+  for (const auto& column_id : _cracked_column_ids) {
+    chunk->create_index<CrackerIndex>(column_id);
+  }
+
+  // readers that still use the previous chunk keep it alive, its rows do not change anymore
+  _chunks.replace(ChunkID{_chunks.size() - 1}, chunk);
+  _publish_append_chunk(chunk);
+  return chunk;
+}
 
-    _chunks.push_back(new_chunk);
+void Table::_add_append_chunk() {
+  const auto chunk = std::make_shared<Chunk>();
+  chunk->preallocate(std::clamp(_max_chunk_size, 1u, INITIAL_APPEND_CHUNK_CAPACITY));
+  // the MVCC columns only allocate memory for rows that transactions touch
+  chunk->set_mvcc_data(std::make_shared<MvccData>(_max_chunk_size));
+
+  for (const auto& type : _column_types) {
+    chunk->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type));
+  }
+  for (const auto& column_id : _cracked_column_ids) {
+    chunk->create_index<CrackerIndex>(column_id);
   }
 
-  _chunks.back()->append(values);
+  _chunks.push_back(chunk);
+  _publish_append_chunk(chunk);
+}
+
+void Table::_publish_append_chunk(const std::shared_ptr<Chunk>& chunk) {
+  std::atomic_store(&_append_chunk, _has_table_indexes.load() ? std::shared_ptr<Chunk>{} : chunk);
 }
 
 uint16_t Table::column_count() const { return static_cast<uint16_t>(_column_names.size()); }
 
 uint64_t Table::row_count() const {
   uint64_t count = 0;
-  for (const auto& chunk : _chunks) {
-    count += chunk->size();
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    count += _chunks.get(chunk_id)->size();
   }
   return count;
 }
 
-ChunkID Table::chunk_count() const { return ChunkID{static_cast<uint32_t>(_chunks.size())}; }
+ChunkID Table::chunk_count() const { return _chunks.size(); }
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   auto const search_iter = std::find(_column_names.cbegin(), _column_names.cend(), column_name);
@@ -79,14 +222,20 @@ const std::vector<std::string>& Table::column_names() const { return _column_nam
 
 const std::string& Table::column_name(ColumnID column_id) const { return _column_names[column_id]; }
 
-const std::string& Table::column_type(ColumnID column_id) const { return _column_types[column_id]; }
+DataType Table::column_type(ColumnID column_id) const { return _column_types[column_id]; }
 
-Chunk& Table::get_chunk(ChunkID chunk_id) { return *_chunks[chunk_id]; }
+std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) { return _chunks.get(chunk_id); }
 
-const Chunk& Table::get_chunk(ChunkID chunk_id) const { return *_chunks[chunk_id]; }
+std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const { return _chunks.get(chunk_id); }
+
+void Table::set_bloom_filter_bits_per_value(const uint32_t bits_per_value) {
+  _bloom_filter_bits_per_value = bits_per_value;
+}
 
 void Table::compress_chunk(ChunkID chunk_id) {
-  auto& uncompressed_chunk = _lock_chunk_for_compression(chunk_id);
+  const auto trace_scope =
+      TraceScope{"compression", Tracer::is_enabled() ? "compress chunk " + std::to_string(chunk_id) : std::string{}};
+  const auto uncompressed_chunk = _lock_chunk_for_compression(chunk_id);
 
   const auto compressed_chunk = std::make_shared<Chunk>();
 
@@ -94,20 +243,44 @@ void Table::compress_chunk(ChunkID chunk_id) {
     const auto type = column_type(column_id);
     compressed_chunk->add_segment(
         make_shared_by_data_type<BaseSegment, DictionarySegment>(type, uncompressed_chunk->get_segment(column_id)));
+
+    if (_bloom_filter_bits_per_value > 0) {
+      // The dictionary holds every distinct value exactly once, which is all the filter needs
+      resolve_data_type(type, [&](auto data_type) {
+        using Type = typename decltype(data_type)::type;
+        const auto& dictionary =
+            *std::static_pointer_cast<const DictionarySegment<Type>>(compressed_chunk->get_segment(column_id))
+                 ->dictionary();
+
+        const auto bloom_filter = std::make_shared<BloomFilter>(dictionary.size(), _bloom_filter_bits_per_value);
+        for (const auto& value : dictionary) bloom_filter->insert(value);
+        compressed_chunk->set_bloom_filter(column_id, bloom_filter);
+      });
+    }
+  }
+
+  // Indexes only store chunk offsets, which are not changed by the compression, so they stay valid
+  for (const auto& [column_id, index] : uncompressed_chunk->indices()) {
+    if (index->type() == SegmentIndexType::Cracker) continue;
+    compressed_chunk->add_index(column_id, index);
   }
 
-  // no mutex needed - operation is atomic
-  uncompressed_chunk = compressed_chunk;
+  // Compression does not change the chunk offsets, so the MVCC columns stay valid. Transactions may still delete rows.
+  compressed_chunk->set_mvcc_data(uncompressed_chunk->mvcc_data());
+
+  // readers that still use the uncompressed chunk keep it alive
+  _chunks.replace(chunk_id, compressed_chunk);
 }
 
-std::shared_ptr<Chunk>& Table::_lock_chunk_for_compression(ChunkID chunk_id) {
+std::shared_ptr<Chunk> Table::_lock_chunk_for_compression(ChunkID chunk_id) {
   static std::mutex _compression_start;
   std::lock_guard<std::mutex> compression_lock(_compression_start);
 
-  auto& uncompressed_chunk = _chunks[chunk_id];
+  const auto uncompressed_chunk = _chunks.get(chunk_id);
 
   // checks are delayed until here to get advantage of the locked mutex to prevent race conditions
-  DebugAssert(uncompressed_chunk->size() >= _max_chunk_size, "Chunk is not full");
+  // chunks before the last one are not appended to anymore, even if they are not full (see create_table_index)
+  DebugAssert(uncompressed_chunk->size() >= _max_chunk_size || chunk_id + 1u < chunk_count(), "Chunk is not full");
 
   // could be set to Assert, but, anyway, hurting this assert only results in worse performance, not an error
   DebugAssert(!uncompressed_chunk->compression_started(), "Chunk is already getting compressed");
@@ -117,11 +290,68 @@ std::shared_ptr<Chunk>& Table::_lock_chunk_for_compression(ChunkID chunk_id) {
 }
 
 void Table::emplace_chunk(Chunk chunk) {
-  if (_chunks[0]->size() == 0) {
-    _chunks[0] = std::make_shared<Chunk>(std::move(chunk));
+  std::lock_guard<std::mutex> lock(_append_mutex);
+
+  if (_chunks.get(ChunkID{0})->size() == 0) {
+    _chunks.replace(ChunkID{0}, std::make_shared<Chunk>(std::move(chunk)));
   } else {
     _chunks.push_back(std::make_shared<Chunk>(std::move(chunk)));
   }
+
+  // rows appended later on go to the emplaced chunk or to a new one, but not to the previous append chunk
+  std::atomic_store(&_append_chunk, std::shared_ptr<Chunk>{});
+
+  const auto chunk_id = ChunkID{_chunks.size() - 1};
+  for (const auto& [column_id, table_index] : _table_indexes) {
+    table_index->insert_segment(*_chunks.back()->get_segment(column_id), chunk_id);
+  }
+}
+
+std::shared_ptr<const AdaptiveRadixTreeTableIndex> Table::create_table_index(ColumnID column_id) {
+  std::lock_guard<std::mutex> lock(_append_mutex);
+  DebugAssert(!get_table_index(column_id), "Column is already indexed");
+
+  // From now on, appends take the lock and insert their rows into the table indexes. Writers that reserved a row in
+  // the append chunk before do not, so the chunk stops taking rows and is only indexed once they are written.
+  if (!_has_table_indexes.exchange(true)) {
+    const auto append_chunk = std::atomic_exchange(&_append_chunk, std::shared_ptr<Chunk>{});
+    if (append_chunk) {
+      const auto reserved_row_count = append_chunk->stop_reservations();
+      while (append_chunk->size() < reserved_row_count) std::this_thread::yield();
+    }
+  }
+
+  const auto table_index = std::make_shared<AdaptiveRadixTreeTableIndex>(column_type(column_id));
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    table_index->insert_segment(*_chunks.get(chunk_id)->get_segment(column_id), chunk_id);
+  }
+
+  std::unique_lock<std::shared_mutex> table_indexes_lock(_table_indexes_mutex);
+  _table_indexes.emplace_back(column_id, table_index);
+  return table_index;
+}
+
+std::shared_ptr<const AdaptiveRadixTreeTableIndex> Table::get_table_index(ColumnID column_id) const {
+  std::shared_lock<std::shared_mutex> lock(_table_indexes_mutex);
+  for (const auto& [indexed_column_id, table_index] : _table_indexes) {
+    if (indexed_column_id == column_id) return table_index;
+  }
+  return nullptr;
+}
+
+void Table::enable_cracking(ColumnID column_id) {
+  std::lock_guard<std::mutex> lock(_append_mutex);
+  DebugAssert(std::find(_cracked_column_ids.cbegin(), _cracked_column_ids.cend(), column_id) ==
+                  _cracked_column_ids.cend(),
+              "Cracking is already enabled for this column");
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    const auto chunk = _chunks.get(chunk_id);
+    if (std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(column_id))) continue;
+    chunk->create_index<CrackerIndex>(column_id);
+  }
+
+  _cracked_column_ids.push_back(column_id);
 }
 
 }  // namespace opossum
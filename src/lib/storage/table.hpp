@@ -1,5 +1,9 @@
 #pragma once
 
+// the linter wants this to be above everything else
+#include <shared_mutex>
+
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
@@ -8,8 +12,10 @@
 #include <utility>
 #include <vector>
 
+#include "all_type_variant.hpp"
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "chunk_vector.hpp"
 
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -17,37 +23,39 @@
 
 namespace opossum {
 
+class AdaptiveRadixTreeTableIndex;
 class TableStatistics;
+class TransactionContext;
 
 // A table is partitioned horizontally into a number of chunks
 class Table : private Noncopyable {
  public:
+  // The chunks that append fills are preallocated with room for this many rows (or the chunk size, if it is smaller).
+  // Whenever such a chunk is full, it is replaced by a copy with twice the capacity until it reaches the chunk size, so
+  // that small tables do not allocate the full chunk size up front.
+  static constexpr uint32_t INITIAL_APPEND_CHUNK_CAPACITY = 1u << 10;
+
   // creates a table
   // the parameter specifies the maximum chunk size, i.e., partition size
   // default is the maximum chunk size minus 1. A table holds always at least one chunk
   explicit Table(const uint32_t chunk_size = std::numeric_limits<ChunkOffset>::max() - 1);
 
-  // we need to explicitly set the move constructor to default when
-  // we overwrite the copy constructor
-  Table(Table&&) = default;
-  Table& operator=(Table&&) = default;
-
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   uint16_t column_count() const;
 
   // Returns the number of rows.
-  // This number includes invalidated (deleted) rows.
-  // Use approx_valid_row_count() for an approximate count of valid rows instead.
+  // This number includes invalidated (deleted) rows and rows of transactions that did not commit (see MvccData).
   uint64_t row_count() const;
 
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
-  // returns the chunk with the given id
-  Chunk& get_chunk(ChunkID chunk_id);
-  const Chunk& get_chunk(ChunkID chunk_id) const;
+  // Returns the chunk with the given id. This is safe while other threads append rows or compress chunks: a chunk
+  // that is replaced by its compressed version stays alive as long as the returned pointer.
+  std::shared_ptr<Chunk> get_chunk(ChunkID chunk_id);
+  std::shared_ptr<const Chunk> get_chunk(ChunkID chunk_id) const;
 
-  // Adds a chunk to the table. If the first chunk is empty, it is replaced.
+  // Adds a chunk to the table. If the first chunk is empty, it is replaced. Later appends go to a new chunk.
   void emplace_chunk(Chunk chunk);
 
   // Returns a list of all column names.
@@ -57,7 +65,7 @@ class Table : private Noncopyable {
   const std::string& column_name(ColumnID column_id) const;
 
   // returns the column type of the nth column
-  const std::string& column_type(ColumnID column_id) const;
+  DataType column_type(ColumnID column_id) const;
 
   // Returns the column with the given name.
   // This method is intended for debugging purposes only.
@@ -70,29 +78,100 @@ class Table : private Noncopyable {
   // adds column definition without creating the actual columns
   // this is helpful when, e.g., an operator first creates the structure of the table
   // and then adds chunk by chunk
-  void add_column_definition(const std::string& name, const std::string& type);
+  void add_column_definition(const std::string& name, const DataType type);
 
   // adds a column to the end, i.e., right, of the table
   // this can only be done if the table does not yet have any entries, because we would otherwise have to deal
   // with default values
-  void add_column(const std::string& name, const std::string& type);
-
-  // inserts a row at the end of the table
-  // note this is slow and not thread-safe and should be used for testing purposes only
+  void add_column(const std::string& name, const DataType type);
+
+  // Inserts a row at the end of the table. Multiple threads may append concurrently: writers reserve rows in a
+  // preallocated chunk and fill them without locking (see Chunk::reserve_row). Only growing the chunk or creating the
+  // next one takes a lock, which is owned by the table, so that writers to different tables do not contend. Appends
+  // to tables with table indexes are serialized by that lock. Rows are never appended to emplaced chunks and the
+  // storage of a chunk is never reallocated, so readers see a row once it is completely written. Enabling cracking
+  // and emplace_chunk must not run concurrently with appends.
   void append(std::vector<AllTypeVariant> values);
 
+  // Inserts a row as part of the given transaction. The row is only visible to the transaction itself until it
+  // commits. All chunks that append creates have MVCC columns (see MvccData), emplaced chunks do not.
+  void append(std::vector<AllTypeVariant> values, TransactionContext& transaction_context);
+
+  // Deletes a row that is visible to the given transaction. Other transactions still see the row until the
+  // transaction commits. Returns false if another transaction deleted the row in the meantime or is about to do so
+  // (write-write conflict). The transaction should be rolled back then. Rows that the transaction inserted itself
+  // cannot be deleted by it.
+  bool delete_row(const RowID row_id, TransactionContext& transaction_context);
+
   // creates a new chunk and appends it
   void create_new_chunk();
 
   // compresses a ValueSegment into a DictionarySegment
+  // indexes of the chunk are kept, as the chunk offsets they refer to do not change
   void compress_chunk(ChunkID chunk_id);
 
+  // Makes compress_chunk build a Bloom filter with the given number of bits per distinct value for every segment, so
+  // that equality scans can skip chunks that do not contain the search value. 0 (the default) disables the filters.
+  void set_bloom_filter_bits_per_value(const uint32_t bits_per_value);
+
+  // Creates an adaptive radix tree that maps the values of the given column to the RowIDs of all rows holding them.
+  // Other than chunk indexes, this index covers the whole table and is kept up to date by append and emplace_chunk.
+  std::shared_ptr<const AdaptiveRadixTreeTableIndex> create_table_index(ColumnID column_id);
+
+  // Returns the table index on the given column or nullptr if there is none. The index can be used while rows are
+  // appended (see AdaptiveRadixTreeTableIndex).
+  std::shared_ptr<const AdaptiveRadixTreeTableIndex> get_table_index(ColumnID column_id) const;
+
+  // Attaches a CrackerIndex to the given column of every uncompressed chunk, including those created by append later
+  // on. TableScans on these chunks then refine the index with every predicate. Compressing a chunk drops its
+  // CrackerIndex, since scans on DictionarySegments do not use it.
+  void enable_cracking(ColumnID column_id);
+
  protected:
   uint32_t _max_chunk_size;
+  uint32_t _bloom_filter_bits_per_value = 0;
   std::vector<std::string> _column_names;
-  std::vector<std::string> _column_types;
-  std::vector<std::shared_ptr<Chunk>> _chunks;
+  std::vector<DataType> _column_types;
+  ChunkVector _chunks;
+  std::vector<std::pair<ColumnID, std::shared_ptr<AdaptiveRadixTreeTableIndex>>> _table_indexes;
+
+  // _table_indexes is only changed under _append_mutex, under which appends read it without this lock. Other readers
+  // (get_table_index) share it, create_table_index holds it exclusively.
+  mutable std::shared_mutex _table_indexes_mutex;
+
+  // set by the first create_table_index, which makes appends take _append_mutex, under which _table_indexes is read
+  std::atomic_bool _has_table_indexes{false};
+  std::vector<ColumnID> _cracked_column_ids;
+
+  // the preallocated chunk that append currently fills without locking, or nullptr if appends have to take the lock.
+  // It is replaced by writers that find it full, so it is accessed with std::atomic_load and std::atomic_store.
+  std::shared_ptr<Chunk> _append_chunk;
+
+  // serializes growing and creating chunks for append and appends that maintain table indexes
+  std::mutex _append_mutex;
+
+  std::shared_ptr<Chunk> _lock_chunk_for_compression(ChunkID chunk_id);
+
+  // Makes room for more rows after the full append chunk and returns the chunk that takes them, or returns the chunk
+  // that another writer provided in the meantime. Returns nullptr if appends have to take the lock.
+  std::shared_ptr<Chunk> _roll_over_append_chunk(const std::shared_ptr<Chunk>& full_chunk);
+
+  // Replaces the last chunk with a copy of twice the capacity if it is a preallocated chunk smaller than the chunk
+  // size (or with a copy of the same capacity if it stopped taking rows before it was full), adds an empty chunk
+  // otherwise. Returns the chunk that takes the next rows. Expects _append_mutex to be locked.
+  std::shared_ptr<Chunk> _make_room_for_rows();
+
+  // adds an empty chunk that append fills, expects _append_mutex to be locked unless called by the constructor
+  void _add_append_chunk();
+
+  // makes the given chunk the append chunk, unless appends have to take the lock
+  void _publish_append_chunk(const std::shared_ptr<Chunk>& chunk);
+
+  // transaction_context is nullptr for rows that are appended outside of a transaction
+  void _append(const std::vector<AllTypeVariant>& values, TransactionContext* transaction_context);
 
-  std::shared_ptr<Chunk>& _lock_chunk_for_compression(ChunkID chunk_id);
+  // writes the values into a row reserved in a preallocated chunk and publishes it
+  void _write_row(Chunk& chunk, const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& values,
+                  TransactionContext* transaction_context);
 };
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include "value_segment.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -13,6 +14,9 @@
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(std::vector<T>&& values) : _values(std::move(values)) {}
+
 template <typename T>
 const AllTypeVariant ValueSegment<T>::operator[](const size_t offset) const {
   PerformanceWarning("operator[] used");
@@ -21,14 +25,54 @@ const AllTypeVariant ValueSegment<T>::operator[](const size_t offset) const {
 
 template <typename T>
 void ValueSegment<T>::append(const AllTypeVariant& val) {
+  DebugAssert(!_preallocated_size, "Cannot append to a preallocated segment, use Chunk::append instead");
   _values.push_back(type_cast<T>(val));
 }
 
 template <typename T>
 size_t ValueSegment<T>::size() const {
+  if (_preallocated_size) return _preallocated_size->load(std::memory_order_acquire);
   return _values.size();
 }
 
+template <typename T>
+void ValueSegment<T>::preallocate(ChunkOffset capacity, std::shared_ptr<const std::atomic<ChunkOffset>> size) {
+  DebugAssert(_values.empty() && !_preallocated_size, "Only empty segments can be preallocated");
+  _values.resize(capacity);
+  _preallocated_size = std::move(size);
+}
+
+template <typename T>
+std::shared_ptr<BaseValueSegment> ValueSegment<T>::copy_preallocated(
+    ChunkOffset capacity, std::shared_ptr<const std::atomic<ChunkOffset>> size) const {
+  DebugAssert(_preallocated_size, "Only preallocated segments can be copied");
+  DebugAssert(*size <= this->size() && *size <= capacity, "Values to copy are not visible or do not fit");
+
+  auto values = std::vector<T>(capacity);
+  std::copy(_values.cbegin(), _values.cbegin() + *size, values.begin());
+
+  const auto segment = std::make_shared<ValueSegment<T>>(std::move(values));
+  segment->_preallocated_size = std::move(size);
+  return segment;
+}
+
+template <typename T>
+void ValueSegment<T>::write(ChunkOffset chunk_offset, const AllTypeVariant& value) {
+  DebugAssert(_preallocated_size, "Only preallocated segments can be written to");
+  DebugAssert(chunk_offset >= size() && chunk_offset < _values.size(), "Position is visible or not preallocated");
+  _values[chunk_offset] = type_cast<T>(value);
+}
+
+template <typename T>
+AllTypeVariant ValueSegment<T>::convert(const AllTypeVariant& value) const {
+  return type_cast<T>(value);
+}
+
+template <typename T>
+size_t ValueSegment<T>::memory_consumption() const {
+  return sizeof(*this) + _values.capacity() * sizeof(T);
+}
+
 template <typename T>
 const std::vector<T>& ValueSegment<T>::values() const {
   return _values;
@@ -1,34 +1,56 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "base_segment.hpp"
+#include "base_value_segment.hpp"
 
 namespace opossum {
 
 // ValueSegment is a segment type that stores all its values in a vector
 template <typename T>
-class ValueSegment : public BaseSegment {
+class ValueSegment : public BaseValueSegment {
  public:
+  ValueSegment() = default;
+
+  // creates a segment holding the given values, which is much faster than appending them one by one
+  explicit ValueSegment(std::vector<T>&& values);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t offset) const override;
 
-  // add a value to the end
+  // Adds a value to the end. This may reallocate the values, so the segment must not be read concurrently. Table only
+  // appends to preallocated segments (see Chunk::write_row).
   void append(const AllTypeVariant& val) override;
 
   // return the number of entries
   size_t size() const override;
 
+  void preallocate(ChunkOffset capacity, std::shared_ptr<const std::atomic<ChunkOffset>> size) override;
+
+  std::shared_ptr<BaseValueSegment> copy_preallocated(
+      ChunkOffset capacity, std::shared_ptr<const std::atomic<ChunkOffset>> size) const override;
+
+  void write(ChunkOffset chunk_offset, const AllTypeVariant& value) override;
+
+  AllTypeVariant convert(const AllTypeVariant& value) const override;
+
+  size_t memory_consumption() const override;
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
+  // If the segment is preallocated, only the first size() values are valid, so do not iterate up to values().size().
   const std::vector<T>& values() const;
 
  protected:
   std::vector<T> _values;
+
+  // the number of valid values if the segment is preallocated, nullptr otherwise
+  std::shared_ptr<const std::atomic<ChunkOffset>> _preallocated_size;
 };
 
 }  // namespace opossum
@@ -0,0 +1,133 @@
+#include "tpch_queries.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "operators/aggregate.hpp"
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/table_scan.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+namespace {
+
+ColumnID column_id(const std::string& table_name, const std::string& column_name) {
+  return StorageManager::get().get_table(table_name)->column_id_by_name(column_name);
+}
+
+// JoinHash outputs the columns of its left input followed by those of its right input
+ColumnID right_column_id(const std::string& left_table_name, const std::string& right_table_name,
+                         const std::string& column_name) {
+  const auto offset = StorageManager::get().get_table(left_table_name)->column_count();
+  return ColumnID{static_cast<uint16_t>(offset + column_id(right_table_name, column_name))};
+}
+
+std::shared_ptr<TableScan> scan(const std::shared_ptr<const AbstractOperator>& input, const std::string& table_name,
+                                const std::string& column_name, const ScanType scan_type,
+                                const AllTypeVariant& search_value) {
+  return std::make_shared<TableScan>(input, column_id(table_name, column_name), scan_type, search_value);
+}
+
+// SUM(l_quantity), SUM(l_extendedprice), AVG(l_quantity), AVG(l_discount), COUNT(*) of lineitems shipped until
+// 1998-09-02
+std::shared_ptr<AbstractOperator> make_query_1() {
+  const auto lineitem = std::make_shared<GetTable>("lineitem");
+  const auto shipped = scan(lineitem, "lineitem", "l_shipdate", ScanType::OpLessThanEquals, "1998-09-02");
+  return std::make_shared<Aggregate>(
+      shipped, std::vector<AggregateDefinition>{{column_id("lineitem", "l_quantity"), AggregateFunction::Sum},
+                                                {column_id("lineitem", "l_extendedprice"), AggregateFunction::Sum},
+                                                {column_id("lineitem", "l_quantity"), AggregateFunction::Avg},
+                                                {column_id("lineitem", "l_discount"), AggregateFunction::Avg},
+                                                {column_id("lineitem", "l_orderkey"), AggregateFunction::Count}});
+}
+
+// revenue of unshipped lineitems of orders placed by customers of the BUILDING segment before 1995-03-15
+std::shared_ptr<AbstractOperator> make_query_3() {
+  const auto customer = std::make_shared<GetTable>("customer");
+  const auto building_customers = scan(customer, "customer", "c_mktsegment", ScanType::OpEquals, "BUILDING");
+  const auto orders = std::make_shared<GetTable>("orders");
+  const auto early_orders = scan(orders, "orders", "o_orderdate", ScanType::OpLessThan, "1995-03-15");
+  const auto lineitem = std::make_shared<GetTable>("lineitem");
+  const auto late_lineitems = scan(lineitem, "lineitem", "l_shipdate", ScanType::OpGreaterThan, "1995-03-15");
+
+  const auto customer_orders = std::make_shared<JoinHash>(early_orders, building_customers,
+                                                          column_id("orders", "o_custkey"),
+                                                          column_id("customer", "c_custkey"));
+  const auto lineitems = std::make_shared<JoinHash>(late_lineitems, customer_orders,
+                                                    column_id("lineitem", "l_orderkey"),
+                                                    column_id("orders", "o_orderkey"));
+  return std::make_shared<Aggregate>(
+      lineitems, std::vector<AggregateDefinition>{{column_id("lineitem", "l_extendedprice"), AggregateFunction::Sum},
+                                                  {column_id("lineitem", "l_orderkey"), AggregateFunction::Count}});
+}
+
+// value of the orders placed by Asian customers in 1994
+std::shared_ptr<AbstractOperator> make_query_5() {
+  const auto region = std::make_shared<GetTable>("region");
+  const auto asia = scan(region, "region", "r_name", ScanType::OpEquals, "ASIA");
+  const auto nation = std::make_shared<GetTable>("nation");
+  const auto asian_nations = std::make_shared<JoinHash>(nation, asia, column_id("nation", "n_regionkey"),
+                                                        column_id("region", "r_regionkey"));
+
+  const auto customer = std::make_shared<GetTable>("customer");
+  const auto asian_customers = std::make_shared<JoinHash>(customer, asian_nations,
+                                                          column_id("customer", "c_nationkey"),
+                                                          column_id("nation", "n_nationkey"));
+
+  const auto orders = std::make_shared<GetTable>("orders");
+  const auto orders_from_1994 = scan(orders, "orders", "o_orderdate", ScanType::OpGreaterThanEquals, "1994-01-01");
+  const auto orders_in_1994 = scan(orders_from_1994, "orders", "o_orderdate", ScanType::OpLessThan, "1995-01-01");
+  const auto asian_orders = std::make_shared<JoinHash>(orders_in_1994, asian_customers,
+                                                       column_id("orders", "o_custkey"),
+                                                       column_id("customer", "c_custkey"));
+  return std::make_shared<Aggregate>(
+      asian_orders, std::vector<AggregateDefinition>{{column_id("orders", "o_totalprice"), AggregateFunction::Sum},
+                                                     {column_id("orders", "o_orderkey"), AggregateFunction::Count}});
+}
+
+// revenue of cheap, low-quantity lineitems shipped in 1994. The five predicates and the aggregate run as one Pipeline.
+std::shared_ptr<AbstractOperator> make_query_6() {
+  const auto lineitem = std::make_shared<GetTable>("lineitem");
+  auto predicates = std::shared_ptr<const AbstractOperator>{lineitem};
+  predicates = scan(predicates, "lineitem", "l_shipdate", ScanType::OpGreaterThanEquals, "1994-01-01");
+  predicates = scan(predicates, "lineitem", "l_shipdate", ScanType::OpLessThan, "1995-01-01");
+  predicates = scan(predicates, "lineitem", "l_discount", ScanType::OpGreaterThanEquals, 0.05f);
+  predicates = scan(predicates, "lineitem", "l_discount", ScanType::OpLessThanEquals, 0.07f);
+  predicates = scan(predicates, "lineitem", "l_quantity", ScanType::OpLessThan, 24.0f);
+
+  return std::make_shared<Pipeline>(std::make_shared<Aggregate>(
+      predicates, std::vector<AggregateDefinition>{{column_id("lineitem", "l_extendedprice"), AggregateFunction::Sum},
+                                                   {column_id("lineitem", "l_orderkey"), AggregateFunction::Count}}));
+}
+
+// revenue and average retail price of the parts shipped in September 1995
+std::shared_ptr<AbstractOperator> make_query_14() {
+  const auto lineitem = std::make_shared<GetTable>("lineitem");
+  const auto from_september = scan(lineitem, "lineitem", "l_shipdate", ScanType::OpGreaterThanEquals, "1995-09-01");
+  const auto in_september = scan(from_september, "lineitem", "l_shipdate", ScanType::OpLessThan, "1995-10-01");
+  const auto part = std::make_shared<GetTable>("part");
+  const auto lineitem_parts = std::make_shared<JoinHash>(in_september, part, column_id("lineitem", "l_partkey"),
+                                                         column_id("part", "p_partkey"));
+  return std::make_shared<Aggregate>(
+      lineitem_parts,
+      std::vector<AggregateDefinition>{{column_id("lineitem", "l_extendedprice"), AggregateFunction::Sum},
+                                       {right_column_id("lineitem", "part", "p_retailprice"), AggregateFunction::Avg}});
+}
+
+}  // namespace
+
+std::vector<TpchQuery> tpch_queries() {
+  return {{"TPC-H 1", make_query_1},
+          {"TPC-H 3", make_query_3},
+          {"TPC-H 5", make_query_5},
+          {"TPC-H 6", make_query_6},
+          {"TPC-H 14", make_query_14}};
+}
+
+}  // namespace opossum
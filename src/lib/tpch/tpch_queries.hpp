@@ -0,0 +1,25 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+class AbstractOperator;
+
+struct TpchQuery {
+  std::string name;
+
+  // Creates the operator tree of the query, which reads the tables from the StorageManager (see
+  // TpchTableGenerator::generate_and_store). Operators are executed only once, so every run needs a new tree.
+  std::function<std::shared_ptr<AbstractOperator>()> make_plan;
+};
+
+// Returns simplified versions of TPC-H queries 1, 3, 5, 6 and 14, which only use the operators we have: predicates
+// become TableScans, equi-joins JoinHashes, and the final aggregates are computed over the whole result, since
+// Aggregate cannot group yet. Expressions such as l_extendedprice * (1 - l_discount) are replaced by plain columns.
+std::vector<TpchQuery> tpch_queries();
+
+}  // namespace opossum
@@ -0,0 +1,294 @@
+#include "tpch_table_generator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Collects the rows of a chunk in one vector per column and adds them to the table as a chunk of ValueSegments (or
+// DictionarySegments) once the chunk is full.
+template <typename... Types>
+class TableBuilder {
+ public:
+  TableBuilder(const uint32_t chunk_size, const bool use_dictionary_encoding,
+               const std::array<std::string, sizeof...(Types)>& column_names)
+      : _table(std::make_shared<Table>(chunk_size)),
+        _chunk_size(chunk_size),
+        _use_dictionary_encoding(use_dictionary_encoding) {
+    const auto column_types = std::array<DataType, sizeof...(Types)>{data_type_from_type<Types>()...};
+    for (auto column_id = size_t{0}; column_id < column_names.size(); ++column_id) {
+      _table->add_column_definition(column_names[column_id], column_types[column_id]);
+    }
+  }
+
+  void append_row(Types... values) {
+    _append_row(std::index_sequence_for<Types...>{}, std::move(values)...);
+    if (++_row_count_in_chunk == _chunk_size) _emplace_chunk(std::index_sequence_for<Types...>{});
+  }
+
+  std::shared_ptr<Table> finish() {
+    if (_row_count_in_chunk > 0) _emplace_chunk(std::index_sequence_for<Types...>{});
+    return _table;
+  }
+
+ protected:
+  template <size_t... column_ids>
+  void _append_row(std::index_sequence<column_ids...>, Types&&... values) {
+    (std::get<column_ids>(_columns).push_back(std::move(values)), ...);
+  }
+
+  template <size_t... column_ids>
+  void _emplace_chunk(std::index_sequence<column_ids...>) {
+    auto chunk = Chunk{};
+    (chunk.add_segment(_make_segment(std::get<column_ids>(_columns))), ...);
+    _table->emplace_chunk(std::move(chunk));
+    _row_count_in_chunk = 0;
+  }
+
+  template <typename T>
+  std::shared_ptr<BaseSegment> _make_segment(std::vector<T>& values) {
+    const auto value_segment = std::make_shared<ValueSegment<T>>(std::move(values));
+    values = std::vector<T>{};
+    values.reserve(_chunk_size);
+    if (!_use_dictionary_encoding) return value_segment;
+    return std::make_shared<DictionarySegment<T>>(value_segment);
+  }
+
+  const std::shared_ptr<Table> _table;
+  const uint32_t _chunk_size;
+  const bool _use_dictionary_encoding;
+  std::tuple<std::vector<Types>...> _columns;
+  uint32_t _row_count_in_chunk = 0;
+};
+
+// std::mt19937_64 produces the same numbers on every platform, unlike the standard distributions. Since the order in
+// which function arguments are evaluated is unspecified, random values are stored in variables before they are used.
+class RandomGenerator {
+ public:
+  explicit RandomGenerator(const uint64_t seed) : _engine(seed) {}
+
+  // returns a number in [min, max]
+  int32_t number(const int32_t min, const int32_t max) {
+    return min + static_cast<int32_t>(_engine() % static_cast<uint64_t>(max - min + 1));
+  }
+
+  // returns a number in [min, max] with two decimal places
+  float decimal(const float min, const float max) {
+    return static_cast<float>(number(static_cast<int32_t>(min * 100), static_cast<int32_t>(max * 100))) / 100.0f;
+  }
+
+  template <typename T, size_t size>
+  const T& element(const std::array<T, size>& elements) {
+    return elements[number(0, static_cast<int32_t>(size) - 1)];
+  }
+
+ protected:
+  std::mt19937_64 _engine;
+};
+
+// Dates are days since 1970-01-01. See http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+std::string date_to_string(const int32_t days_since_epoch) {
+  const auto days = days_since_epoch + 719468;
+  const auto era = days / 146097;
+  const auto day_of_era = days - era * 146097;
+  const auto year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+  const auto day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+  const auto shifted_month = (5 * day_of_year + 2) / 153;
+  const auto day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+  const auto month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+  const auto year = year_of_era + era * 400 + (month <= 2 ? 1 : 0);
+
+  auto stream = std::stringstream{};
+  stream << year << '-' << std::setw(2) << std::setfill('0') << month << '-' << std::setw(2) << day;
+  return stream.str();
+}
+
+// 1992-01-01, 1998-08-02 (the last order date) and 1995-06-17 (the "current date" for return flags and line status)
+constexpr auto START_DATE = int32_t{8035};
+constexpr auto END_DATE = int32_t{10440};
+constexpr auto CURRENT_DATE = int32_t{9298};
+
+// returns "<prefix>#<key>" with the key padded to nine digits, e.g., "Customer#000000001"
+std::string key_name(const std::string& prefix, const int32_t key) {
+  auto stream = std::stringstream{};
+  stream << prefix << '#' << std::setw(9) << std::setfill('0') << key;
+  return stream.str();
+}
+
+const auto REGION_NAMES = std::array<std::string, 5>{"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+
+// the nations of the specification along with their regions
+const auto NATIONS = std::array<std::pair<std::string, int32_t>, 25>{
+    {{"ALGERIA", 0},   {"ARGENTINA", 1},  {"BRAZIL", 1},         {"CANADA", 1},  {"EGYPT", 4},
+     {"ETHIOPIA", 0},  {"FRANCE", 3},     {"GERMANY", 3},        {"INDIA", 2},   {"INDONESIA", 2},
+     {"IRAN", 4},      {"IRAQ", 4},       {"JAPAN", 2},          {"JORDAN", 4},  {"KENYA", 0},
+     {"MOROCCO", 0},   {"MOZAMBIQUE", 0}, {"PERU", 1},           {"CHINA", 2},   {"ROMANIA", 3},
+     {"SAUDI ARABIA", 4}, {"VIETNAM", 2}, {"RUSSIA", 3}, {"UNITED KINGDOM", 3}, {"UNITED STATES", 1}}};
+
+const auto MARKET_SEGMENTS = std::array<std::string, 5>{"AUTOMOBILE", "BUILDING", "FURNITURE", "HOUSEHOLD", "MACHINERY"};
+const auto TYPE_SIZES = std::array<std::string, 6>{"STANDARD", "SMALL", "MEDIUM", "LARGE", "ECONOMY", "PROMO"};
+const auto TYPE_FINISHES = std::array<std::string, 5>{"ANODIZED", "BURNISHED", "PLATED", "POLISHED", "BRUSHED"};
+const auto TYPE_MATERIALS = std::array<std::string, 5>{"TIN", "NICKEL", "BRASS", "STEEL", "COPPER"};
+const auto ORDER_PRIORITIES =
+    std::array<std::string, 5>{"1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECIFIED", "5-LOW"};
+const auto SHIP_MODES = std::array<std::string, 7>{"REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"};
+
+float part_retail_price(const int32_t part_key) {
+  return static_cast<float>(90'000 + (part_key / 10) % 20'001 + 100 * (part_key % 1'000)) / 100.0f;
+}
+
+}  // namespace
+
+TpchTableGenerator::TpchTableGenerator(const float scale_factor, const uint32_t chunk_size,
+                                       const bool use_dictionary_encoding)
+    : _scale_factor(scale_factor), _chunk_size(chunk_size), _use_dictionary_encoding(use_dictionary_encoding) {
+  Assert(scale_factor > 0.0f, "The scale factor has to be positive");
+}
+
+std::map<std::string, std::shared_ptr<Table>> TpchTableGenerator::generate() const {
+  const auto scaled_row_count = [&](const uint32_t row_count_at_scale_factor_one) {
+    return std::max(int32_t{1}, static_cast<int32_t>(row_count_at_scale_factor_one * _scale_factor));
+  };
+  const auto supplier_count = scaled_row_count(10'000);
+  const auto customer_count = scaled_row_count(150'000);
+  const auto part_count = scaled_row_count(200'000);
+  const auto order_count = scaled_row_count(1'500'000);
+
+  auto tables = std::map<std::string, std::shared_ptr<Table>>{};
+
+  auto region_builder = TableBuilder<int32_t, std::string>{_chunk_size, _use_dictionary_encoding,
+                                                           {"r_regionkey", "r_name"}};
+  for (auto region_key = int32_t{0}; region_key < static_cast<int32_t>(REGION_NAMES.size()); ++region_key) {
+    region_builder.append_row(region_key, REGION_NAMES[region_key]);
+  }
+  tables["region"] = region_builder.finish();
+
+  auto nation_builder = TableBuilder<int32_t, std::string, int32_t>{_chunk_size, _use_dictionary_encoding,
+                                                                    {"n_nationkey", "n_name", "n_regionkey"}};
+  for (auto nation_key = int32_t{0}; nation_key < static_cast<int32_t>(NATIONS.size()); ++nation_key) {
+    nation_builder.append_row(nation_key, NATIONS[nation_key].first, NATIONS[nation_key].second);
+  }
+  tables["nation"] = nation_builder.finish();
+
+  auto random = RandomGenerator{1};
+  auto supplier_builder = TableBuilder<int32_t, std::string, int32_t, float>{
+      _chunk_size, _use_dictionary_encoding, {"s_suppkey", "s_name", "s_nationkey", "s_acctbal"}};
+  for (auto supplier_key = int32_t{1}; supplier_key <= supplier_count; ++supplier_key) {
+    const auto nation_key = random.number(0, 24);
+    const auto account_balance = random.decimal(-999.99f, 9'999.99f);
+    supplier_builder.append_row(supplier_key, key_name("Supplier", supplier_key), nation_key, account_balance);
+  }
+  tables["supplier"] = supplier_builder.finish();
+
+  random = RandomGenerator{2};
+  auto customer_builder = TableBuilder<int32_t, std::string, int32_t, float, std::string>{
+      _chunk_size, _use_dictionary_encoding, {"c_custkey", "c_name", "c_nationkey", "c_acctbal", "c_mktsegment"}};
+  for (auto customer_key = int32_t{1}; customer_key <= customer_count; ++customer_key) {
+    const auto nation_key = random.number(0, 24);
+    const auto account_balance = random.decimal(-999.99f, 9'999.99f);
+    const auto& market_segment = random.element(MARKET_SEGMENTS);
+    customer_builder.append_row(customer_key, key_name("Customer", customer_key), nation_key, account_balance,
+                                market_segment);
+  }
+  tables["customer"] = customer_builder.finish();
+
+  random = RandomGenerator{3};
+  auto part_builder = TableBuilder<int32_t, std::string, std::string, int32_t, float>{
+      _chunk_size, _use_dictionary_encoding, {"p_partkey", "p_brand", "p_type", "p_size", "p_retailprice"}};
+  auto partsupp_builder = TableBuilder<int32_t, int32_t, int32_t, float>{
+      _chunk_size, _use_dictionary_encoding, {"ps_partkey", "ps_suppkey", "ps_availqty", "ps_supplycost"}};
+  for (auto part_key = int32_t{1}; part_key <= part_count; ++part_key) {
+    const auto manufacturer = random.number(1, 5);
+    const auto brand = "Brand#" + std::to_string(manufacturer) + std::to_string(random.number(1, 5));
+    const auto& type_size = random.element(TYPE_SIZES);
+    const auto& type_finish = random.element(TYPE_FINISHES);
+    const auto type = type_size + " " + type_finish + " " + random.element(TYPE_MATERIALS);
+    const auto size = random.number(1, 50);
+    part_builder.append_row(part_key, brand, type, size, part_retail_price(part_key));
+
+    // every part is supplied by four different suppliers
+    for (auto supplier_index = int32_t{0}; supplier_index < 4; ++supplier_index) {
+      const auto supplier_key = (part_key + supplier_index * (supplier_count / 4 + 1)) % supplier_count + 1;
+      const auto available_quantity = random.number(1, 9'999);
+      const auto supply_cost = random.decimal(1.0f, 1'000.0f);
+      partsupp_builder.append_row(part_key, supplier_key, available_quantity, supply_cost);
+    }
+  }
+  tables["part"] = part_builder.finish();
+  tables["partsupp"] = partsupp_builder.finish();
+
+  random = RandomGenerator{4};
+  auto orders_builder = TableBuilder<int32_t, int32_t, std::string, float, std::string, std::string>{
+      _chunk_size,
+      _use_dictionary_encoding,
+      {"o_orderkey", "o_custkey", "o_orderstatus", "o_totalprice", "o_orderdate", "o_orderpriority"}};
+  auto lineitem_builder = TableBuilder<int32_t, int32_t, int32_t, int32_t, float, float, float, float, std::string,
+                                       std::string, std::string, std::string>{
+      _chunk_size,
+      _use_dictionary_encoding,
+      {"l_orderkey", "l_partkey", "l_suppkey", "l_linenumber", "l_quantity", "l_extendedprice", "l_discount", "l_tax",
+       "l_returnflag", "l_linestatus", "l_shipdate", "l_shipmode"}};
+  for (auto order_index = int32_t{0}; order_index < order_count; ++order_index) {
+    // like in dbgen, only the first eight of every 32 keys are used
+    const auto order_key = (order_index / 8) * 32 + order_index % 8 + 1;
+    const auto order_date = random.number(START_DATE, END_DATE);
+
+    auto total_price = 0.0f;
+    auto shipped_line_count = 0;
+    const auto line_count = random.number(1, 7);
+    for (auto line_number = int32_t{1}; line_number <= line_count; ++line_number) {
+      const auto part_key = random.number(1, part_count);
+      const auto supplier_key = (part_key + random.number(0, 3) * (supplier_count / 4 + 1)) % supplier_count + 1;
+      const auto quantity = static_cast<float>(random.number(1, 50));
+      const auto extended_price = quantity * part_retail_price(part_key);
+      const auto discount = random.decimal(0.0f, 0.1f);
+      const auto tax = random.decimal(0.0f, 0.08f);
+      const auto ship_date = order_date + random.number(1, 121);
+      const auto receipt_date = ship_date + random.number(1, 30);
+      const auto return_flag = receipt_date <= CURRENT_DATE ? (random.number(0, 1) ? "R" : "A") : "N";
+      const auto line_status = ship_date > CURRENT_DATE ? "O" : "F";
+      const auto& ship_mode = random.element(SHIP_MODES);
+      if (ship_date <= CURRENT_DATE) ++shipped_line_count;
+
+      total_price += extended_price * (1.0f + tax) * (1.0f - discount);
+      lineitem_builder.append_row(order_key, part_key, supplier_key, line_number, quantity, extended_price, discount,
+                                  tax, return_flag, line_status, date_to_string(ship_date), ship_mode);
+    }
+
+    const auto order_status = shipped_line_count == line_count ? "F" : (shipped_line_count == 0 ? "O" : "P");
+    const auto customer_key = random.number(1, customer_count);
+    const auto& order_priority = random.element(ORDER_PRIORITIES);
+    orders_builder.append_row(order_key, customer_key, order_status, total_price, date_to_string(order_date),
+                              order_priority);
+  }
+  tables["orders"] = orders_builder.finish();
+  tables["lineitem"] = lineitem_builder.finish();
+
+  return tables;
+}
+
+void TpchTableGenerator::generate_and_store() const {
+  for (const auto& [name, table] : generate()) StorageManager::get().add_table(name, table);
+}
+
+}  // namespace opossum
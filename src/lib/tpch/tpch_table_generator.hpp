@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+class Table;
+
+// TpchTableGenerator creates the eight tables of the TPC-H benchmark (region, nation, supplier, customer, part,
+// partsupp, orders and lineitem) without any outside tool. The schema is reduced to the columns that our queries
+// (see TpchQueries) use, and decimals are stored as floats and dates as "YYYY-MM-DD" strings, which compare like
+// dates. The distributions follow the specification loosely: the same scale factor always produces the same tables,
+// but not the ones dbgen would.
+//
+// Rows are generated column by column into vectors that become the ValueSegments of a chunk, so that generating
+// millions of rows does not go through Table::append.
+class TpchTableGenerator {
+ public:
+  // a scale factor of 1 yields 6 million lineitems, i.e., about 1 GB in dbgen's output
+  explicit TpchTableGenerator(const float scale_factor, const uint32_t chunk_size = 100'000,
+                              const bool use_dictionary_encoding = false);
+
+  // returns the tables by their names
+  std::map<std::string, std::shared_ptr<Table>> generate() const;
+
+  // generates the tables and adds them to the StorageManager under their names
+  void generate_and_store() const;
+
+ protected:
+  const float _scale_factor;
+  const uint32_t _chunk_size;
+  const bool _use_dictionary_encoding;
+};
+
+}  // namespace opossum
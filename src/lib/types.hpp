@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <memory_resource>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -31,12 +32,29 @@
 STRONG_TYPEDEF(uint32_t, ChunkID);
 STRONG_TYPEDEF(uint16_t, ColumnID);
 STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
+STRONG_TYPEDEF(uint16_t, ParameterID);
 
 namespace opossum {
 
 using ChunkOffset = uint32_t;
+
+// returned instead of a chunk offset if there is none, e.g., when a full chunk cannot reserve another row
+constexpr ChunkOffset INVALID_CHUNK_OFFSET{std::numeric_limits<ChunkOffset>::max()};
 using AttributeVectorWidth = uint8_t;
 
+using NodeID = uint32_t;
+using CpuID = uint32_t;
+using WorkerID = uint32_t;
+
+using CommitID = uint32_t;
+using TransactionID = uint32_t;
+
+// the begin or end commit id of a row that has not been inserted or deleted by a committed transaction
+constexpr CommitID MAX_COMMIT_ID{std::numeric_limits<CommitID>::max()};
+
+// the transaction id of rows that are not locked by a transaction and of readers outside of a transaction
+constexpr TransactionID INVALID_TRANSACTION_ID{0};
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -53,7 +71,13 @@ struct RowID {
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
-using PosList = std::vector<RowID>;
+enum class SegmentIndexType { GroupKey, BTree, AdaptiveRadixTree, Cracker };
+
+// Vectors that can allocate from a memory resource other than the heap, e.g., from the MemoryPool of an operator
+template <typename T>
+using pmr_vector = std::pmr::vector<T>;
+
+using PosList = pmr_vector<RowID>;
 
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace opossum {
+
+// Positions are materialized in batches of this size (see DictionarySegmentIterable::gather), so that the buffers of a
+// batch stay in the L1 cache
+constexpr size_t GATHER_BATCH_SIZE = 1'024;
+
+// Values this many positions ahead are prefetched when the positions are scattered
+constexpr size_t GATHER_PREFETCH_DISTANCE = 16;
+
+// Positions are considered scattered if they are not ascending or further apart than a cache line on average. Only
+// then can the hardware prefetcher not keep up and prefetching is worth its instructions.
+template <typename T, typename Index>
+bool are_positions_scattered(const Index* indices, const size_t count) {
+  if (count < 2) return false;
+  const auto first = static_cast<size_t>(indices[0]);
+  const auto last = static_cast<size_t>(indices[count - 1]);
+  return last < first || (last - first) * sizeof(T) > count * 64;
+}
+
+// Writes source[indices[i]] to output[i] for i < count. Release builds (-march=native) on CPUs with AVX2 gather 4- and
+// 8-byte arithmetic values with 32-bit indices eight at a time. The gather instructions treat the indices as signed,
+// so the remaining positions are loaded one by one once eight indices include one of 2^31 or more.
+template <typename T, typename Index, typename Output>
+void gather(const T* source, const Index* indices, const size_t count, Output* output) {
+  const auto prefetch = are_positions_scattered<T>(indices, count);
+  auto position = size_t{0};
+
+#if defined(__AVX2__)
+  if constexpr (std::is_same_v<Index, uint32_t> && std::is_same_v<T, Output> && std::is_arithmetic_v<T> &&
+                (sizeof(T) == 4 || sizeof(T) == 8)) {
+    for (; position + 8 <= count; position += 8) {
+      if (prefetch && position + GATHER_PREFETCH_DISTANCE + 8 <= count) {
+        for (auto offset = size_t{0}; offset < 8; ++offset) {
+          __builtin_prefetch(source + indices[position + GATHER_PREFETCH_DISTANCE + offset]);
+        }
+      }
+
+      const auto vector_indices = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + position));
+      if (_mm256_movemask_ps(_mm256_castsi256_ps(vector_indices)) != 0) break;
+
+      if constexpr (sizeof(T) == 4) {
+        const auto values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(source), vector_indices, 4);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + position), values);
+      } else {
+        const auto base = reinterpret_cast<const long long*>(source);  // NOLINT(runtime/int)
+        const auto low_values = _mm256_i32gather_epi64(base, _mm256_castsi256_si128(vector_indices), 8);
+        const auto high_values = _mm256_i32gather_epi64(base, _mm256_extracti128_si256(vector_indices, 1), 8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + position), low_values);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + position + 4), high_values);
+      }
+    }
+  }
+#endif
+
+  for (; position < count; ++position) {
+    if (prefetch && position + GATHER_PREFETCH_DISTANCE < count) {
+      __builtin_prefetch(source + indices[position + GATHER_PREFETCH_DISTANCE]);
+    }
+    output[position] = source[indices[position]];
+  }
+}
+
+}  // namespace opossum
@@ -6,10 +6,15 @@
 #include <vector>
 
 #include "storage/table.hpp"
+#include "performance_counters.hpp"
+#include "tracer.hpp"
 
 namespace opossum {
 
 std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
+  const auto trace_scope = TraceScope{"load", "load_table " + file_name};
+  auto performance_counter_scope = PerformanceCounterScope{"load_table"};
+
   std::ifstream infile(file_name);
   Assert(infile.is_open(), "load_table: Could not find file " + file_name);
 
@@ -21,13 +26,15 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
 
   std::shared_ptr<Table> test_table = std::make_shared<Table>(chunk_size);
   for (size_t i = 0; i < column_names.size(); i++) {
-    test_table->add_column(column_names[i], column_types[i]);
+    test_table->add_column(column_names[i], data_type_from_string(column_types[i]));
   }
 
   while (std::getline(infile, line)) {
     std::vector<AllTypeVariant> values = _split<AllTypeVariant>(line, '|');
     test_table->append(values);
   }
+
+  performance_counter_scope.set_row_count(test_table->row_count());
   return test_table;
 }
 
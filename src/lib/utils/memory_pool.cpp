@@ -0,0 +1,92 @@
+#include "memory_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Memory of the pool is aligned to this, larger alignments are requested from the upstream resource directly
+constexpr size_t POOL_ALIGNMENT = alignof(std::max_align_t);
+
+constexpr size_t MIN_BLOCK_SIZE = size_t{64} * 1024;
+constexpr size_t MAX_BLOCK_SIZE = size_t{64} * 1024 * 1024;
+
+}  // namespace
+
+MemoryPool::MemoryPool(std::pmr::memory_resource* upstream)
+    : _upstream{upstream}, _next_block_size{MIN_BLOCK_SIZE} {}
+
+MemoryPool::~MemoryPool() {
+  for (const auto& [block, size] : _blocks) _upstream->deallocate(block, size, POOL_ALIGNMENT);
+}
+
+size_t MemoryPool::allocated_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto bytes = size_t{0};
+  for (const auto& block : _blocks) bytes += block.second;
+  return bytes;
+}
+
+void* MemoryPool::do_allocate(const size_t bytes, const size_t alignment) {
+  if (alignment > POOL_ALIGNMENT) return _upstream->allocate(bytes, alignment);
+
+  const auto size_class = _size_class(bytes);
+  const auto class_bytes = size_t{1} << size_class;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto& free_list = _free_lists[size_class];
+  if (free_list) {
+    const auto node = free_list;
+    free_list = node->next;
+    return node;
+  }
+
+  if (static_cast<size_t>(_end - _position) < class_bytes) _allocate_block(class_bytes);
+  const auto pointer = _position;
+  _position += class_bytes;
+  return pointer;
+}
+
+void MemoryPool::do_deallocate(void* pointer, const size_t bytes, const size_t alignment) {
+  if (alignment > POOL_ALIGNMENT) {
+    _upstream->deallocate(pointer, bytes, alignment);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto& free_list = _free_lists[_size_class(bytes)];
+  free_list = new (pointer) FreeNode{free_list};
+}
+
+bool MemoryPool::do_is_equal(const std::pmr::memory_resource& other) const noexcept { return this == &other; }
+
+size_t MemoryPool::_size_class(const size_t bytes) {
+  // The smallest class is POOL_ALIGNMENT bytes, so that every allocation is aligned and can hold a FreeNode
+  auto size_class = size_t{0};
+  while ((size_t{1} << size_class) < std::max(bytes, POOL_ALIGNMENT)) ++size_class;
+  return size_class;
+}
+
+void MemoryPool::_allocate_block(const size_t bytes) {
+  // The rest of the current block is lost. Blocks double in size, so that the pool quickly adapts to large outputs.
+  const auto block_size = std::max(bytes, _next_block_size);
+  _next_block_size = std::min(_next_block_size * 2, MAX_BLOCK_SIZE);
+
+  const auto block = static_cast<std::byte*>(_upstream->allocate(block_size, POOL_ALIGNMENT));
+  _blocks.emplace_back(block, block_size);
+  _position = block;
+  _end = block + block_size;
+}
+
+std::shared_ptr<PosList> make_pooled_pos_list(const std::shared_ptr<MemoryPool>& memory_pool) {
+  return make_pooled_shared<PosList>(memory_pool, memory_pool.get());
+}
+
+}  // namespace opossum
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A memory resource for the intermediates of an operator execution, e.g., the PosLists of its output or its hash
+// tables. Memory is cut from large blocks of the upstream resource with a bump pointer. Deallocated memory is kept in
+// free lists by size class (powers of two) and handed out again, e.g., the buffer that a PosList leaves behind when it
+// grows is reused by the PosList of the next chunk. Nothing is returned upstream before the pool is destroyed.
+// Thread-safe, as chunks may be processed concurrently (see Pipeline).
+class MemoryPool : public std::pmr::memory_resource, private Noncopyable {
+ public:
+  explicit MemoryPool(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+  ~MemoryPool() override;
+
+  // returns the number of bytes that the pool took from the upstream resource
+  size_t allocated_bytes() const;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+  // returns the index of the smallest size class that holds the given number of bytes
+  static size_t _size_class(const size_t bytes);
+
+  // takes a new block from the upstream resource that holds at least the given number of bytes
+  void _allocate_block(const size_t bytes);
+
+  // freed memory of a size class, stored in the memory itself
+  struct FreeNode {
+    FreeNode* next;
+  };
+
+  std::pmr::memory_resource* const _upstream;
+  std::vector<std::pair<void*, size_t>> _blocks;
+  std::array<FreeNode*, 64> _free_lists{};
+  std::byte* _position = nullptr;
+  std::byte* _end = nullptr;
+  size_t _next_block_size;
+  mutable std::mutex _mutex;
+};
+
+// An allocator that allocates from a MemoryPool and keeps the pool alive as long as the memory it allocated. Unlike
+// std::pmr::polymorphic_allocator, it can be used to let a shared_ptr keep its pool (see make_pooled_shared).
+template <typename T>
+class PoolAllocator {
+ public:
+  using value_type = T;
+
+  explicit PoolAllocator(std::shared_ptr<MemoryPool> memory_pool) : _memory_pool{std::move(memory_pool)} {}
+
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U>& other) : _memory_pool{other.memory_pool()} {}  // NOLINT
+
+  T* allocate(const size_t count) {
+    return static_cast<T*>(_memory_pool->allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* pointer, const size_t count) {
+    _memory_pool->deallocate(pointer, count * sizeof(T), alignof(T));
+  }
+
+  const std::shared_ptr<MemoryPool>& memory_pool() const { return _memory_pool; }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U>& other) const {
+    return _memory_pool == other.memory_pool();
+  }
+
+  template <typename U>
+  bool operator!=(const PoolAllocator<U>& other) const {
+    return _memory_pool != other.memory_pool();
+  }
+
+ private:
+  std::shared_ptr<MemoryPool> _memory_pool;
+};
+
+// Creates an object whose memory, including the control block of the shared_ptr, comes from the pool. The pool lives
+// at least as long as the object.
+template <typename T, typename... Args>
+std::shared_ptr<T> make_pooled_shared(const std::shared_ptr<MemoryPool>& memory_pool, Args&&... args) {
+  return std::allocate_shared<T>(PoolAllocator<T>{memory_pool}, std::forward<Args>(args)...);
+}
+
+// creates an empty PosList that grows in the given pool
+std::shared_ptr<PosList> make_pooled_pos_list(const std::shared_ptr<MemoryPool>& memory_pool);
+
+}  // namespace opossum
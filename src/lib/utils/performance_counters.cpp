@@ -0,0 +1,189 @@
+#include "performance_counters.hpp"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The file descriptors of the counters of one thread. Each counter is opened on its own rather than as a group, so
+// that a counter the hardware lacks does not take the others down with it.
+class ThreadCounters : private Noncopyable {
+ public:
+  ThreadCounters() {
+    const auto configs = std::array<uint64_t, PERFORMANCE_COUNTER_COUNT>{
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+    for (auto counter_index = size_t{0}; counter_index < PERFORMANCE_COUNTER_COUNT; ++counter_index) {
+      auto attributes = perf_event_attr{};
+      std::memset(&attributes, 0, sizeof(attributes));
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.size = sizeof(attributes);
+      attributes.config = configs[counter_index];
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+
+      // measures the calling thread on any CPU
+      _file_descriptors[counter_index] =
+          static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+    }
+  }
+
+  ~ThreadCounters() {
+    for (const auto file_descriptor : _file_descriptors) {
+      if (file_descriptor >= 0) close(file_descriptor);
+    }
+  }
+
+  bool is_available(const PerformanceCounter counter) const {
+    return _file_descriptors[static_cast<size_t>(counter)] >= 0;
+  }
+
+  PerformanceCounterValues read() const {
+    auto values = PerformanceCounterValues{};
+    for (auto counter_index = size_t{0}; counter_index < PERFORMANCE_COUNTER_COUNT; ++counter_index) {
+      if (_file_descriptors[counter_index] < 0) continue;
+
+      auto value = uint64_t{0};
+      if (::read(_file_descriptors[counter_index], &value, sizeof(value)) == sizeof(value)) {
+        values.values[counter_index] = value;
+      }
+    }
+    return values;
+  }
+
+ protected:
+  std::array<int, PERFORMANCE_COUNTER_COUNT> _file_descriptors;
+};
+
+const ThreadCounters& thread_counters() {
+  thread_local const auto counters = ThreadCounters{};
+  return counters;
+}
+
+}  // namespace
+
+std::string performance_counter_name(const PerformanceCounter counter) {
+  switch (counter) {
+    case PerformanceCounter::Cycles:
+      return "cycles";
+    case PerformanceCounter::Instructions:
+      return "instructions";
+    case PerformanceCounter::CacheMisses:
+      return "cache misses";
+    case PerformanceCounter::BranchMisses:
+      return "branch misses";
+  }
+  Fail("Unknown performance counter");
+  return {};
+}
+
+std::optional<uint64_t> PerformanceCounterValues::get(const PerformanceCounter counter) const {
+  return values[static_cast<size_t>(counter)];
+}
+
+PerformanceCounterValues PerformanceCounterValues::operator-(const PerformanceCounterValues& other) const {
+  auto difference = PerformanceCounterValues{};
+  for (auto counter_index = size_t{0}; counter_index < PERFORMANCE_COUNTER_COUNT; ++counter_index) {
+    if (values[counter_index] && other.values[counter_index]) {
+      difference.values[counter_index] = *values[counter_index] - *other.values[counter_index];
+    }
+  }
+  return difference;
+}
+
+PerformanceCounterValues& PerformanceCounterValues::operator+=(const PerformanceCounterValues& other) {
+  for (auto counter_index = size_t{0}; counter_index < PERFORMANCE_COUNTER_COUNT; ++counter_index) {
+    if (!other.values[counter_index]) continue;
+    values[counter_index] = values[counter_index].value_or(0) + *other.values[counter_index];
+  }
+  return *this;
+}
+
+std::string PerformanceCounterValues::to_string(const uint64_t row_count) const {
+  auto stream = std::stringstream{};
+  stream << std::fixed << std::setprecision(1);
+
+  auto first_counter = true;
+  for (auto counter_index = size_t{0}; counter_index < PERFORMANCE_COUNTER_COUNT; ++counter_index) {
+    if (!values[counter_index]) continue;
+
+    stream << (first_counter ? "" : ", ") << *values[counter_index] << " "
+           << performance_counter_name(static_cast<PerformanceCounter>(counter_index));
+    if (row_count > 0) stream << " (" << static_cast<double>(*values[counter_index]) / row_count << "/row)";
+    first_counter = false;
+  }
+  if (first_counter) return "no performance counters available";
+
+  const auto cycles = get(PerformanceCounter::Cycles);
+  const auto instructions = get(PerformanceCounter::Instructions);
+  if (cycles && instructions && *cycles > 0) {
+    stream << ", " << std::setprecision(2) << static_cast<double>(*instructions) / *cycles << " IPC";
+  }
+  return stream.str();
+}
+
+std::atomic_bool PerformanceCounters::_is_enabled{false};
+std::mutex PerformanceCounters::_kernel_statistics_mutex;
+std::map<std::string, KernelStatistics> PerformanceCounters::_kernel_statistics;
+
+void PerformanceCounters::set_enabled(const bool enabled) { _is_enabled = enabled; }
+
+bool PerformanceCounters::is_enabled() { return _is_enabled.load(std::memory_order_relaxed); }
+
+bool PerformanceCounters::is_available(const PerformanceCounter counter) {
+  return thread_counters().is_available(counter);
+}
+
+PerformanceCounterValues PerformanceCounters::read() { return thread_counters().read(); }
+
+void PerformanceCounters::add_kernel_measurement(const std::string& kernel_name,
+                                                 const PerformanceCounterValues& counters, const uint64_t row_count) {
+  std::lock_guard<std::mutex> lock(_kernel_statistics_mutex);
+  auto& statistics = _kernel_statistics[kernel_name];
+  ++statistics.invocation_count;
+  statistics.row_count += row_count;
+  statistics.counters += counters;
+}
+
+std::map<std::string, KernelStatistics> PerformanceCounters::kernel_statistics() {
+  std::lock_guard<std::mutex> lock(_kernel_statistics_mutex);
+  return _kernel_statistics;
+}
+
+void PerformanceCounters::print_kernel_statistics(std::ostream& out) {
+  for (const auto& [kernel_name, statistics] : kernel_statistics()) {
+    out << kernel_name << ": " << statistics.invocation_count << " invocations, " << statistics.row_count
+        << " rows, " << statistics.counters.to_string(statistics.row_count) << std::endl;
+  }
+}
+
+void PerformanceCounters::clear_kernel_statistics() {
+  std::lock_guard<std::mutex> lock(_kernel_statistics_mutex);
+  _kernel_statistics.clear();
+}
+
+PerformanceCounterScope::PerformanceCounterScope(const char* kernel_name, const uint64_t row_count)
+    : _is_enabled(PerformanceCounters::is_enabled()), _kernel_name(kernel_name), _row_count(row_count) {
+  if (_is_enabled) _begin = PerformanceCounters::read();
+}
+
+PerformanceCounterScope::~PerformanceCounterScope() {
+  if (!_is_enabled) return;
+  PerformanceCounters::add_kernel_measurement(_kernel_name, PerformanceCounters::read() - _begin, _row_count);
+}
+
+void PerformanceCounterScope::set_row_count(const uint64_t row_count) { _row_count = row_count; }
+
+}  // namespace opossum
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class PerformanceCounter : uint8_t { Cycles, Instructions, CacheMisses, BranchMisses };
+
+constexpr size_t PERFORMANCE_COUNTER_COUNT = 4;
+
+// returns the name of the counter, e.g., "cache misses"
+std::string performance_counter_name(const PerformanceCounter counter);
+
+// Counter values of a measured piece of work. Counters that are not available (see PerformanceCounters) are nullopt.
+struct PerformanceCounterValues {
+  std::optional<uint64_t> get(const PerformanceCounter counter) const;
+
+  PerformanceCounterValues operator-(const PerformanceCounterValues& other) const;
+  PerformanceCounterValues& operator+=(const PerformanceCounterValues& other);
+
+  // returns the available counters, each also divided by row_count if it is not zero, e.g.,
+  // "1200 cycles (12.0/row), 3000 instructions (30.0/row), 0.4 IPC"
+  std::string to_string(const uint64_t row_count = 0) const;
+
+  std::array<std::optional<uint64_t>, PERFORMANCE_COUNTER_COUNT> values;
+};
+
+// accumulated over all measurements of a kernel
+struct KernelStatistics {
+  uint64_t invocation_count = 0;
+  uint64_t row_count = 0;
+  PerformanceCounterValues counters;
+};
+
+// PerformanceCounters measures the hardware counters of the calling thread with perf_event_open. Every thread opens
+// its counters once, when it first reads them. Counters that the kernel refuses to open (e.g., in containers without
+// CAP_PERFMON or with perf_event_paranoid > 2, or in VMs without a PMU) are reported as unavailable instead of
+// failing, so that instrumented code runs everywhere.
+//
+// Measuring is disabled by default. While it is enabled, PerformanceCounterScopes accumulate the counters of
+// instrumented kernels (TableScan chunks, DictionarySegment construction, load_table) and AbstractOperator::execute
+// adds them to the OperatorPerformanceData of every operator.
+class PerformanceCounters {
+ public:
+  static void set_enabled(const bool enabled);
+
+  static bool is_enabled();
+
+  // returns whether the given counter could be opened by the calling thread
+  static bool is_available(const PerformanceCounter counter);
+
+  // returns the counters of the calling thread, i.e., what it has done since it opened them
+  static PerformanceCounterValues read();
+
+  // adds a measurement to the statistics of the kernel
+  static void add_kernel_measurement(const std::string& kernel_name, const PerformanceCounterValues& counters,
+                                     const uint64_t row_count);
+
+  static std::map<std::string, KernelStatistics> kernel_statistics();
+
+  // prints one line per kernel with the counters per row
+  static void print_kernel_statistics(std::ostream& out = std::cout);
+
+  static void clear_kernel_statistics();
+
+ protected:
+  static std::atomic_bool _is_enabled;
+
+  static std::mutex _kernel_statistics_mutex;
+  static std::map<std::string, KernelStatistics> _kernel_statistics;
+};
+
+// PerformanceCounterScope measures the counters from its construction to its destruction and adds them to the
+// statistics of the kernel. The number of rows that the kernel processed has to be set for per-row numbers.
+class PerformanceCounterScope : private Noncopyable {
+ public:
+  explicit PerformanceCounterScope(const char* kernel_name, const uint64_t row_count = 0);
+  ~PerformanceCounterScope();
+
+  void set_row_count(const uint64_t row_count);
+
+ protected:
+  const bool _is_enabled;
+  const char* const _kernel_name;
+  uint64_t _row_count;
+  PerformanceCounterValues _begin;
+};
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Deferred reclamation for objects that readers access through atomic raw pointers without taking a lock. A reader
+// holds a ReadGuard while it loads such a pointer and uses the object. A writer unlinks an object by exchanging the
+// pointer and then retires it. Retired objects are deleted by a later retire() that finds no reader holding a guard,
+// or when the list is destroyed.
+//
+// Readers only increment and decrement a counter, so they never block and never enter the mutex pool that
+// std::atomic_load on shared_ptrs uses. All counter and pointer operations have to be sequentially consistent: a
+// writer that reads a zero count after its exchange knows that every later reader loads the new pointer. The price is
+// that retired objects accumulate as long as every retire() overlaps with a reader.
+template <typename T>
+class RetireList : private Noncopyable {
+ public:
+  class ReadGuard : private Noncopyable {
+   public:
+    explicit ReadGuard(const RetireList& retire_list) : _active_reader_count{retire_list._active_reader_count} {
+      _active_reader_count.fetch_add(1);
+    }
+
+    ~ReadGuard() { _active_reader_count.fetch_sub(1); }
+
+   protected:
+    std::atomic<uint32_t>& _active_reader_count;
+  };
+
+  RetireList() = default;
+
+  ~RetireList() {
+    for (const auto object : _retired_objects) delete object;
+  }
+
+  // Takes ownership of an object that readers can no longer load and deletes all retired objects if no reader holds a
+  // guard. Writers may call it concurrently.
+  void retire(const T* object) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _retired_objects.push_back(object);
+    if (_active_reader_count.load() != 0) return;
+
+    for (const auto retired_object : _retired_objects) delete retired_object;
+    _retired_objects.clear();
+  }
+
+ protected:
+  mutable std::atomic<uint32_t> _active_reader_count{0};
+  std::mutex _mutex;
+  std::vector<const T*> _retired_objects;
+};
+
+}  // namespace opossum
@@ -0,0 +1,179 @@
+#include "tracer.hpp"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+struct TraceEvent {
+  std::string name;
+  const char* category = nullptr;
+  std::chrono::steady_clock::time_point begin;
+  std::chrono::steady_clock::time_point end;
+};
+
+void write_json_string(std::ostream& out, const std::string& string) {
+  out << '"';
+  for (const auto character : string) {
+    if (character == '"' || character == '\\') {
+      out << '\\' << character;
+    } else if (static_cast<unsigned char>(character) < 0x20) {
+      out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character) << std::dec;
+    } else {
+      out << character;
+    }
+  }
+  out << '"';
+}
+
+}  // namespace
+
+// TraceBuffer is a linked list of blocks that only its own thread appends to. An event is written before the size of
+// its block is increased (with release semantics), so that concurrent readers never see partially written events.
+class TraceBuffer {
+ public:
+  static constexpr size_t BLOCK_SIZE = 1024;
+
+  struct Block {
+    std::array<TraceEvent, BLOCK_SIZE> events;
+    std::atomic<size_t> size{0};
+    std::atomic<Block*> next{nullptr};
+  };
+
+  TraceBuffer() : thread_id(static_cast<int64_t>(syscall(SYS_gettid))), _head(std::make_unique<Block>()) {
+    _tail = _head.get();
+  }
+
+  ~TraceBuffer() { clear(); }
+
+  void append(TraceEvent&& event) {
+    auto size = _tail->size.load(std::memory_order_relaxed);
+    if (size == BLOCK_SIZE) {
+      auto* const block = new Block{};
+      _tail->next.store(block, std::memory_order_release);
+      _tail = block;
+      size = 0;
+    }
+    _tail->events[size] = std::move(event);
+    _tail->size.store(size + 1, std::memory_order_release);
+  }
+
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    for (const auto* block = _head.get(); block; block = block->next.load(std::memory_order_acquire)) {
+      const auto size = block->size.load(std::memory_order_acquire);
+      for (auto event_index = size_t{0}; event_index < size; ++event_index) functor(block->events[event_index]);
+    }
+  }
+
+  void clear() {
+    auto* block = _head->next.exchange(nullptr);
+    while (block) {
+      auto* const next = block->next.load();
+      delete block;
+      block = next;
+    }
+    _head->size = 0;
+    _tail = _head.get();
+  }
+
+  const int64_t thread_id;
+
+ protected:
+  const std::unique_ptr<Block> _head;
+  Block* _tail;
+};
+
+std::atomic_bool Tracer::_is_enabled{false};
+std::mutex Tracer::_buffers_mutex;
+std::vector<std::unique_ptr<TraceBuffer>> Tracer::_buffers;
+
+void Tracer::set_enabled(const bool enabled) { _is_enabled = enabled; }
+
+bool Tracer::is_enabled() { return _is_enabled.load(std::memory_order_relaxed); }
+
+void Tracer::record(const char* category, std::string name, const std::chrono::steady_clock::time_point begin,
+                    const std::chrono::steady_clock::time_point end) {
+  _buffer_of_this_thread().append(TraceEvent{std::move(name), category, begin, end});
+}
+
+size_t Tracer::event_count() {
+  std::lock_guard<std::mutex> lock(_buffers_mutex);
+  auto count = size_t{0};
+  for (const auto& buffer : _buffers) {
+    buffer->for_each([&](const TraceEvent&) { ++count; });
+  }
+  return count;
+}
+
+void Tracer::write_chrome_trace(std::ostream& out) {
+  std::lock_guard<std::mutex> lock(_buffers_mutex);
+  const auto process_id = static_cast<int64_t>(getpid());
+
+  // Events are "complete" events (ph X), which carry both the begin and the duration. Timestamps are in microseconds.
+  const auto flags = out.flags();
+  const auto precision = out.precision();
+  out << std::fixed << std::setprecision(3);
+
+  out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  auto first_event = true;
+  for (const auto& buffer : _buffers) {
+    buffer->for_each([&](const TraceEvent& event) {
+      const auto begin = std::chrono::duration<double, std::micro>(event.begin.time_since_epoch()).count();
+      const auto duration = std::chrono::duration<double, std::micro>(event.end - event.begin).count();
+
+      out << (first_event ? "\n" : ",\n") << "{\"name\":";
+      write_json_string(out, event.name);
+      out << ",\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"pid\":" << process_id
+          << ",\"tid\":" << buffer->thread_id << ",\"ts\":" << begin << ",\"dur\":" << duration << "}";
+      first_event = false;
+    });
+  }
+  out << "\n]}\n";
+
+  out.flags(flags);
+  out.precision(precision);
+}
+
+void Tracer::write_chrome_trace(const std::string& file_name) {
+  auto file = std::ofstream{file_name};
+  Assert(file.is_open(), "Could not open " + file_name + " for writing the trace");
+  write_chrome_trace(file);
+}
+
+void Tracer::clear() {
+  std::lock_guard<std::mutex> lock(_buffers_mutex);
+  for (const auto& buffer : _buffers) buffer->clear();
+}
+
+TraceBuffer& Tracer::_buffer_of_this_thread() {
+  thread_local auto* const buffer = []() {
+    std::lock_guard<std::mutex> lock(_buffers_mutex);
+    _buffers.push_back(std::make_unique<TraceBuffer>());
+    return _buffers.back().get();
+  }();
+  return *buffer;
+}
+
+TraceScope::TraceScope(const char* category, std::string name)
+    : _is_enabled(Tracer::is_enabled()), _category(category), _name(std::move(name)) {
+  if (_is_enabled) _begin = std::chrono::steady_clock::now();
+}
+
+TraceScope::~TraceScope() {
+  if (_is_enabled) Tracer::record(_category, std::move(_name), _begin, std::chrono::steady_clock::now());
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class TraceBuffer;
+
+// Tracer records what every thread works on (operators, the chunks of a Pipeline, compression, table loading) and
+// exports the events as a Chrome trace, which chrome://tracing and https://ui.perfetto.dev display as a timeline.
+// Tracing is disabled by default, in which case a TraceScope only checks the flag.
+//
+// Every thread appends to its own buffer, which is registered once when the thread records its first event. Appending
+// takes no locks, so tracing does not serialize the traced threads. Buffers outlive their threads, so the events of
+// scheduler workers that have already finished can still be exported.
+class Tracer {
+ public:
+  // enables or disables tracing for all scopes that start afterwards
+  static void set_enabled(const bool enabled);
+
+  static bool is_enabled();
+
+  // Appends an event of the calling thread. Called by TraceScope.
+  static void record(const char* category, std::string name, const std::chrono::steady_clock::time_point begin,
+                     const std::chrono::steady_clock::time_point end);
+
+  // returns the number of events recorded by all threads
+  static size_t event_count();
+
+  // writes all events recorded so far in the Chrome trace event format. Threads may keep tracing while this runs.
+  static void write_chrome_trace(std::ostream& out);
+
+  static void write_chrome_trace(const std::string& file_name);
+
+  // Drops all events. Must not be called while other threads are tracing.
+  static void clear();
+
+ protected:
+  static TraceBuffer& _buffer_of_this_thread();
+
+  static std::atomic_bool _is_enabled;
+
+  // only locked when a thread records its first event and when exporting
+  static std::mutex _buffers_mutex;
+  static std::vector<std::unique_ptr<TraceBuffer>> _buffers;
+};
+
+// TraceScope records an event from its construction to its destruction, e.g.,
+//
+// {
+//   const auto trace_scope = TraceScope{"operator", "TableScan"};
+//   ...
+// }
+//
+// Callers that have to build the name should only do so while Tracer::is_enabled.
+class TraceScope : private Noncopyable {
+ public:
+  TraceScope(const char* category, std::string name);
+  ~TraceScope();
+
+ protected:
+  const bool _is_enabled;
+  const char* const _category;
+  std::string _name;
+  std::chrono::steady_clock::time_point _begin;
+};
+
+}  // namespace opossum
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "concurrency/transaction_manager.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
@@ -37,19 +38,19 @@ BaseTest::Matrix BaseTest::_table_to_matrix(const Table& table) {
   // set values
   unsigned row_offset = 0;
   for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
-    const Chunk& chunk = table.get_chunk(chunk_id);
+    const auto chunk = table.get_chunk(chunk_id);
 
     // an empty table's chunk might be missing actual segments
-    if (chunk.size() == 0) continue;
+    if (chunk->size() == 0) continue;
 
     for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
-      std::shared_ptr<BaseSegment> segment = chunk.get_segment(column_id);
+      std::shared_ptr<BaseSegment> segment = chunk->get_segment(column_id);
 
-      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk->size(); ++chunk_offset) {
         matrix[row_offset + chunk_offset][column_id] = (*segment)[chunk_offset];
       }
     }
-    row_offset += chunk.size();
+    row_offset += chunk->size();
   }
 
   return matrix;
@@ -79,22 +80,22 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& matrix) {
   }
 
   //  - column names and types
-  std::string left_data_type, right_data_type;
+  DataType left_data_type, right_data_type;
   for (ColumnID column_id{0}; column_id < tright.column_count(); ++column_id) {
     left_data_type = tleft.column_type(column_id);
     right_data_type = tright.column_type(column_id);
     // This is needed for the SQLiteTestrunner, since SQLite does not differentiate between float/double, and int/long.
     if (!strict_types) {
-      if (left_data_type == "double") {
-        left_data_type = "float";
-      } else if (left_data_type == "long") {
-        left_data_type = "int";
+      if (left_data_type == DataType::Double) {
+        left_data_type = DataType::Float;
+      } else if (left_data_type == DataType::Long) {
+        left_data_type = DataType::Int;
       }
 
-      if (right_data_type == "double") {
-        right_data_type = "float";
-      } else if (right_data_type == "long") {
-        right_data_type = "int";
+      if (right_data_type == DataType::Double) {
+        right_data_type = DataType::Float;
+      } else if (right_data_type == DataType::Long) {
+        right_data_type = DataType::Int;
       }
     }
     if (left_data_type != right_data_type || tleft.column_name(column_id) != tright.column_name(column_id)) {
@@ -124,28 +125,31 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& matrix) {
 
   for (unsigned row = 0; row < left.size(); row++)
     for (ColumnID column_id{0}; column_id < left[row].size(); column_id++) {
-      if (tleft.column_type(column_id) == "float") {
+      if (tleft.column_type(column_id) == DataType::Float) {
         auto left_val = type_cast<float>(left[row][column_id]);
         auto right_val = type_cast<float>(right[row][column_id]);
 
         if (strict_types) {
-          EXPECT_EQ(tright.column_type(column_id), "float");
+          EXPECT_EQ(tright.column_type(column_id), DataType::Float);
         } else {
-          EXPECT_TRUE(tright.column_type(column_id) == "float" || tright.column_type(column_id) == "double");
+          const auto right_type = tright.column_type(column_id);
+          EXPECT_TRUE(right_type == DataType::Float || right_type == DataType::Double);
         }
         EXPECT_NEAR(left_val, right_val, 0.0001) << "Row/Column:" << row << "/" << column_id;
-      } else if (tleft.column_type(column_id) == "double") {
+      } else if (tleft.column_type(column_id) == DataType::Double) {
         auto left_val = type_cast<double>(left[row][column_id]);
         auto right_val = type_cast<double>(right[row][column_id]);
 
         if (strict_types) {
-          EXPECT_EQ(tright.column_type(column_id), "double");
+          EXPECT_EQ(tright.column_type(column_id), DataType::Double);
         } else {
-          EXPECT_TRUE(tright.column_type(column_id) == "float" || tright.column_type(column_id) == "double");
+          const auto right_type = tright.column_type(column_id);
+          EXPECT_TRUE(right_type == DataType::Float || right_type == DataType::Double);
         }
         EXPECT_NEAR(left_val, right_val, 0.0001) << "Row/Column:" << row << "/" << column_id;
       } else {
-        if (!strict_types && (tleft.column_type(column_id) == "int" || tleft.column_type(column_id) == "long")) {
+        const auto left_type = tleft.column_type(column_id);
+        if (!strict_types && (left_type == DataType::Int || left_type == DataType::Long)) {
           auto left_val = type_cast<int64_t>(left[row][column_id]);
           auto right_val = type_cast<int64_t>(right[row][column_id]);
           EXPECT_EQ(left_val, right_val) << "Row:" << row + 1 << " Column_id:" << column_id + 1;
@@ -158,6 +162,9 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& matrix) {
   return ::testing::AssertionSuccess();
 }
 
-BaseTest::~BaseTest() { StorageManager::get().reset(); }
+BaseTest::~BaseTest() {
+  StorageManager::get().reset();
+  TransactionManager::reset();
+}
 
 }  // namespace opossum
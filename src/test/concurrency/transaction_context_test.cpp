@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TransactionContextTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", DataType::Int);
+    _table->append({1});
+    _table->append({2});
+  }
+
+  bool is_visible(const Snapshot& snapshot, const RowID row_id) const {
+    return _table->get_chunk(row_id.chunk_id)->mvcc_data()->is_visible(snapshot, row_id.chunk_offset);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TransactionContextTest, CommitIds) {
+  auto& transaction_manager = TransactionManager::get();
+  EXPECT_EQ(transaction_manager.last_commit_id(), 0u);
+
+  const auto first_transaction = transaction_manager.new_transaction_context();
+  const auto second_transaction = transaction_manager.new_transaction_context();
+  EXPECT_NE(first_transaction->transaction_id(), second_transaction->transaction_id());
+  EXPECT_EQ(first_transaction->snapshot_commit_id(), 0u);
+
+  EXPECT_EQ(second_transaction->commit(), 1u);
+  EXPECT_EQ(first_transaction->commit(), 2u);
+  EXPECT_EQ(transaction_manager.last_commit_id(), 2u);
+  EXPECT_EQ(first_transaction->phase(), TransactionPhase::Committed);
+  EXPECT_THROW(first_transaction->commit(), std::logic_error);
+}
+
+TEST_F(TransactionContextTest, InsertIsVisibleAfterCommit) {
+  const auto transaction = TransactionManager::get().new_transaction_context();
+  _table->append({3}, *transaction);
+  const auto row_id = RowID{ChunkID{0}, 2};
+
+  EXPECT_TRUE(is_visible(transaction->snapshot(), row_id));
+  EXPECT_FALSE(is_visible(TransactionManager::get().latest_snapshot(), row_id));
+
+  const auto concurrent_transaction = TransactionManager::get().new_transaction_context();
+  transaction->commit();
+  EXPECT_TRUE(is_visible(TransactionManager::get().latest_snapshot(), row_id));
+  EXPECT_FALSE(is_visible(concurrent_transaction->snapshot(), row_id));
+
+  // rows that were appended without a transaction are visible to everyone
+  EXPECT_TRUE(is_visible(concurrent_transaction->snapshot(), RowID{ChunkID{0}, 0}));
+}
+
+TEST_F(TransactionContextTest, RollbackDiscardsChanges) {
+  {
+    const auto transaction = TransactionManager::get().new_transaction_context();
+    _table->append({3}, *transaction);
+    EXPECT_TRUE(_table->delete_row(RowID{ChunkID{0}, 0}, *transaction));
+    EXPECT_FALSE(is_visible(transaction->snapshot(), RowID{ChunkID{0}, 0}));
+    // the destructor rolls the transaction back
+  }
+
+  const auto snapshot = TransactionManager::get().new_transaction_context()->snapshot();
+  EXPECT_TRUE(is_visible(snapshot, RowID{ChunkID{0}, 0}));
+  EXPECT_FALSE(is_visible(snapshot, RowID{ChunkID{0}, 2}));
+
+  // the row is not locked anymore
+  const auto transaction = TransactionManager::get().new_transaction_context();
+  EXPECT_TRUE(_table->delete_row(RowID{ChunkID{0}, 0}, *transaction));
+}
+
+TEST_F(TransactionContextTest, WriteWriteConflict) {
+  const auto first_transaction = TransactionManager::get().new_transaction_context();
+  const auto second_transaction = TransactionManager::get().new_transaction_context();
+
+  EXPECT_TRUE(_table->delete_row(RowID{ChunkID{0}, 1}, *first_transaction));
+  EXPECT_FALSE(_table->delete_row(RowID{ChunkID{0}, 1}, *second_transaction));
+
+  // the row stays locked after the commit, so that transactions with an older snapshot cannot delete it either
+  first_transaction->commit();
+  EXPECT_FALSE(_table->delete_row(RowID{ChunkID{0}, 1}, *second_transaction));
+  EXPECT_TRUE(is_visible(second_transaction->snapshot(), RowID{ChunkID{0}, 1}));
+  EXPECT_FALSE(is_visible(TransactionManager::get().latest_snapshot(), RowID{ChunkID{0}, 1}));
+}
+
+TEST_F(TransactionContextTest, VisibleRowsAreCheckedAtOnce) {
+  const auto transaction = TransactionManager::get().new_transaction_context();
+  _table->append({3}, *transaction);
+  EXPECT_TRUE(_table->delete_row(RowID{ChunkID{0}, 0}, *transaction));
+
+  const auto mvcc_data = _table->get_chunk(ChunkID{0})->mvcc_data();
+  EXPECT_TRUE(mvcc_data->modified());
+
+  auto visible_rows = std::vector<uint8_t>{};
+  mvcc_data->get_visible_rows(transaction->snapshot(), 3, visible_rows);
+  EXPECT_EQ(visible_rows, (std::vector<uint8_t>{0, 1, 1}));
+  mvcc_data->get_visible_rows(TransactionManager::get().latest_snapshot(), 3, visible_rows);
+  EXPECT_EQ(visible_rows, (std::vector<uint8_t>{1, 1, 0}));
+}
+
+TEST_F(TransactionContextTest, TablesWithLargeChunks) {
+  // chunks of the default size are grown by copying them while rows are appended, the copies share the MVCC columns
+  auto table = Table{};
+  table.add_column("a", DataType::Int);
+  for (auto value = 0; value < 3'000; ++value) table.append({value});
+
+  const auto transaction = TransactionManager::get().new_transaction_context();
+  table.append({3'000}, *transaction);
+  EXPECT_TRUE(table.delete_row(RowID{ChunkID{0}, 2'500}, *transaction));
+  transaction->commit();
+
+  auto visible_rows = std::vector<uint8_t>{};
+  table.get_chunk(ChunkID{0})->mvcc_data()->get_visible_rows(TransactionManager::get().latest_snapshot(), 3'001,
+                                                             visible_rows);
+  EXPECT_EQ(std::count(visible_rows.cbegin(), visible_rows.cend(), 1), 3'000);
+  EXPECT_EQ(visible_rows[2'500], 0);
+  EXPECT_EQ(visible_rows[3'000], 1);
+}
+
+TEST_F(TransactionContextTest, ConcurrentTransactions) {
+  constexpr auto thread_count = 4;
+  constexpr auto transactions_per_thread = 100;
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto transaction_index = 0; transaction_index < transactions_per_thread; ++transaction_index) {
+        const auto transaction = TransactionManager::get().new_transaction_context();
+        _table->append({thread_id}, *transaction);
+        _table->append({thread_id}, *transaction);
+        if (transaction_index % 2 == 0) {
+          transaction->commit();
+        } else {
+          transaction->rollback();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  auto visible_row_count = size_t{0};
+  const auto snapshot = TransactionManager::get().latest_snapshot();
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      visible_row_count += chunk->mvcc_data()->is_visible(snapshot, chunk_offset);
+    }
+  }
+  EXPECT_EQ(visible_row_count, 2u + thread_count * transactions_per_thread);
+  EXPECT_EQ(TransactionManager::get().last_commit_id(),
+            static_cast<CommitID>(thread_count * transactions_per_thread / 2));
+}
+
+}  // namespace opossum
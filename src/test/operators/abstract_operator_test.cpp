@@ -0,0 +1,95 @@
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsAbstractOperatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", DataType::Int);
+    for (auto value = 0; value < 20; ++value) _table->append({value});
+  }
+
+  void TearDown() override { CurrentScheduler::set(nullptr); }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsAbstractOperatorTest, ExecuteAsyncWithoutScheduler) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 5);
+
+  auto future = table_scan->execute_async();
+  EXPECT_TRUE(table_scan->executed());
+  EXPECT_EQ(future.get()->row_count(), 5u);
+}
+
+TEST_F(OperatorsAbstractOperatorTest, ConcurrentQueries) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::fake(1, 2)));
+
+  // many more queries than workers are in flight at the same time
+  auto futures = std::vector<std::future<std::shared_ptr<const Table>>>{};
+  for (auto query = 0; query < 16; ++query) {
+    auto table_wrapper = std::make_shared<TableWrapper>(_table);
+    auto left_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, query);
+    auto right_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+    auto join = std::make_shared<JoinHash>(left_scan, right_scan, ColumnID{0}, ColumnID{0});
+    futures.push_back(join->execute_async());
+  }
+
+  for (auto query = 0; query < 16; ++query) {
+    EXPECT_EQ(futures[query].get()->row_count(), static_cast<uint64_t>(query));
+  }
+}
+
+TEST_F(OperatorsAbstractOperatorTest, ExecuteAsyncCallback) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::fake(1, 2)));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 15);
+
+  auto promise = std::promise<uint64_t>{};
+  table_scan->execute_async([&](std::shared_ptr<const Table> output, std::exception_ptr exception) {
+    EXPECT_FALSE(exception);
+    promise.set_value(output->row_count());
+  });
+
+  EXPECT_EQ(promise.get_future().get(), 4u);
+}
+
+TEST_F(OperatorsAbstractOperatorTest, ExecuteAsyncFailure) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::fake(1, 2)));
+
+  // operators must not be executed twice
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  table_scan->execute();
+
+  auto callback_exception = std::promise<std::exception_ptr>{};
+  auto future = table_scan->execute_async([&](std::shared_ptr<const Table> output, std::exception_ptr exception) {
+    EXPECT_EQ(output, nullptr);
+    callback_exception.set_value(exception);
+  });
+
+  EXPECT_THROW(future.get(), std::logic_error);
+  EXPECT_TRUE(callback_exception.get_future().get());
+}
+
+}  // namespace opossum
@@ -0,0 +1,169 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // chunks 0 to 2 are dictionary-compressed, chunk 3 holds the last two rows in ValueSegments
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", DataType::Int);
+    _table->add_column("b", DataType::Float);
+    _table->add_column("c", DataType::String);
+    for (auto row = 0; row < 14; ++row) {
+      _table->append({row % 7, row * 0.5f, "s" + std::to_string(row % 5)});
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{3}; ++chunk_id) _table->compress_chunk(chunk_id);
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsAggregateTest, DictionaryAndValueSegments) {
+  auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper, std::vector<AggregateDefinition>{{ColumnID{0}, AggregateFunction::Count},
+                                                        {ColumnID{0}, AggregateFunction::CountDistinct},
+                                                        {ColumnID{0}, AggregateFunction::Min},
+                                                        {ColumnID{0}, AggregateFunction::Max},
+                                                        {ColumnID{0}, AggregateFunction::Sum},
+                                                        {ColumnID{0}, AggregateFunction::Avg},
+                                                        {ColumnID{1}, AggregateFunction::Max},
+                                                        {ColumnID{1}, AggregateFunction::Sum},
+                                                        {ColumnID{2}, AggregateFunction::CountDistinct},
+                                                        {ColumnID{2}, AggregateFunction::Min},
+                                                        {ColumnID{2}, AggregateFunction::Max}});
+  aggregate->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("COUNT(a)", DataType::Long);
+  expected->add_column("COUNT DISTINCT(a)", DataType::Long);
+  expected->add_column("MIN(a)", DataType::Int);
+  expected->add_column("MAX(a)", DataType::Int);
+  expected->add_column("SUM(a)", DataType::Long);
+  expected->add_column("AVG(a)", DataType::Double);
+  expected->add_column("MAX(b)", DataType::Float);
+  expected->add_column("SUM(b)", DataType::Double);
+  expected->add_column("COUNT DISTINCT(c)", DataType::Long);
+  expected->add_column("MIN(c)", DataType::String);
+  expected->add_column("MAX(c)", DataType::String);
+  expected->append({int64_t{14}, int64_t{7}, 0, 6, int64_t{42}, 3.0, 6.5f, 45.5, int64_t{5}, "s0", "s4"});
+
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, DeletedRows) {
+  // deletes the rows with the smallest and the largest a from dictionary-compressed and uncompressed chunks
+  const auto transaction = TransactionManager::get().new_transaction_context();
+  for (const auto& row_id : {RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 2}, RowID{ChunkID{1}, 3}, RowID{ChunkID{3}, 1}}) {
+    ASSERT_TRUE(_table->delete_row(row_id, *transaction));
+  }
+
+  const auto aggregate_a = [&]() {
+    auto aggregate = std::make_shared<Aggregate>(
+        _table_wrapper, std::vector<AggregateDefinition>{{ColumnID{0}, AggregateFunction::Count},
+                                                          {ColumnID{0}, AggregateFunction::CountDistinct},
+                                                          {ColumnID{0}, AggregateFunction::Min},
+                                                          {ColumnID{0}, AggregateFunction::Max},
+                                                          {ColumnID{0}, AggregateFunction::Avg}});
+    aggregate->execute();
+    return aggregate->get_output();
+  };
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("COUNT(a)", DataType::Long);
+  expected->add_column("COUNT DISTINCT(a)", DataType::Long);
+  expected->add_column("MIN(a)", DataType::Int);
+  expected->add_column("MAX(a)", DataType::Int);
+  expected->add_column("AVG(a)", DataType::Double);
+
+  // others see the rows until the transaction commits
+  expected->append({int64_t{14}, int64_t{7}, 0, 6, 3.0});
+  EXPECT_TABLE_EQ(aggregate_a(), expected);
+
+  transaction->commit();
+  auto expected_after_commit = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < expected->column_count(); ++column_id) {
+    expected_after_commit->add_column(expected->column_name(column_id), expected->column_type(column_id));
+  }
+  expected_after_commit->append({int64_t{10}, int64_t{5}, 1, 5, 3.0});
+  EXPECT_TABLE_EQ(aggregate_a(), expected_after_commit);
+}
+
+TEST_F(OperatorsAggregateTest, ReferenceSegments) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 5);
+  scan->execute();
+
+  auto aggregate = std::make_shared<Aggregate>(
+      scan, std::vector<AggregateDefinition>{{ColumnID{0}, AggregateFunction::Count},
+                                             {ColumnID{0}, AggregateFunction::CountDistinct},
+                                             {ColumnID{0}, AggregateFunction::Min},
+                                             {ColumnID{0}, AggregateFunction::Sum}});
+  aggregate->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("COUNT(a)", DataType::Long);
+  expected->add_column("COUNT DISTINCT(a)", DataType::Long);
+  expected->add_column("MIN(a)", DataType::Int);
+  expected->add_column("SUM(a)", DataType::Long);
+  expected->append({int64_t{4}, int64_t{2}, 5, int64_t{22}});
+
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, CountDistinctOfSingleDictionary) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", DataType::Int);
+  for (const auto value : {3, 1, 3, 2}) table->append({value});
+  table->compress_chunk(ChunkID{0});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper, std::vector<AggregateDefinition>{{ColumnID{0}, AggregateFunction::CountDistinct}});
+  aggregate->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("COUNT DISTINCT(a)", DataType::Long);
+  expected->append({int64_t{3}});
+
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, InvalidAggregates) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", DataType::Int);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto count = std::make_shared<Aggregate>(
+      table_wrapper, std::vector<AggregateDefinition>{{ColumnID{0}, AggregateFunction::Count}});
+  count->execute();
+  EXPECT_EQ(count->get_output()->row_count(), 1u);
+
+  auto min = std::make_shared<Aggregate>(table_wrapper,
+                                         std::vector<AggregateDefinition>{{ColumnID{0}, AggregateFunction::Min}});
+  EXPECT_THROW(min->execute(), std::logic_error);
+
+  auto sum = std::make_shared<Aggregate>(_table_wrapper,
+                                         std::vector<AggregateDefinition>{{ColumnID{2}, AggregateFunction::Sum}});
+  EXPECT_THROW(sum->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,128 @@
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/explain.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/operator_performance_data.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsExplainTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto orders = std::make_shared<Table>(3);
+    orders->add_column("order_id", DataType::Int);
+    orders->add_column("customer_id", DataType::Int);
+    for (auto order_id = 0; order_id < 10; ++order_id) orders->append({order_id, order_id % 5});
+
+    auto customers = std::make_shared<Table>(2);
+    customers->add_column("customer_id", DataType::Int);
+    for (auto customer_id = 0; customer_id < 5; ++customer_id) customers->append({customer_id});
+
+    _orders_wrapper = std::make_shared<TableWrapper>(orders);
+    _customers_wrapper = std::make_shared<TableWrapper>(customers);
+    _order_scan = std::make_shared<TableScan>(_orders_wrapper, ColumnID{0}, ScanType::OpLessThan, 4);
+    _join = std::make_shared<JoinHash>(_order_scan, _customers_wrapper, ColumnID{1}, ColumnID{0});
+  }
+
+  void TearDown() override { OperatorPerformanceData::set_enabled(false); }
+
+  void _execute_plan() {
+    _orders_wrapper->execute();
+    _customers_wrapper->execute();
+    _order_scan->execute();
+    _join->execute();
+  }
+
+  static size_t _count_occurrences(const std::string& text, const std::string& pattern) {
+    auto count = size_t{0};
+    for (auto position = text.find(pattern); position != std::string::npos;
+         position = text.find(pattern, position + 1)) {
+      ++count;
+    }
+    return count;
+  }
+
+  std::shared_ptr<TableWrapper> _orders_wrapper, _customers_wrapper;
+  std::shared_ptr<TableScan> _order_scan;
+  std::shared_ptr<JoinHash> _join;
+};
+
+TEST_F(OperatorsExplainTest, RecordsPerformanceData) {
+  OperatorPerformanceData::set_enabled(true);
+  _execute_plan();
+
+  const auto& scan_data = _order_scan->performance_data();
+  EXPECT_TRUE(scan_data.has_data);
+  EXPECT_EQ(scan_data.input_row_count, 10u);
+  EXPECT_EQ(scan_data.input_chunk_count, 4u);
+  EXPECT_EQ(scan_data.output_row_count, 4u);
+  EXPECT_GT(scan_data.output_bytes, 0u);
+
+  const auto& join_data = _join->performance_data();
+  EXPECT_EQ(join_data.input_row_count, 9u);
+  EXPECT_EQ(join_data.output_row_count, 4u);
+  EXPECT_GT(join_data.walltime.count(), 0);
+
+  _join->reset();
+  EXPECT_FALSE(_join->performance_data().has_data);
+}
+
+TEST_F(OperatorsExplainTest, RecordsNothingWhenDisabled) {
+  _execute_plan();
+
+  EXPECT_FALSE(_order_scan->performance_data().has_data);
+  EXPECT_EQ(_order_scan->performance_data().to_string(), "not recorded");
+}
+
+TEST_F(OperatorsExplainTest, Descriptions) {
+  EXPECT_EQ(_order_scan->description(), "TableScan column 0 < 4");
+  EXPECT_EQ(_join->description(), "JoinHash column 1 = column 0");
+  EXPECT_EQ(_orders_wrapper->description(), "TableWrapper");
+
+  const auto placeholder_scan =
+      std::make_shared<TableScan>(_orders_wrapper, ColumnID{1}, ScanType::OpGreaterThanEquals, ParameterID{2});
+  EXPECT_EQ(placeholder_scan->description(), "TableScan column 1 >= $2");
+}
+
+TEST_F(OperatorsExplainTest, PrintTree) {
+  OperatorPerformanceData::set_enabled(true);
+  _execute_plan();
+
+  auto stream = std::stringstream{};
+  Explain::print(_join, stream);
+  const auto output = stream.str();
+
+  EXPECT_EQ(output.find("JoinHash column 1 = column 0 ["), 0u);
+  EXPECT_NE(output.find("\n  TableScan column 0 < 4 ["), std::string::npos);
+  EXPECT_NE(output.find("\n    TableWrapper ["), std::string::npos);
+  EXPECT_NE(output.find("10 rows / 4 chunks in, 4 rows"), std::string::npos);
+}
+
+TEST_F(OperatorsExplainTest, PrintGraphviz) {
+  _execute_plan();
+
+  // the orders table is the input of both the scan and the join
+  const auto self_join = std::make_shared<JoinHash>(_order_scan, _order_scan, ColumnID{0}, ColumnID{0});
+
+  auto stream = std::stringstream{};
+  Explain::print_graphviz(self_join, stream);
+  const auto output = stream.str();
+
+  EXPECT_EQ(output.find("digraph {"), 0u);
+  EXPECT_NE(output.find("label=\"TableScan column 0 < 4\\nnot recorded\""), std::string::npos);
+
+  // three operators, printed once each, and three edges
+  EXPECT_EQ(_count_occurrences(output, "label="), 3u);
+  EXPECT_EQ(_count_occurrences(output, "->"), 3u);
+}
+
+}  // namespace opossum
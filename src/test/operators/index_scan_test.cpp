@@ -0,0 +1,132 @@
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/index_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsIndexScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // three full chunks and one partially filled chunk
+    _table = std::make_shared<Table>(10);
+    _table->add_column("a", DataType::Int);
+    _table->add_column("b", DataType::Float);
+    for (auto row = 0; row < 35; ++row) {
+      _table->append({(row * 7) % 35, static_cast<float>(row)});
+    }
+
+    // chunk 0 is compressed and indexed by a group key index, chunk 1 by a B-tree, chunk 2 by an adaptive radix tree,
+    // chunk 3 is not indexed
+    _table->compress_chunk(ChunkID{0});
+    _table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(ColumnID{0});
+    _table->get_chunk(ChunkID{1})->create_index<BTreeIndex>(ColumnID{0});
+    _table->get_chunk(ChunkID{2})->create_index<AdaptiveRadixTreeIndex>(ColumnID{0});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // Compares the result of an IndexScan with the result of an equivalent TableScan
+  void check_against_table_scan(const SegmentIndexType index_type, const ScanType scan_type,
+                                const AllTypeVariant& search_value, const float fallback_selectivity = 1.0f) {
+    auto index_scan = std::make_shared<IndexScan>(_table_wrapper, index_type, ColumnID{0}, scan_type, search_value);
+    index_scan->set_fallback_selectivity(fallback_selectivity);
+    index_scan->execute();
+
+    auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, scan_type, search_value);
+    table_scan->execute();
+
+    EXPECT_TABLE_EQ(index_scan->get_output(), table_scan->get_output());
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsIndexScanTest, AllScanTypes) {
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto search_value : {-1, 0, 14, 15, 34, 40}) {
+      check_against_table_scan(SegmentIndexType::GroupKey, scan_type, search_value);
+      check_against_table_scan(SegmentIndexType::BTree, scan_type, search_value);
+      check_against_table_scan(SegmentIndexType::AdaptiveRadixTree, scan_type, search_value);
+    }
+  }
+}
+
+TEST_F(OperatorsIndexScanTest, OutputReferencesInputTable) {
+  auto index_scan = std::make_shared<IndexScan>(_table_wrapper, SegmentIndexType::GroupKey, ColumnID{0},
+                                                ScanType::OpEquals, 21);
+  index_scan->execute();
+
+  // 21 is stored in every fifth row, starting with row 3
+  const auto output = index_scan->get_output();
+  EXPECT_EQ(output->row_count(), 7u);
+
+  const auto reference_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{0})->get_segment(ColumnID{1}));
+  ASSERT_NE(reference_segment, nullptr);
+  EXPECT_EQ(reference_segment->referenced_table(), _table);
+  EXPECT_EQ(*reference_segment->pos_list(), (PosList{RowID{ChunkID{0}, 3}, RowID{ChunkID{0}, 8}}));
+}
+
+TEST_F(OperatorsIndexScanTest, OutputFollowsInputOrder) {
+  // the last chunk is still appended to, so it cannot be indexed and is scanned sequentially
+  EXPECT_THROW(_table->get_chunk(ChunkID{3})->create_index<BTreeIndex>(ColumnID{0}), std::exception);
+
+  auto index_scan = std::make_shared<IndexScan>(_table_wrapper, SegmentIndexType::BTree, ColumnID{0},
+                                                ScanType::OpLessThan, 5);
+  index_scan->execute();
+
+  const auto output = index_scan->get_output();
+  ASSERT_EQ(output->chunk_count(), 4u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto reference_segment =
+        std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    ASSERT_NE(reference_segment, nullptr);
+    EXPECT_EQ((*reference_segment->pos_list())[0].chunk_id, chunk_id);
+  }
+}
+
+TEST_F(OperatorsIndexScanTest, FallbackToTableScan) {
+  // Almost all rows qualify, so the scan is handed to a TableScan. The result has to be the same anyway.
+  check_against_table_scan(SegmentIndexType::BTree, ScanType::OpGreaterThan, 0, 0.25f);
+  check_against_table_scan(SegmentIndexType::GroupKey, ScanType::OpNotEquals, 3, 0.25f);
+}
+
+TEST_F(OperatorsIndexScanTest, CrackerIndex) {
+  // Cracker indexes are only used by the TableScan, as they do not hand out iterators
+  _table->enable_cracking(ColumnID{0});
+  check_against_table_scan(SegmentIndexType::Cracker, ScanType::OpLessThan, 14);
+  check_against_table_scan(SegmentIndexType::Cracker, ScanType::OpEquals, 21);
+}
+
+TEST_F(OperatorsIndexScanTest, ScanOnReferenceTable) {
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpLessThan, 20.0f);
+  table_scan->execute();
+
+  auto index_scan = std::make_shared<IndexScan>(table_scan, SegmentIndexType::GroupKey, ColumnID{0},
+                                                ScanType::OpLessThan, 10);
+  index_scan->execute();
+
+  auto expected = std::make_shared<TableScan>(table_scan, ColumnID{0}, ScanType::OpLessThan, 10);
+  expected->execute();
+
+  EXPECT_TABLE_EQ(index_scan->get_output(), expected->get_output());
+}
+
+}  // namespace opossum
@@ -0,0 +1,196 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/runtime_filter.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // every customer has two orders, chunk 0 and 2 hold customers 0 to 4, chunks 1 and 3 customers 5 to 9
+    auto orders = std::make_shared<Table>(5);
+    orders->add_column("order_id", DataType::Int);
+    orders->add_column("customer_id", DataType::Int);
+    for (auto order_id = 0; order_id < 20; ++order_id) orders->append({order_id, order_id % 10});
+    for (auto chunk_id = ChunkID{0}; chunk_id < orders->chunk_count(); ++chunk_id) orders->compress_chunk(chunk_id);
+
+    auto customers = std::make_shared<Table>(4);
+    customers->add_column("customer_id", DataType::Int);
+    customers->add_column("name", DataType::String);
+    for (auto customer_id = 0; customer_id < 10; ++customer_id) {
+      customers->append({customer_id, "customer" + std::to_string(customer_id)});
+    }
+
+    _orders = std::make_shared<TableWrapper>(orders);
+    _orders->execute();
+    _customer_table = customers;
+    _order_table = orders;
+    _customers = std::make_shared<TableWrapper>(customers);
+    _customers->execute();
+
+    _expected = std::make_shared<Table>();
+    _expected->add_column("order_id", DataType::Int);
+    _expected->add_column("customer_id", DataType::Int);
+    _expected->add_column("customer_id", DataType::Int);
+    _expected->add_column("name", DataType::String);
+    for (const auto order_id : {0, 1, 10, 11}) {
+      _expected->append({order_id, order_id % 10, order_id % 10, "customer" + std::to_string(order_id % 10)});
+    }
+  }
+
+  std::shared_ptr<Table> _order_table;
+  std::shared_ptr<Table> _customer_table;
+  std::shared_ptr<TableWrapper> _orders;
+  std::shared_ptr<TableWrapper> _customers;
+  std::shared_ptr<Table> _expected;
+};
+
+TEST_F(OperatorsJoinHashTest, JoinFilteredDimension) {
+  auto customer_scan = std::make_shared<TableScan>(_customers, ColumnID{0}, ScanType::OpLessThan, 2);
+  customer_scan->execute();
+  auto order_scan = std::make_shared<TableScan>(_orders, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  order_scan->execute();
+
+  auto join = std::make_shared<JoinHash>(order_scan, customer_scan, ColumnID{1}, ColumnID{0});
+  join->execute();
+
+  EXPECT_TABLE_EQ(join->get_output(), _expected);
+}
+
+TEST_F(OperatorsJoinHashTest, JoinDataTables) {
+  auto join = std::make_shared<JoinHash>(_customers, _orders, ColumnID{0}, ColumnID{1});
+  join->execute();
+
+  // every customer matches two orders
+  EXPECT_EQ(join->get_output()->row_count(), 20u);
+  EXPECT_EQ(join->get_output()->column_count(), 4u);
+}
+
+TEST_F(OperatorsJoinHashTest, JoinSkipsInvisibleRows) {
+  // the writer deletes customer 3, who has the orders 3 and 13, and order 7
+  const auto writer = TransactionManager::get().new_transaction_context();
+  EXPECT_TRUE(_customer_table->delete_row(RowID{ChunkID{0}, 3}, *writer));
+  EXPECT_TRUE(_order_table->delete_row(RowID{ChunkID{1}, 2}, *writer));
+
+  const auto join_row_count = [&](const std::shared_ptr<TransactionContext>& transaction_context) {
+    auto join = std::make_shared<JoinHash>(_orders, _customers, ColumnID{1}, ColumnID{0});
+    join->set_transaction_context(transaction_context);
+    join->execute();
+    return join->get_output()->row_count();
+  };
+
+  // the writer sees its own deletes on both the build and the probe side, others only after the commit
+  EXPECT_EQ(join_row_count(writer), 17u);
+  EXPECT_EQ(join_row_count(nullptr), 20u);
+
+  writer->commit();
+  EXPECT_EQ(join_row_count(nullptr), 17u);
+}
+
+TEST_F(OperatorsJoinHashTest, ScanOnJoinOutput) {
+  auto join = std::make_shared<JoinHash>(_orders, _customers, ColumnID{1}, ColumnID{0});
+  join->execute();
+
+  // the output columns reference the orders and the customers, both are scanned and filtered by a runtime filter
+  auto name_scan = std::make_shared<TableScan>(join, ColumnID{3}, ScanType::OpLessThan, "customer2");
+  name_scan->execute();
+  auto order_scan = std::make_shared<TableScan>(name_scan, ColumnID{0}, ScanType::OpNotEquals, 10);
+  order_scan->add_runtime_filter(ColumnID{2}, std::make_shared<RuntimeFilter>(name_scan, ColumnID{1}));
+  order_scan->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("order_id", DataType::Int);
+  expected->add_column("customer_id", DataType::Int);
+  expected->add_column("customer_id", DataType::Int);
+  expected->add_column("name", DataType::String);
+  expected->append({0, 0, 0, "customer0"});
+  expected->append({1, 1, 1, "customer1"});
+  expected->append({11, 1, 1, "customer1"});
+  EXPECT_TABLE_EQ(order_scan->get_output(), expected);
+
+  const auto output_chunk = order_scan->get_output()->get_chunk(ChunkID{0});
+  const auto order_segment = std::static_pointer_cast<const ReferenceSegment>(output_chunk->get_segment(ColumnID{1}));
+  const auto customer_segment =
+      std::static_pointer_cast<const ReferenceSegment>(output_chunk->get_segment(ColumnID{2}));
+  EXPECT_EQ(order_segment->referenced_table(), _orders->get_output());
+  EXPECT_EQ(order_segment->referenced_column_id(), ColumnID{1});
+  EXPECT_EQ(customer_segment->referenced_table(), _customers->get_output());
+  EXPECT_EQ(customer_segment->referenced_column_id(), ColumnID{0});
+}
+
+TEST_F(OperatorsJoinHashTest, RuntimeFilterReducesProbeSide) {
+  auto customer_scan = std::make_shared<TableScan>(_customers, ColumnID{0}, ScanType::OpLessThan, 2);
+  customer_scan->execute();
+
+  auto order_scan = std::make_shared<TableScan>(_orders, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  auto join = std::make_shared<JoinHash>(order_scan, customer_scan, ColumnID{1}, ColumnID{0});
+  order_scan->add_runtime_filter(ColumnID{1}, join->runtime_filter());
+  order_scan->execute();
+  join->execute();
+
+  EXPECT_EQ(join->runtime_filter()->build_key_count(), 2u);
+
+  // the dictionaries of chunks 1 and 3 hold no key of the build side, so they are not scanned at all
+  EXPECT_EQ(order_scan->skipped_chunk_count(), 2u);
+
+  // Rows of chunks 0 and 2 that are not ruled out by the filter are false positives, which the join drops
+  EXPECT_LT(order_scan->get_output()->row_count(), 10u);
+  EXPECT_TABLE_EQ(join->get_output(), _expected);
+}
+
+TEST_F(OperatorsJoinHashTest, RuntimeFilterOnReferenceTable) {
+  auto customer_scan = std::make_shared<TableScan>(_customers, ColumnID{1}, ScanType::OpEquals, "customer7");
+  customer_scan->execute();
+
+  auto order_scan = std::make_shared<TableScan>(_orders, ColumnID{0}, ScanType::OpLessThan, 15);
+  order_scan->execute();
+
+  // the second scan works on the ReferenceSegments of the first one
+  auto filtered_scan = std::make_shared<TableScan>(order_scan, ColumnID{0}, ScanType::OpNotEquals, 3);
+  filtered_scan->add_runtime_filter(ColumnID{1}, std::make_shared<RuntimeFilter>(customer_scan, ColumnID{0}));
+  filtered_scan->execute();
+
+  auto join = std::make_shared<JoinHash>(filtered_scan, customer_scan, ColumnID{1}, ColumnID{0});
+  join->execute();
+
+  ASSERT_EQ(join->get_output()->row_count(), 1u);
+  EXPECT_EQ(join->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0})->operator[](0), AllTypeVariant{7});
+}
+
+TEST_F(OperatorsJoinHashTest, RuntimeFilterIsRebuiltAfterReset) {
+  auto customer_scan = std::make_shared<TableScan>(_customers, ColumnID{0}, ScanType::OpLessThan, ParameterID{0});
+  auto order_scan = std::make_shared<TableScan>(_orders, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  auto join = std::make_shared<JoinHash>(order_scan, customer_scan, ColumnID{1}, ColumnID{0});
+  order_scan->add_runtime_filter(ColumnID{1}, join->runtime_filter());
+
+  const auto execute_plan = [&](const int max_customer_id) {
+    join->reset();
+    join->set_parameters({{ParameterID{0}, max_customer_id}});
+    _orders->execute();
+    _customers->execute();
+    customer_scan->execute();
+    order_scan->execute();
+    join->execute();
+    return join->get_output()->row_count();
+  };
+
+  EXPECT_EQ(execute_plan(2), 4u);
+  EXPECT_EQ(join->runtime_filter()->build_key_count(), 2u);
+
+  EXPECT_EQ(execute_plan(5), 10u);
+  EXPECT_EQ(join->runtime_filter()->build_key_count(), 5u);
+}
+
+}  // namespace opossum
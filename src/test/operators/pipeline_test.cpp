@@ -0,0 +1,119 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 20 chunks, the first half of them dictionary-compressed
+    auto table = std::make_shared<Table>(5);
+    table->add_column("a", DataType::Int);
+    table->add_column("b", DataType::Float);
+    for (auto row = 0; row < 100; ++row) table->append({row % 17, static_cast<float>(row)});
+    for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{10}; ++chunk_id) table->compress_chunk(chunk_id);
+
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+  }
+
+  void TearDown() override { CurrentScheduler::set(nullptr); }
+
+  std::shared_ptr<const AbstractOperator> _make_scans() const {
+    auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 5);
+    auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::OpLessThan, 80.0f);
+    return std::make_shared<TableScan>(scan_b, ColumnID{0}, ScanType::OpNotEquals, 10);
+  }
+
+  // executes the scans one after another on the (executed) table wrapper
+  std::shared_ptr<const Table> _expected_output() const {
+    auto scan_a = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 5);
+    scan_a->execute();
+    auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::OpLessThan, 80.0f);
+    scan_b->execute();
+    auto scan_c = std::make_shared<TableScan>(scan_b, ColumnID{0}, ScanType::OpNotEquals, 10);
+    scan_c->execute();
+    return scan_c->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsPipelineTest, Stages) {
+  const auto root = _make_scans();
+  const auto pipeline = std::make_shared<Pipeline>(root);
+
+  ASSERT_EQ(pipeline->stages().size(), 3u);
+  EXPECT_EQ(pipeline->stages().back(), root);
+  EXPECT_EQ(pipeline->input_left(), _table_wrapper);
+
+  EXPECT_THROW(std::make_shared<Pipeline>(_table_wrapper), std::logic_error);
+}
+
+TEST_F(OperatorsPipelineTest, SameOutputAsScans) {
+  const auto root = _make_scans();
+  auto pipeline = std::make_shared<Pipeline>(root);
+  _table_wrapper->execute();
+  pipeline->execute();
+
+  EXPECT_FALSE(root->executed());
+
+  const auto expected_output = _expected_output();
+  EXPECT_EQ(pipeline->get_output()->chunk_count(), expected_output->chunk_count());
+  EXPECT_TABLE_EQ(pipeline->get_output(), expected_output, true);
+}
+
+TEST_F(OperatorsPipelineTest, ParallelExecution) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::fake(2, 2)));
+
+  auto pipeline = std::make_shared<Pipeline>(_make_scans());
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pipeline));
+
+  EXPECT_TRUE(_table_wrapper->executed());
+  EXPECT_TABLE_EQ(pipeline->get_output(), _expected_output(), true);
+}
+
+TEST_F(OperatorsPipelineTest, AggregateSink) {
+  const auto aggregates = std::vector<AggregateDefinition>{{ColumnID{0}, AggregateFunction::Count},
+                                                           {ColumnID{0}, AggregateFunction::CountDistinct},
+                                                           {ColumnID{1}, AggregateFunction::Min},
+                                                           {ColumnID{0}, AggregateFunction::Sum}};
+  const auto make_pipeline = [&]() {
+    return std::make_shared<Pipeline>(std::make_shared<Aggregate>(_make_scans(), aggregates));
+  };
+
+  const auto pipeline = make_pipeline();
+  ASSERT_EQ(pipeline->stages().size(), 3u);
+  ASSERT_NE(pipeline->aggregate(), nullptr);
+  EXPECT_EQ(pipeline->input_left(), _table_wrapper);
+
+  _table_wrapper->execute();
+  pipeline->execute();
+
+  auto expected_scans = std::make_shared<TableWrapper>(_expected_output());
+  expected_scans->execute();
+  auto expected_aggregate = std::make_shared<Aggregate>(expected_scans, aggregates);
+  expected_aggregate->execute();
+  EXPECT_TABLE_EQ(pipeline->get_output(), expected_aggregate->get_output());
+
+  // the workers aggregate their chunks on their own and merge the partial results
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::fake(2, 2)));
+  const auto parallel_pipeline = make_pipeline();
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(parallel_pipeline));
+  EXPECT_TABLE_EQ(parallel_pipeline->get_output(), expected_aggregate->get_output());
+}
+
+}  // namespace opossum
@@ -10,9 +10,12 @@
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/index/cracker/cracker_index.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -27,8 +30,8 @@ class OperatorsTableScanTest : public BaseTest {
     _table_wrapper->execute();
 
     std::shared_ptr<Table> test_even_dict = std::make_shared<Table>(5);
-    test_even_dict->add_column("a", "int");
-    test_even_dict->add_column("b", "int");
+    test_even_dict->add_column("a", DataType::Int);
+    test_even_dict->add_column("b", DataType::Int);
     for (int i = 0; i <= 24; i += 2) test_even_dict->append({i, 100 + i});
 
     test_even_dict->compress_chunk(ChunkID(0));
@@ -40,8 +43,8 @@ class OperatorsTableScanTest : public BaseTest {
 
   std::shared_ptr<TableWrapper> get_table_op_part_dict() {
     auto table = std::make_shared<Table>(5);
-    table->add_column("a", "int");
-    table->add_column("b", "float");
+    table->add_column("a", DataType::Int);
+    table->add_column("b", DataType::Float);
 
     for (int i = 1; i < 20; ++i) {
       table->append({i, 100.1 + i});
@@ -59,8 +62,8 @@ class OperatorsTableScanTest : public BaseTest {
   std::shared_ptr<TableWrapper> get_table_op_with_n_dict_entries(const int num_entries) {
     // Set up dictionary encoded table with a dictionary consisting of num_entries entries.
     auto table = std::make_shared<opossum::Table>(0);
-    table->add_column("a", "int");
-    table->add_column("b", "float");
+    table->add_column("a", DataType::Int);
+    table->add_column("b", DataType::Float);
 
     for (int i = 0; i <= num_entries; i++) {
       table->append({i, 100.0f + i});
@@ -76,10 +79,10 @@ class OperatorsTableScanTest : public BaseTest {
   void ASSERT_COLUMN_EQ(std::shared_ptr<const Table> table, const ColumnID& column_id,
                         std::vector<AllTypeVariant> expected) {
     for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
-      const auto& chunk = table->get_chunk(chunk_id);
+      const auto chunk = table->get_chunk(chunk_id);
 
-      for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk.size(); ++chunk_offset) {
-        const auto& segment = *chunk.get_segment(column_id);
+      for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < chunk->size(); ++chunk_offset) {
+        const auto& segment = *chunk->get_segment(column_id);
 
         const auto found_value = segment[chunk_offset];
         const auto comparator = [found_value](const AllTypeVariant expected_value) {
@@ -118,7 +121,7 @@ TEST_F(OperatorsTableScanTest, EmptyResultScan) {
   scan_1->execute();
 
   for (auto i = ChunkID{0}; i < scan_1->get_output()->chunk_count(); i++)
-    EXPECT_EQ(scan_1->get_output()->get_chunk(i).column_count(), 2u);
+    EXPECT_EQ(scan_1->get_output()->get_chunk(i)->column_count(), 2u);
 }
 
 TEST_F(OperatorsTableScanTest, InvalidTypeScan) {
@@ -275,4 +278,140 @@ TEST_F(OperatorsTableScanTest, ScanOnWideDictionarySegment) {
   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
 }
 
+TEST_F(OperatorsTableScanTest, ScanWithCrackerIndex) {
+  auto table = std::make_shared<Table>(5);
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::Int);
+  for (int i = 24; i >= 0; i -= 2) table->append({i, 100 + i});
+  table->enable_cracking(ColumnID{0});
+
+  // appending creates the third chunk, which is cracked as well
+  EXPECT_NE(table->get_chunk(ChunkID{2})->get_index(SegmentIndexType::Cracker, ColumnID{0}), nullptr);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpLessThan] = {100, 102};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+
+  // The second round runs on the already cracked indexes
+  for (auto round = 0; round < 2; ++round) {
+    for (const auto& test : tests) {
+      auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 4);
+      scan->execute();
+
+      ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+    }
+  }
+
+  const auto cracker_index = std::static_pointer_cast<const CrackerIndex>(
+      table->get_chunk(ChunkID{0})->get_index(SegmentIndexType::Cracker, ColumnID{0}));
+  EXPECT_EQ(cracker_index->statistics().query_count, 12u);
+  EXPECT_EQ(cracker_index->statistics().crack_count, 2u);
+}
+
+TEST_F(OperatorsTableScanTest, SkipChunksByBloomFilter) {
+  auto table = std::make_shared<Table>(5);
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::String);
+  table->set_bloom_filter_bits_per_value(16);
+  for (int i = 0; i < 12; ++i) table->append({i * 7, "id-" + std::to_string(i)});
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // only the third chunk, which is uncompressed, has no Bloom filter
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpEquals, "id-8");
+  scan_1->execute();
+  EXPECT_EQ(scan_1->skipped_chunk_count(), 1u);
+  ASSERT_COLUMN_EQ(scan_1->get_output(), ColumnID{0}, {56});
+
+  auto scan_2 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 15);
+  scan_2->execute();
+  EXPECT_EQ(scan_2->skipped_chunk_count(), 2u);
+  EXPECT_EQ(scan_2->get_output()->row_count(), 0u);
+
+  // other predicates cannot use Bloom filters
+  auto scan_3 = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 15);
+  scan_3->execute();
+  EXPECT_EQ(scan_3->skipped_chunk_count(), 0u);
+  EXPECT_EQ(scan_3->get_output()->row_count(), 12u);
+}
+
+TEST_F(OperatorsTableScanTest, ReexecuteWithParameters) {
+  auto scan_a = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpGreaterThanEquals,
+                                            ParameterID{0});
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::OpLessThan, ParameterID{1});
+  EXPECT_EQ(scan_b->parameter_id(), ParameterID{1});
+
+  // placeholders have to be bound before the plan is executed
+  _table_wrapper_even_dict->reset();
+  _table_wrapper_even_dict->execute();
+  EXPECT_THROW(scan_a->execute(), std::logic_error);
+
+  const auto execute_plan = [&](const AllTypeVariant& min_a, const AllTypeVariant& max_b) {
+    scan_b->reset();
+    scan_b->set_parameters({{ParameterID{0}, min_a}, {ParameterID{1}, max_b}});
+    _table_wrapper_even_dict->execute();
+    scan_a->execute();
+    scan_b->execute();
+    return scan_b->get_output()->row_count();
+  };
+
+  EXPECT_EQ(execute_plan(10, 120), 5u);
+  EXPECT_EQ(execute_plan(0, 106), 3u);
+  EXPECT_EQ(execute_plan(20, 200), 3u);
+
+  // the search value is checked against the column type whenever it is bound
+  scan_b->reset();
+  EXPECT_THROW(scan_b->set_parameters({{ParameterID{0}, 4.5f}}), std::logic_error);
+}
+
+TEST_F(OperatorsTableScanTest, ScanSeesSnapshot) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", DataType::Int);
+  for (auto value = 0; value < 5; ++value) table->append({value});
+  table->compress_chunk(ChunkID{0});
+
+  auto& transaction_manager = TransactionManager::get();
+  const auto writer = transaction_manager.new_transaction_context();
+  table->append({5}, *writer);
+  EXPECT_TRUE(table->delete_row(RowID{ChunkID{0}, 1}, *writer));
+  EXPECT_TRUE(table->delete_row(RowID{ChunkID{1}, 0}, *writer));
+  const auto reader = transaction_manager.new_transaction_context();
+
+  const auto scan_values = [&](const std::shared_ptr<TransactionContext>& transaction_context) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+    scan->set_transaction_context(transaction_context);
+    table_wrapper->execute();
+    scan->execute();
+
+    auto values = std::vector<int32_t>{};
+    const auto output = scan->get_output();
+    for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto chunk = output->get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        values.push_back(type_cast<int32_t>((*chunk->get_segment(ColumnID{0}))[chunk_offset]));
+      }
+    }
+    return values;
+  };
+
+  // the writer sees its own changes, others do not see them before the commit
+  EXPECT_EQ(scan_values(writer), (std::vector<int32_t>{0, 2, 4, 5}));
+  EXPECT_EQ(scan_values(nullptr), (std::vector<int32_t>{0, 1, 2, 3, 4}));
+
+  writer->commit();
+  EXPECT_EQ(scan_values(nullptr), (std::vector<int32_t>{0, 2, 4, 5}));
+  EXPECT_EQ(scan_values(reader), (std::vector<int32_t>{0, 1, 2, 3, 4}));
+}
+
 }  // namespace opossum
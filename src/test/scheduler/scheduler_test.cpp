@@ -0,0 +1,174 @@
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class SchedulerTest : public BaseTest {
+ protected:
+  void TearDown() override { CurrentScheduler::set(nullptr); }
+};
+
+TEST_F(SchedulerTest, ParseCpuList) {
+  EXPECT_EQ(Topology::parse_cpu_list("0-3,8,10-11\n"), (std::vector<CpuID>{0, 1, 2, 3, 8, 10, 11}));
+  EXPECT_EQ(Topology::parse_cpu_list(""), std::vector<CpuID>{});
+}
+
+TEST_F(SchedulerTest, Topology) {
+  const auto fake_topology = Topology::fake(2, 3);
+  ASSERT_EQ(fake_topology.nodes().size(), 2u);
+  EXPECT_EQ(fake_topology.nodes()[1].cpu_ids, (std::vector<CpuID>{3, 4, 5}));
+  EXPECT_EQ(fake_topology.cpu_count(), 6u);
+  EXPECT_FALSE(fake_topology.pins_workers());
+
+  const auto system_topology = Topology::from_system();
+  EXPECT_GE(system_topology.nodes().size(), 1u);
+  EXPECT_GE(system_topology.cpu_count(), 1u);
+}
+
+TEST_F(SchedulerTest, TasksRunAfterTheirPredecessors) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::fake(2, 2)));
+
+  // a diamond: first -> {left, right} -> last
+  auto order = std::vector<int>{};
+  auto order_mutex = std::mutex{};
+  const auto record = [&](int id) {
+    return [&, id]() {
+      std::lock_guard<std::mutex> lock(order_mutex);
+      order.push_back(id);
+    };
+  };
+
+  const auto first = std::make_shared<JobTask>(record(0));
+  const auto left = std::make_shared<JobTask>(record(1));
+  const auto right = std::make_shared<JobTask>(record(1));
+  const auto last = std::make_shared<JobTask>(record(2));
+  first->set_as_predecessor_of(left);
+  first->set_as_predecessor_of(right);
+  left->set_as_predecessor_of(last);
+  right->set_as_predecessor_of(last);
+
+  // scheduling in reverse order must not matter
+  CurrentScheduler::schedule_and_wait_for_tasks({last, right, left, first});
+
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 1, 2}));
+  EXPECT_TRUE(last->is_done());
+}
+
+TEST_F(SchedulerTest, TasksRunInlineWithoutScheduler) {
+  auto executed = false;
+  const auto first = std::make_shared<JobTask>([]() {});
+  const auto second = std::make_shared<JobTask>([&]() { executed = true; });
+  first->set_as_predecessor_of(second);
+
+  second->schedule();
+  EXPECT_FALSE(executed);
+  first->schedule();
+  EXPECT_TRUE(executed);
+}
+
+TEST_F(SchedulerTest, IdleWorkersStealTasks) {
+  const auto scheduler = std::make_shared<NodeQueueScheduler>(Topology::fake(2, 1));
+  CurrentScheduler::set(scheduler);
+
+  auto thread_ids = std::set<std::thread::id>{};
+  auto thread_ids_mutex = std::mutex{};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_index = 0; task_index < 8; ++task_index) {
+    tasks.push_back(std::make_shared<JobTask>([&]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+      std::lock_guard<std::mutex> lock(thread_ids_mutex);
+      thread_ids.insert(std::this_thread::get_id());
+    }));
+  }
+
+  // all tasks go to node 0, so the worker of node 1 only gets work by stealing
+  for (const auto& task : tasks) task->schedule(NodeID{0});
+  for (const auto& task : tasks) task->join();
+
+  EXPECT_EQ(thread_ids.size(), 2u);
+  EXPECT_GT(scheduler->stolen_task_count(), 0u);
+}
+
+TEST_F(SchedulerTest, JoinRethrowsExceptions) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::fake(1, 2)));
+
+  const auto task = std::make_shared<JobTask>([]() { throw std::logic_error("failed"); });
+  EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks({task}), std::logic_error);
+}
+
+TEST_F(SchedulerTest, FailedInputsSkipTheirSuccessors) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::fake(1, 2)));
+
+  // the scan must not run on the missing input, the root reports the exception of the GetTable instead
+  const auto get_table = std::make_shared<GetTable>("missing_table");
+  const auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpEquals, 1);
+  auto future = table_scan->execute_async();
+
+  try {
+    future.get();
+    FAIL() << "the exception was not forwarded";
+  } catch (const std::logic_error& exception) {
+    EXPECT_EQ(std::string{exception.what()}, "Table missing_table does not exist");
+  }
+  EXPECT_FALSE(table_scan->executed());
+}
+
+TEST_F(SchedulerTest, ExecuteOperatorTree) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::fake(2, 2)));
+
+  auto orders = std::make_shared<Table>(3);
+  orders->add_column("order_id", DataType::Int);
+  orders->add_column("customer_id", DataType::Int);
+  for (auto order_id = 0; order_id < 10; ++order_id) orders->append({order_id, order_id % 5});
+
+  auto customers = std::make_shared<Table>(2);
+  customers->add_column("customer_id", DataType::Int);
+  for (auto customer_id = 0; customer_id < 5; ++customer_id) customers->append({customer_id});
+
+  // the customers input was executed by hand and therefore gets no task
+  auto orders_wrapper = std::make_shared<TableWrapper>(orders);
+  auto customers_wrapper = std::make_shared<TableWrapper>(customers);
+  customers_wrapper->execute();
+  auto order_scan = std::make_shared<TableScan>(orders_wrapper, ColumnID{0}, ScanType::OpLessThan, 4);
+  auto customer_scan = std::make_shared<TableScan>(customers_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  auto join = std::make_shared<JoinHash>(order_scan, customer_scan, ColumnID{1}, ColumnID{0});
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(join);
+  ASSERT_EQ(tasks.size(), 4u);
+  EXPECT_EQ(std::static_pointer_cast<OperatorTask>(tasks.back())->get_operator(), join);
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  EXPECT_TRUE(join->executed());
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("order_id", DataType::Int);
+  expected->add_column("customer_id", DataType::Int);
+  expected->add_column("customer_id", DataType::Int);
+  for (const auto order_id : {2, 3}) expected->append({order_id, order_id, order_id});
+
+  EXPECT_TABLE_EQ(join->get_output(), expected);
+}
+
+}  // namespace opossum
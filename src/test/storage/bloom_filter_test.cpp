@@ -0,0 +1,49 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bloom_filter.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, Sizing) {
+  const auto bloom_filter = BloomFilter{1000, 10};
+  EXPECT_EQ(bloom_filter.bit_count(), 10048u);
+  EXPECT_EQ(bloom_filter.hash_function_count(), 7u);
+  EXPECT_EQ(bloom_filter.memory_consumption(), 1256u);
+
+  const auto empty_bloom_filter = BloomFilter{0, 4};
+  EXPECT_EQ(empty_bloom_filter.bit_count(), 64u);
+  EXPECT_FALSE(empty_bloom_filter.may_contain(17));
+}
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  auto bloom_filter = BloomFilter{1000, 8};
+  for (auto value = 0; value < 1000; ++value) bloom_filter.insert(value * 3);
+  for (auto value = 0; value < 1000; ++value) EXPECT_TRUE(bloom_filter.may_contain(value * 3));
+
+  auto string_bloom_filter = BloomFilter{2, 8};
+  string_bloom_filter.insert(std::string{"order-4711"});
+  string_bloom_filter.insert(std::string{"order-4712"});
+  EXPECT_TRUE(string_bloom_filter.may_contain(std::string{"order-4711"}));
+  EXPECT_TRUE(string_bloom_filter.may_contain(std::string{"order-4712"}));
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  auto bloom_filter = BloomFilter{10000, 10};
+  for (auto value = int64_t{0}; value < 10000; ++value) bloom_filter.insert(value);
+
+  auto false_positive_count = 0;
+  for (auto value = int64_t{10000}; value < 20000; ++value) {
+    if (bloom_filter.may_contain(value)) ++false_positive_count;
+  }
+
+  // the expected rate is about 1%
+  EXPECT_LT(false_positive_count, 300);
+}
+
+}  // namespace opossum
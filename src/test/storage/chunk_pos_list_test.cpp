@@ -0,0 +1,111 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterables.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/memory_pool.hpp"
+
+namespace opossum {
+
+class ChunkPosListTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // alternating values in two chunks, the first one dictionary-encoded
+    _table = std::make_shared<Table>(10);
+    _table->add_column("a", DataType::Int);
+    _table->add_column("b", DataType::Int);
+    for (auto row = 0; row < 20; ++row) _table->append({row % 2, row});
+    _table->compress_chunk(ChunkID{0});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(ChunkPosListTest, MakeChunkPosList) {
+  const auto memory_pool = std::make_shared<MemoryPool>();
+
+  auto pos_list = PosList{RowID{ChunkID{1}, 7}, RowID{ChunkID{1}, 2}, RowID{ChunkID{1}, 5}};
+  const auto chunk_pos_list = make_chunk_pos_list(pos_list, memory_pool);
+  ASSERT_NE(chunk_pos_list, nullptr);
+  EXPECT_EQ(chunk_pos_list->chunk_id(), ChunkID{1});
+  EXPECT_EQ(chunk_pos_list->chunk_offsets(), (pmr_vector<ChunkOffset>{7, 2, 5}));
+  EXPECT_EQ((*chunk_pos_list)[1], (RowID{ChunkID{1}, 2}));
+  EXPECT_EQ(chunk_pos_list->to_pos_list(), pos_list);
+
+  // positions in several chunks
+  pos_list.emplace_back(RowID{ChunkID{0}, 3});
+  EXPECT_EQ(make_chunk_pos_list(pos_list, memory_pool), nullptr);
+
+  EXPECT_EQ(make_chunk_pos_list(PosList{}, memory_pool), nullptr);
+}
+
+TEST_F(ChunkPosListTest, SortRecountsRuns) {
+  auto chunk_pos_list = ChunkPosList{ChunkID{0}};
+  for (const auto chunk_offset : {5u, 2u, 3u, 9u, 4u}) chunk_pos_list.append(chunk_offset);
+  EXPECT_EQ(chunk_pos_list.run_count(), 4u);
+
+  chunk_pos_list.sort();
+  EXPECT_EQ(chunk_pos_list.chunk_offsets(), (pmr_vector<ChunkOffset>{2, 3, 4, 5, 9}));
+  EXPECT_EQ(chunk_pos_list.run_count(), 2u);
+}
+
+TEST_F(ChunkPosListTest, ReferenceSegment) {
+  auto chunk_pos_list = std::make_shared<ChunkPosList>(ChunkID{0});
+  for (const auto chunk_offset : {9u, 4u, 0u}) chunk_pos_list->append(chunk_offset);
+  const auto segment = ReferenceSegment{_table, ColumnID{1}, chunk_pos_list};
+
+  EXPECT_EQ(segment.size(), 3u);
+  EXPECT_EQ(segment[1], AllTypeVariant{4});
+  EXPECT_LT(segment.memory_consumption(), sizeof(ReferenceSegment) + 3 * sizeof(RowID) + sizeof(ChunkPosList));
+
+  auto values = std::vector<std::pair<int32_t, ChunkOffset>>{};
+  segment_for_each<int32_t>(segment, [&](const int32_t value, const ChunkOffset chunk_offset) {
+    values.emplace_back(value, chunk_offset);
+  });
+  EXPECT_EQ(values, (std::vector<std::pair<int32_t, ChunkOffset>>{{9, 0}, {4, 1}, {0, 2}}));
+
+  // The RowIDs are created for consumers that ask for them
+  EXPECT_EQ(*segment.pos_list(), chunk_pos_list->to_pos_list());
+}
+
+TEST_F(ChunkPosListTest, ScanOutput) {
+  // every other row matches, which is too scattered for PosRanges
+  const auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 1);
+  scan->execute();
+  const auto output = scan->get_output();
+  ASSERT_EQ(output->row_count(), 10u);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(
+        output->get_chunk(chunk_id)->get_segment(ColumnID{1}));
+    ASSERT_NE(segment->chunk_pos_list(), nullptr);
+    EXPECT_EQ(segment->chunk_pos_list()->chunk_id(), chunk_id);
+    EXPECT_EQ(segment->chunk_pos_list()->size(), 5u);
+  }
+
+  // A scan on the chunk-local positions references the rows of the original table
+  const auto second_scan = std::make_shared<TableScan>(scan, ColumnID{1}, ScanType::OpGreaterThan, 6);
+  second_scan->execute();
+  const auto second_output = second_scan->get_output();
+  auto values = std::vector<int32_t>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < second_output->chunk_count(); ++chunk_id) {
+    segment_for_each<int32_t>(*second_output->get_chunk(chunk_id)->get_segment(ColumnID{1}),
+                              [&](const int32_t value, const ChunkOffset) { values.emplace_back(value); });
+  }
+  EXPECT_EQ(values, (std::vector<int32_t>{7, 9, 11, 13, 15, 17, 19}));
+}
+
+}  // namespace opossum
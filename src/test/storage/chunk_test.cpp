@@ -1,4 +1,6 @@
+#include <chrono>
 #include <memory>
+#include <thread>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -6,6 +8,7 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/base_segment.hpp"
 #include "../lib/storage/chunk.hpp"
+#include "../lib/storage/index/b_tree/b_tree_index.hpp"
 #include "../lib/types.hpp"
 
 namespace opossum {
@@ -13,12 +16,12 @@ namespace opossum {
 class StorageChunkTest : public BaseTest {
  protected:
   void SetUp() override {
-    int_value_segment = make_shared_by_data_type<BaseSegment, ValueSegment>("int");
+    int_value_segment = make_shared_by_data_type<BaseSegment, ValueSegment>(DataType::Int);
     int_value_segment->append(4);
     int_value_segment->append(6);
     int_value_segment->append(3);
 
-    string_value_segment = make_shared_by_data_type<BaseSegment, ValueSegment>("string");
+    string_value_segment = make_shared_by_data_type<BaseSegment, ValueSegment>(DataType::String);
     string_value_segment->append("Hello,");
     string_value_segment->append("world");
     string_value_segment->append("!");
@@ -49,6 +52,51 @@ TEST_F(StorageChunkTest, AddValuesToChunk) {
   }
 }
 
+TEST_F(StorageChunkTest, PreallocatedRowsBecomeVisibleInOrder) {
+  c.preallocate(3);
+  c.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(DataType::Int));
+  c.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(DataType::String));
+
+  const auto first_row = c.reserve_row();
+  const auto second_row = c.reserve_row();
+  EXPECT_EQ(first_row, 0u);
+  EXPECT_EQ(second_row, 1u);
+
+  // the second row has to wait for the first one
+  auto second_row_writer = std::thread{[&]() { c.write_row(second_row, {6, "world"}); }};
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(c.size(), 0u);
+
+  c.write_row(first_row, {4, "Hello,"});
+  second_row_writer.join();
+  EXPECT_EQ(c.size(), 2u);
+  EXPECT_EQ(c.get_segment(ColumnID{1})->size(), 2u);
+  EXPECT_EQ((*c.get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+
+  c.append({3, "!"});
+  EXPECT_EQ(c.size(), 3u);
+  EXPECT_EQ(c.reserve_row(), INVALID_CHUNK_OFFSET);
+  EXPECT_THROW(c.append({5, "full"}), std::exception);
+
+  // the copy takes further rows, which the full chunk does not see
+  const auto copy = c.copy_with_capacity(4);
+  EXPECT_EQ(copy->size(), 3u);
+  copy->append({5, "grown"});
+  EXPECT_EQ(copy->size(), 4u);
+  EXPECT_EQ((*copy->get_segment(ColumnID{1}))[0], AllTypeVariant{"Hello,"});
+  EXPECT_EQ(c.size(), 3u);
+}
+
+TEST_F(StorageChunkTest, PreallocatedChunkRejectsUnconvertibleValues) {
+  c.preallocate(2);
+  c.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(DataType::Int));
+
+  EXPECT_ANY_THROW(c.append({"abc"}));
+  EXPECT_EQ(c.convert_row({"12"}), std::vector<AllTypeVariant>{AllTypeVariant{12}});
+  c.append({7});
+  EXPECT_EQ(c.size(), 1u);
+}
+
 TEST_F(StorageChunkTest, RetrieveSegment) {
   c.add_segment(int_value_segment);
   c.add_segment(string_value_segment);
@@ -59,11 +107,28 @@ TEST_F(StorageChunkTest, RetrieveSegment) {
 }
 
 TEST_F(StorageChunkTest, UnknownSegmentType) {
-  // Exception will only be thrown in debug builds
-  if (IS_DEBUG) {
-    auto wrapper = []() { make_shared_by_data_type<BaseSegment, ValueSegment>("weird_type"); };
-    EXPECT_THROW(wrapper(), std::logic_error);
-  }
+  // Type names are only parsed when a table is loaded, which rejects unknown names
+  EXPECT_THROW(data_type_from_string("weird_type"), std::logic_error);
+  EXPECT_EQ(data_type_from_string("string"), DataType::String);
+  EXPECT_EQ(data_type_to_string(DataType::Long), "long");
+}
+
+TEST_F(StorageChunkTest, CreateAndRemoveIndex) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+
+  EXPECT_EQ(c.get_index(SegmentIndexType::BTree, ColumnID{1}), nullptr);
+
+  const auto index = c.create_index<BTreeIndex>(ColumnID{1});
+  EXPECT_EQ(c.get_index(SegmentIndexType::BTree, ColumnID{1}), index);
+  EXPECT_EQ(c.get_index(SegmentIndexType::GroupKey, ColumnID{1}), nullptr);
+  EXPECT_EQ(c.get_index(SegmentIndexType::BTree, ColumnID{0}), nullptr);
+  EXPECT_EQ(c.get_indices(ColumnID{1}).size(), 1u);
+  EXPECT_EQ(c.get_indices(ColumnID{0}).size(), 0u);
+
+  c.remove_index(index);
+  EXPECT_EQ(c.get_index(SegmentIndexType::BTree, ColumnID{1}), nullptr);
+  EXPECT_TRUE(c.indices().empty());
 }
 
 }  // namespace opossum
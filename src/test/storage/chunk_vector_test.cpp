@@ -0,0 +1,80 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk.hpp"
+#include "../lib/storage/chunk_vector.hpp"
+
+namespace opossum {
+
+class StorageChunkVectorTest : public BaseTest {};
+
+TEST_F(StorageChunkVectorTest, PushBackAcrossBuckets) {
+  auto chunk_vector = ChunkVector{};
+  EXPECT_EQ(chunk_vector.size(), ChunkID{0});
+
+  // 100 chunks fill the first four buckets (8 + 16 + 32 + 64 slots) partly
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < 100; ++chunk_id) {
+    chunks.push_back(std::make_shared<Chunk>());
+    chunk_vector.push_back(chunks.back());
+    EXPECT_EQ(chunk_vector.size(), ChunkID{chunk_id + 1});
+    EXPECT_EQ(chunk_vector.back(), chunks.back());
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < 100; ++chunk_id) {
+    EXPECT_EQ(chunk_vector.get(chunk_id), chunks[chunk_id]);
+  }
+}
+
+TEST_F(StorageChunkVectorTest, Replace) {
+  auto chunk_vector = ChunkVector{};
+  chunk_vector.push_back(std::make_shared<Chunk>());
+  chunk_vector.push_back(std::make_shared<Chunk>());
+
+  const auto previous_chunk = chunk_vector.get(ChunkID{1});
+  const auto new_chunk = std::make_shared<Chunk>();
+  chunk_vector.replace(ChunkID{1}, new_chunk);
+
+  EXPECT_EQ(chunk_vector.size(), ChunkID{2});
+  EXPECT_EQ(chunk_vector.get(ChunkID{1}), new_chunk);
+  EXPECT_NE(previous_chunk, new_chunk);
+}
+
+TEST_F(StorageChunkVectorTest, ReadsDuringReplacements) {
+  auto chunk_vector = ChunkVector{};
+  chunk_vector.push_back(std::make_shared<Chunk>());
+
+  // Readers always get a valid chunk, while the replaced ones are retired and freed behind them
+  auto done = std::atomic<bool>{false};
+  auto readers = std::vector<std::thread>{};
+  for (auto reader_id = 0; reader_id < 4; ++reader_id) {
+    readers.emplace_back([&]() {
+      while (!done) {
+        const auto chunk = chunk_vector.get(ChunkID{0});
+        EXPECT_EQ(chunk->size(), 0u);
+      }
+    });
+  }
+
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (auto replacement = 0; replacement < 10'000; ++replacement) {
+    chunks.push_back(std::make_shared<Chunk>());
+    chunk_vector.replace(ChunkID{0}, chunks.back());
+  }
+  done = true;
+  for (auto& reader : readers) reader.join();
+
+  // without readers, the next replacement frees all retired chunk pointers
+  chunks.push_back(std::make_shared<Chunk>());
+  chunk_vector.replace(ChunkID{0}, chunks.back());
+  EXPECT_EQ(chunk_vector.get(ChunkID{0}), chunks.back());
+  EXPECT_EQ(chunks.back().use_count(), 2);
+  EXPECT_EQ(chunks.front().use_count(), 1);
+}
+
+}  // namespace opossum
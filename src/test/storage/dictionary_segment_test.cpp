@@ -1,12 +1,13 @@
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
 #include "../../lib/resolve_type.hpp"
 #include "../../lib/storage/base_segment.hpp"
 #include "../../lib/storage/dictionary_segment.hpp"
-#include "../../lib/storage/fitted_attribute_vector.cpp"
+#include "../../lib/storage/fitted_attribute_vector.hpp"
 #include "../../lib/storage/value_segment.hpp"
 
 class StorageDictionarySegmentTest : public ::testing::Test {
@@ -23,7 +24,8 @@ TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
   vc_str->append("Hasso");
   vc_str->append("Bill");
 
-  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("string", vc_str);
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>(
+      opossum::DataType::String, vc_str);
   auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<std::string>>(col);
 
   // Test attribute_vector size
@@ -42,7 +44,8 @@ TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
 
 TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
   for (int i = 0; i <= 10; i += 2) vc_int->append(i);
-  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("int", vc_int);
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>(
+      opossum::DataType::Int, vc_int);
   auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<int>>(col);
 
   EXPECT_EQ(dict_col->lower_bound(4), (opossum::ValueID)2);
@@ -58,7 +61,8 @@ TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
 TEST_F(StorageDictionarySegmentTest, AppendElements) {
   vc_str->append("Bill");
 
-  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("string", vc_str);
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>(
+      opossum::DataType::String, vc_str);
   auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<std::string>>(col);
 
   // Test appending new element
@@ -73,7 +77,8 @@ TEST_F(StorageDictionarySegmentTest, GetElements) {
   vc_str->append("Hasso");
   vc_str->append("Bill");
 
-  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("string", vc_str);
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>(
+      opossum::DataType::String, vc_str);
   auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<std::string>>(col);
 
   // Test getting elements
@@ -90,7 +95,8 @@ TEST_F(StorageDictionarySegmentTest, DictionaryEncoding) {
   vc_str->append("Steve");
   vc_str->append("Bill");
 
-  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("string", vc_str);
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>(
+      opossum::DataType::String, vc_str);
   auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<std::string>>(col);
 
   // Test getting elements
@@ -100,4 +106,19 @@ TEST_F(StorageDictionarySegmentTest, DictionaryEncoding) {
   EXPECT_ANY_THROW(dict_col->value_by_value_id(opossum::ValueID(3)));
 }
 
+TEST_F(StorageDictionarySegmentTest, ValueIDCounts) {
+  for (auto value = 0; value < 11; ++value) vc_int->append(value % 3);
+
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>(
+      opossum::DataType::Int, vc_int);
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<int>>(col);
+
+  // 11 rows do not fill the unrolled loop, so the remainder is counted as well
+  const auto counts = dict_col->attribute_vector()->value_id_counts(dict_col->unique_values_count());
+  EXPECT_EQ(counts, (std::vector<size_t>{4, 4, 3}));
+
+  // value ids that do not occur are counted as zero
+  EXPECT_EQ(dict_col->attribute_vector()->value_id_counts(4), (std::vector<size_t>{4, 4, 3, 0}));
+}
+
 // TODO(student): You should add some more tests here (full coverage would be appreciated) and possibly in other files.
@@ -0,0 +1,90 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_table_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageAdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    value_segment = std::make_shared<ValueSegment<int32_t>>();
+    for (const auto value : {7, -3, 9, -3, 1, 1200, 7}) value_segment->append(value);
+    index = std::make_shared<AdaptiveRadixTreeIndex>(value_segment);
+  }
+
+  std::vector<ChunkOffset> offsets(BaseIndex::Iterator begin, BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> value_segment;
+  std::shared_ptr<AdaptiveRadixTreeIndex> index;
+};
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, IndexType) {
+  EXPECT_EQ(index->type(), SegmentIndexType::AdaptiveRadixTree);
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, OffsetsAreOrderedByValue) {
+  EXPECT_EQ(offsets(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{1, 3, 4, 0, 6, 2, 5}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, PointLookup) {
+  EXPECT_EQ(offsets(index->lower_bound(7), index->upper_bound(7)), (std::vector<ChunkOffset>{0, 6}));
+  EXPECT_EQ(offsets(index->lower_bound(-3), index->upper_bound(-3)), (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(offsets(index->lower_bound(1200), index->upper_bound(1200)), (std::vector<ChunkOffset>{5}));
+  EXPECT_EQ(index->lower_bound(8), index->upper_bound(8));
+  EXPECT_EQ(index->lower_bound(-10), index->cbegin());
+  EXPECT_EQ(index->lower_bound(1201), index->cend());
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, DictionarySegment) {
+  const auto dictionary_segment = std::make_shared<DictionarySegment<int32_t>>(value_segment);
+  const auto dictionary_index = std::make_shared<AdaptiveRadixTreeIndex>(dictionary_segment);
+  EXPECT_EQ(offsets(dictionary_index->cbegin(), dictionary_index->cend()), offsets(index->cbegin(), index->cend()));
+  EXPECT_EQ(offsets(dictionary_index->lower_bound(1), dictionary_index->upper_bound(9)),
+            (std::vector<ChunkOffset>{4, 0, 6, 2}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, TableIndexBatchLookup) {
+  auto table_index = AdaptiveRadixTreeTableIndex{DataType::Long};
+  for (auto value = int64_t{0}; value < 100; ++value) {
+    const auto row_id = RowID{ChunkID{static_cast<uint32_t>(value / 10)}, static_cast<ChunkOffset>(value)};
+    table_index.insert(value * 1000, row_id);
+  }
+  table_index.insert(int64_t{5000}, RowID{ChunkID{42}, 0});
+
+  auto results = std::vector<PosList>{};
+  table_index.lookup_batch(std::vector<int64_t>{5000, 5001, 0}, results);
+
+  ASSERT_EQ(results.size(), 3u);
+  EXPECT_EQ(results[0], (PosList{RowID{ChunkID{0}, 5}, RowID{ChunkID{42}, 0}}));
+  EXPECT_TRUE(results[1].empty());
+  EXPECT_EQ(results[2], (PosList{RowID{ChunkID{0}, 0}}));
+  EXPECT_EQ(table_index.lookup(int64_t{99000}), (PosList{RowID{ChunkID{9}, 99}}));
+  EXPECT_EQ(table_index.key_count(), 100u);
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, TableIndexRejectsReferenceSegments) {
+  auto table_index = AdaptiveRadixTreeTableIndex{DataType::Int};
+  table_index.insert_segment(*value_segment, ChunkID{0});
+  EXPECT_EQ(table_index.lookup(7), (PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 6}}));
+
+  const auto table = std::make_shared<Table>();
+  table->add_column("a", DataType::Int);
+  table->append({7});
+  const auto reference_segment =
+      ReferenceSegment{table, ColumnID{0}, std::make_shared<PosList>(PosList{RowID{ChunkID{0}, 0}})};
+  EXPECT_THROW(table_index.insert_segment(reference_segment, ChunkID{1}), std::logic_error);
+}
+
+}  // namespace opossum
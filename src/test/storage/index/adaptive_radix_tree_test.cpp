@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree.hpp"
+
+namespace opossum {
+
+class StorageAdaptiveRadixTreeTest : public BaseTest {
+ protected:
+  template <typename T>
+  std::string key(const T& value) {
+    auto key = std::string{};
+    append_art_key(value, key);
+    return key;
+  }
+
+  AdaptiveRadixTree<size_t> tree;
+};
+
+TEST_F(StorageAdaptiveRadixTreeTest, KeysAreBinaryComparable) {
+  EXPECT_LT(key(int32_t{-5}), key(int32_t{-1}));
+  EXPECT_LT(key(int32_t{-1}), key(int32_t{0}));
+  EXPECT_LT(key(int32_t{255}), key(int32_t{256}));
+  EXPECT_LT(key(std::numeric_limits<int64_t>::min()), key(std::numeric_limits<int64_t>::max()));
+  EXPECT_LT(key(-2.5), key(-1.5));
+  EXPECT_LT(key(-1.5f), key(0.0f));
+  EXPECT_LT(key(0.5f), key(1.5f));
+  EXPECT_LT(key(std::string{"ab"}), key(std::string{"abc"}));
+  EXPECT_LT(key(std::string{"abc"}), key(std::string{"b"}));
+  EXPECT_EQ(key(int32_t{7}).size(), 4u);
+}
+
+TEST_F(StorageAdaptiveRadixTreeTest, InsertAndFind) {
+  tree.insert(key(std::string{"romane"})) = 1;
+  tree.insert(key(std::string{"romanus"})) = 2;
+  tree.insert(key(std::string{"rubens"})) = 3;
+  tree.insert(key(std::string{"rom"})) = 4;
+
+  EXPECT_EQ(tree.size(), 4u);
+  EXPECT_EQ(*tree.find(key(std::string{"romane"})), 1u);
+  EXPECT_EQ(*tree.find(key(std::string{"romanus"})), 2u);
+  EXPECT_EQ(*tree.find(key(std::string{"rubens"})), 3u);
+  EXPECT_EQ(*tree.find(key(std::string{"rom"})), 4u);
+  EXPECT_EQ(tree.find(key(std::string{"roman"})), nullptr);
+  EXPECT_EQ(tree.find(key(std::string{"romanes"})), nullptr);
+
+  // inserting an existing key returns its value
+  EXPECT_EQ(tree.insert(key(std::string{"rubens"})), 3u);
+  EXPECT_EQ(tree.size(), 4u);
+}
+
+TEST_F(StorageAdaptiveRadixTreeTest, NodesGrow) {
+  // 1000 consecutive numbers fill nodes of all sizes
+  for (auto value = int32_t{0}; value < 1000; ++value) {
+    tree.insert(key(value * 3)) = value;
+  }
+
+  EXPECT_EQ(tree.size(), 1000u);
+  for (auto value = int32_t{0}; value < 1000; ++value) {
+    ASSERT_NE(tree.find(key(value * 3)), nullptr);
+    EXPECT_EQ(*tree.find(key(value * 3)), static_cast<size_t>(value));
+    EXPECT_EQ(tree.find(key(value * 3 + 1)), nullptr);
+  }
+  EXPECT_GT(tree.memory_consumption(), 1000u);
+}
+
+TEST_F(StorageAdaptiveRadixTreeTest, Bounds) {
+  for (auto value = int64_t{-500}; value < 500; value += 10) {
+    tree.insert(key(value)) = static_cast<size_t>(value + 500);
+  }
+
+  EXPECT_EQ(*tree.lower_bound(key(int64_t{-1000})), 0u);
+  EXPECT_EQ(*tree.lower_bound(key(int64_t{-500})), 0u);
+  EXPECT_EQ(*tree.upper_bound(key(int64_t{-500})), 10u);
+  EXPECT_EQ(*tree.lower_bound(key(int64_t{-1})), 500u);
+  EXPECT_EQ(*tree.lower_bound(key(int64_t{15})), 520u);
+  EXPECT_EQ(*tree.upper_bound(key(int64_t{480})), 990u);
+  EXPECT_EQ(tree.upper_bound(key(int64_t{490})), nullptr);
+  EXPECT_EQ(tree.lower_bound(key(int64_t{491})), nullptr);
+}
+
+TEST_F(StorageAdaptiveRadixTreeTest, StringBounds) {
+  for (const auto& word : {"apple", "apricot", "banana", "band", "bandana", "cherry"}) {
+    tree.insert(key(std::string{word})) = word[0] * 100 + word[3];
+  }
+
+  EXPECT_EQ(*tree.lower_bound(key(std::string{"a"})), tree.insert(key(std::string{"apple"})));
+  EXPECT_EQ(*tree.lower_bound(key(std::string{"apq"})), tree.insert(key(std::string{"apricot"})));
+  EXPECT_EQ(*tree.upper_bound(key(std::string{"band"})), tree.insert(key(std::string{"bandana"})));
+  EXPECT_EQ(*tree.lower_bound(key(std::string{"bandanas"})), tree.insert(key(std::string{"cherry"})));
+  EXPECT_EQ(tree.lower_bound(key(std::string{"d"})), nullptr);
+}
+
+TEST_F(StorageAdaptiveRadixTreeTest, FindBatch) {
+  auto keys = std::vector<std::string>{};
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    tree.insert(key(value * 2)) = value;
+    keys.push_back(key(value));
+  }
+
+  auto results = std::vector<const size_t*>{};
+  tree.find_batch(keys, results);
+
+  ASSERT_EQ(results.size(), keys.size());
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    EXPECT_EQ(results[value], tree.find(keys[value]));
+  }
+}
+
+TEST_F(StorageAdaptiveRadixTreeTest, EmptyTree) {
+  EXPECT_EQ(tree.find(key(1)), nullptr);
+  EXPECT_EQ(tree.lower_bound(key(1)), nullptr);
+  EXPECT_EQ(tree.memory_consumption(), 0u);
+
+  auto results = std::vector<const size_t*>{};
+  tree.find_batch({key(1), key(2)}, results);
+  EXPECT_EQ(results, (std::vector<const size_t*>{nullptr, nullptr}));
+}
+
+}  // namespace opossum
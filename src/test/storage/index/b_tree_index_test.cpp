@@ -0,0 +1,74 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageBTreeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+    for (const auto value : {7, 3, 9, 3, 1, 12, 7}) value_segment->append(value);
+    index = std::make_shared<BTreeIndex>(value_segment);
+  }
+
+  std::vector<ChunkOffset> offsets(BaseIndex::Iterator begin, BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<BTreeIndex> index;
+};
+
+TEST_F(StorageBTreeIndexTest, IndexType) { EXPECT_EQ(index->type(), SegmentIndexType::BTree); }
+
+TEST_F(StorageBTreeIndexTest, OffsetsAreOrderedByValue) {
+  EXPECT_EQ(offsets(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{4, 1, 3, 0, 6, 2, 5}));
+}
+
+TEST_F(StorageBTreeIndexTest, PointLookup) {
+  EXPECT_EQ(offsets(index->lower_bound(7), index->upper_bound(7)), (std::vector<ChunkOffset>{0, 6}));
+  EXPECT_EQ(offsets(index->lower_bound(12), index->upper_bound(12)), (std::vector<ChunkOffset>{5}));
+  EXPECT_EQ(index->lower_bound(8), index->upper_bound(8));
+}
+
+TEST_F(StorageBTreeIndexTest, ValuesOutOfRange) {
+  EXPECT_EQ(index->lower_bound(0), index->cbegin());
+  EXPECT_EQ(index->lower_bound(13), index->cend());
+  EXPECT_EQ(index->upper_bound(12), index->cend());
+}
+
+TEST_F(StorageBTreeIndexTest, MultipleLevels) {
+  // enough distinct values for a tree with three levels (16 * 16 < 1000)
+  const auto value_segment = std::make_shared<ValueSegment<std::string>>();
+  for (auto value = 999; value >= 0; --value) {
+    value_segment->append(std::to_string(value * 2 + 1000));
+  }
+  const auto large_index = std::make_shared<BTreeIndex>(value_segment);
+
+  for (auto value = 0; value < 1000; value += 37) {
+    const auto key = std::to_string(value * 2 + 1000);
+    ASSERT_EQ(offsets(large_index->lower_bound(key), large_index->upper_bound(key)),
+              (std::vector<ChunkOffset>{static_cast<ChunkOffset>(999 - value)}));
+
+    // odd values do not exist, but have to be placed right in front of their successor
+    const auto missing_key = std::to_string(value * 2 + 1001);
+    EXPECT_EQ(large_index->lower_bound(missing_key), large_index->upper_bound(missing_key));
+    EXPECT_EQ(large_index->lower_bound(missing_key), large_index->upper_bound(key));
+  }
+
+  EXPECT_EQ(std::distance(large_index->cbegin(), large_index->lower_bound("1500")), 250);
+}
+
+TEST_F(StorageBTreeIndexTest, EmptySegment) {
+  const auto empty_index = std::make_shared<BTreeIndex>(std::make_shared<ValueSegment<int64_t>>());
+  EXPECT_EQ(empty_index->lower_bound(5), empty_index->cend());
+  EXPECT_EQ(empty_index->cbegin(), empty_index->cend());
+}
+
+}  // namespace opossum
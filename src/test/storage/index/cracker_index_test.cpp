@@ -0,0 +1,89 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk_pos_list.hpp"
+#include "storage/index/cracker/cracker_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageCrackerIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    value_segment = std::make_shared<ValueSegment<int32_t>>();
+    for (const auto value : {7, 3, 9, 3, 1, 12, 7, 5}) value_segment->append(value);
+    index = std::make_shared<CrackerIndex>(value_segment);
+  }
+
+  PosList scan(const ScanType scan_type, const AllTypeVariant& value) {
+    auto chunk_pos_list = ChunkPosList{ChunkID{3}};
+    index->scan(scan_type, value, chunk_pos_list);
+    return chunk_pos_list.to_pos_list();
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> value_segment;
+  std::shared_ptr<CrackerIndex> index;
+};
+
+TEST_F(StorageCrackerIndexTest, IndexType) { EXPECT_EQ(index->type(), SegmentIndexType::Cracker); }
+
+TEST_F(StorageCrackerIndexTest, Scan) {
+  EXPECT_EQ(scan(ScanType::OpEquals, 7), (PosList{RowID{ChunkID{3}, 0}, RowID{ChunkID{3}, 6}}));
+  EXPECT_EQ(scan(ScanType::OpLessThan, 5), (PosList{RowID{ChunkID{3}, 1}, RowID{ChunkID{3}, 3}, RowID{ChunkID{3}, 4}}));
+  EXPECT_EQ(scan(ScanType::OpGreaterThanEquals, 9), (PosList{RowID{ChunkID{3}, 2}, RowID{ChunkID{3}, 5}}));
+  EXPECT_EQ(scan(ScanType::OpLessThanEquals, 3),
+            (PosList{RowID{ChunkID{3}, 1}, RowID{ChunkID{3}, 3}, RowID{ChunkID{3}, 4}}));
+  EXPECT_EQ(scan(ScanType::OpGreaterThan, 7), (PosList{RowID{ChunkID{3}, 2}, RowID{ChunkID{3}, 5}}));
+  EXPECT_EQ(scan(ScanType::OpNotEquals, 3).size(), 6u);
+  EXPECT_TRUE(scan(ScanType::OpEquals, 8).empty());
+  EXPECT_EQ(scan(ScanType::OpLessThan, 100).size(), 8u);
+}
+
+TEST_F(StorageCrackerIndexTest, RepeatedScansDoNotCrackAgain) {
+  scan(ScanType::OpGreaterThanEquals, 5);
+  const auto statistics = index->statistics();
+  EXPECT_EQ(statistics.crack_count, 1u);
+  EXPECT_EQ(statistics.piece_count, 2u);
+  EXPECT_EQ(statistics.touched_value_count, 8u);
+
+  // (x < 5) has the same bound as (x >= 5)
+  scan(ScanType::OpLessThan, 5);
+  EXPECT_EQ(index->statistics().crack_count, 1u);
+  EXPECT_EQ(index->statistics().touched_value_count, 8u);
+
+  // Cracking on 9 only touches the piece of values >= 5
+  scan(ScanType::OpLessThan, 9);
+  EXPECT_EQ(index->statistics().crack_count, 2u);
+  EXPECT_EQ(index->statistics().touched_value_count, 8u + 5u);
+  EXPECT_EQ(index->statistics().query_count, 3u);
+}
+
+TEST_F(StorageCrackerIndexTest, NoIterators) {
+  // Lookups reorganize the index, so it does not hand out iterators into it
+  EXPECT_THROW(index->lower_bound(7), std::logic_error);
+  EXPECT_THROW(index->upper_bound(7), std::logic_error);
+  EXPECT_THROW(index->cbegin(), std::logic_error);
+  EXPECT_THROW(index->cend(), std::logic_error);
+}
+
+TEST_F(StorageCrackerIndexTest, AppendedValues) {
+  scan(ScanType::OpLessThan, 5);
+
+  // Few appended values are scanned sequentially
+  value_segment->append(2);
+  EXPECT_EQ(scan(ScanType::OpLessThan, 3), (PosList{RowID{ChunkID{3}, 4}, RowID{ChunkID{3}, 8}}));
+  EXPECT_EQ(index->statistics().merge_count, 0u);
+
+  // Many appended values are merged, which drops the existing cracks
+  for (auto value = 20; value < 30; ++value) value_segment->append(value);
+  EXPECT_EQ(scan(ScanType::OpGreaterThan, 27).size(), 2u);
+  EXPECT_EQ(index->statistics().merge_count, 1u);
+  EXPECT_EQ(index->statistics().piece_count, 2u);
+  EXPECT_EQ(scan(ScanType::OpEquals, 2), (PosList{RowID{ChunkID{3}, 8}}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageGroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto value_segment = std::make_shared<ValueSegment<std::string>>();
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"}) {
+      value_segment->append(value);
+    }
+    dictionary_segment = make_shared_by_data_type<BaseSegment, DictionarySegment>(DataType::String, value_segment);
+    index = std::make_shared<GroupKeyIndex>(dictionary_segment);
+  }
+
+  std::vector<ChunkOffset> offsets(BaseIndex::Iterator begin, BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<BaseSegment> dictionary_segment;
+  std::shared_ptr<GroupKeyIndex> index;
+};
+
+TEST_F(StorageGroupKeyIndexTest, IndexType) { EXPECT_EQ(index->type(), SegmentIndexType::GroupKey); }
+
+TEST_F(StorageGroupKeyIndexTest, PostingsAreOrderedByValue) {
+  const auto expected = std::vector<ChunkOffset>{4, 5, 6, 1, 3, 2, 0, 7};
+  EXPECT_EQ(offsets(index->cbegin(), index->cend()), expected);
+}
+
+TEST_F(StorageGroupKeyIndexTest, PointLookup) {
+  EXPECT_EQ(offsets(index->lower_bound("delta"), index->upper_bound("delta")), (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(offsets(index->lower_bound("inbox"), index->upper_bound("inbox")), (std::vector<ChunkOffset>{7}));
+  EXPECT_EQ(index->lower_bound("echo"), index->upper_bound("echo"));
+}
+
+TEST_F(StorageGroupKeyIndexTest, RangeLookup) {
+  EXPECT_EQ(offsets(index->cbegin(), index->lower_bound("delta")), (std::vector<ChunkOffset>{4, 5, 6}));
+  EXPECT_EQ(offsets(index->upper_bound("frank"), index->cend()), (std::vector<ChunkOffset>{0, 7}));
+}
+
+TEST_F(StorageGroupKeyIndexTest, ValuesOutOfRange) {
+  EXPECT_EQ(index->lower_bound("aaa"), index->cbegin());
+  EXPECT_EQ(index->lower_bound("zzz"), index->cend());
+  EXPECT_EQ(index->upper_bound("zzz"), index->cend());
+}
+
+TEST_F(StorageGroupKeyIndexTest, RequiresDictionarySegment) {
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  EXPECT_THROW(std::make_shared<GroupKeyIndex>(value_segment), std::logic_error);
+}
+
+TEST_F(StorageGroupKeyIndexTest, MemoryConsumption) {
+  // 6 distinct values plus one sentinel offset, 8 postings
+  EXPECT_EQ(index->memory_consumption(), 7 * sizeof(size_t) + 8 * sizeof(ChunkOffset));
+}
+
+}  // namespace opossum
@@ -0,0 +1,154 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_pos_list.hpp"
+#include "storage/pos_ranges.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterables.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/memory_pool.hpp"
+
+namespace opossum {
+
+class PosRangesTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // sorted values 0..99 in two chunks, the first one dictionary-encoded
+    _table = std::make_shared<Table>(50);
+    _table->add_column("a", DataType::Int);
+    for (auto value = 0; value < 100; ++value) _table->append({value});
+    _table->compress_chunk(ChunkID{0});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(PosRangesTest, AppendExtendsRanges) {
+  auto pos_ranges = PosRanges{ChunkID{3}};
+  for (const auto chunk_offset : {2u, 3u, 4u, 7u, 9u, 10u}) pos_ranges.append(chunk_offset);
+
+  ASSERT_EQ(pos_ranges.ranges().size(), 3u);
+  EXPECT_EQ(pos_ranges.ranges()[0].begin, 2u);
+  EXPECT_EQ(pos_ranges.ranges()[0].end, 5u);
+  EXPECT_EQ(pos_ranges.ranges()[2].begin, 9u);
+  EXPECT_EQ(pos_ranges.ranges()[2].end, 11u);
+  EXPECT_EQ(pos_ranges.first_position(2), 4u);
+  EXPECT_EQ(pos_ranges.size(), 6u);
+
+  EXPECT_EQ(pos_ranges[0], (RowID{ChunkID{3}, 2}));
+  EXPECT_EQ(pos_ranges[3], (RowID{ChunkID{3}, 7}));
+  EXPECT_EQ(pos_ranges[5], (RowID{ChunkID{3}, 10}));
+
+  const auto expected = PosList{RowID{ChunkID{3}, 2}, RowID{ChunkID{3}, 3}, RowID{ChunkID{3}, 4},
+                                RowID{ChunkID{3}, 7}, RowID{ChunkID{3}, 9}, RowID{ChunkID{3}, 10}};
+  EXPECT_EQ(pos_ranges.to_pos_list(), expected);
+}
+
+TEST_F(PosRangesTest, CompressOnlyLongRuns) {
+  const auto memory_pool = std::make_shared<MemoryPool>();
+
+  auto contiguous = PosList{};
+  for (auto chunk_offset = ChunkOffset{10}; chunk_offset < 30; ++chunk_offset) {
+    contiguous.emplace_back(RowID{ChunkID{1}, chunk_offset});
+  }
+  const auto pos_ranges = compress_pos_list(contiguous, memory_pool);
+  ASSERT_NE(pos_ranges, nullptr);
+  EXPECT_EQ(pos_ranges->ranges().size(), 1u);
+  EXPECT_EQ(pos_ranges->to_pos_list(), contiguous);
+
+  // every other row
+  auto scattered = PosList{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 40; chunk_offset += 2) {
+    scattered.emplace_back(RowID{ChunkID{1}, chunk_offset});
+  }
+  EXPECT_EQ(compress_pos_list(scattered, memory_pool), nullptr);
+
+  // positions in several chunks
+  contiguous.emplace_back(RowID{ChunkID{2}, 30});
+  EXPECT_EQ(compress_pos_list(contiguous, memory_pool), nullptr);
+
+  EXPECT_EQ(compress_pos_list(PosList{}, memory_pool), nullptr);
+}
+
+TEST_F(PosRangesTest, CompressChunkPosList) {
+  const auto memory_pool = std::make_shared<MemoryPool>();
+
+  // the runs are counted while positions are added and removed
+  auto chunk_pos_list = ChunkPosList{ChunkID{1}};
+  for (auto chunk_offset = ChunkOffset{10}; chunk_offset < 30; ++chunk_offset) chunk_pos_list.append(chunk_offset);
+  chunk_pos_list.append(40);
+  EXPECT_EQ(chunk_pos_list.run_count(), 2u);
+  chunk_pos_list.remove_if([](const ChunkOffset chunk_offset, const size_t) { return chunk_offset % 10 == 5; });
+  EXPECT_EQ(chunk_pos_list.run_count(), 4u);
+
+  const auto pos_ranges = compress_pos_list(chunk_pos_list, memory_pool);
+  ASSERT_NE(pos_ranges, nullptr);
+  EXPECT_EQ(pos_ranges->ranges().size(), 4u);
+  EXPECT_EQ(pos_ranges->to_pos_list(), chunk_pos_list.to_pos_list());
+
+  // every other row
+  chunk_pos_list.remove_if([](const ChunkOffset chunk_offset, const size_t) { return chunk_offset % 2 == 1; });
+  EXPECT_EQ(chunk_pos_list.run_count(), chunk_pos_list.size());
+  EXPECT_EQ(compress_pos_list(chunk_pos_list, memory_pool), nullptr);
+
+  EXPECT_EQ(compress_pos_list(ChunkPosList{ChunkID{1}}, memory_pool), nullptr);
+}
+
+TEST_F(PosRangesTest, ReferenceSegment) {
+  auto pos_ranges = std::make_shared<PosRanges>(ChunkID{0});
+  for (const auto chunk_offset : {5u, 6u, 7u, 20u, 21u}) pos_ranges->append(chunk_offset);
+  const auto segment = ReferenceSegment{_table, ColumnID{0}, pos_ranges};
+
+  EXPECT_EQ(segment.size(), 5u);
+  EXPECT_EQ(segment[3], AllTypeVariant{20});
+
+  auto values = std::vector<std::pair<int32_t, ChunkOffset>>{};
+  segment_for_each<int32_t>(segment, [&](const int32_t value, const ChunkOffset chunk_offset) {
+    values.emplace_back(value, chunk_offset);
+  });
+  const auto expected = std::vector<std::pair<int32_t, ChunkOffset>>{{5, 0}, {6, 1}, {7, 2}, {20, 3}, {21, 4}};
+  EXPECT_EQ(values, expected);
+
+  // The RowIDs are created for consumers that ask for them
+  EXPECT_EQ(*segment.pos_list(), pos_ranges->to_pos_list());
+}
+
+TEST_F(PosRangesTest, ScanOnSortedData) {
+  const auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 30);
+  scan->execute();
+  const auto output = scan->get_output();
+  ASSERT_EQ(output->row_count(), 70u);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(
+        output->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    ASSERT_NE(segment->pos_ranges(), nullptr);
+    EXPECT_EQ(segment->pos_ranges()->ranges().size(), 1u);
+  }
+
+  // A scan on the ranges references the rows of the original table
+  const auto second_scan = std::make_shared<TableScan>(scan, ColumnID{0}, ScanType::OpLessThan, 60);
+  second_scan->execute();
+  const auto second_output = second_scan->get_output();
+  ASSERT_EQ(second_output->row_count(), 30u);
+  auto expected_value = 30;
+  for (auto chunk_id = ChunkID{0}; chunk_id < second_output->chunk_count(); ++chunk_id) {
+    const auto& segment = *second_output->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    segment_for_each<int32_t>(segment, [&](const int32_t value, const ChunkOffset) {
+      EXPECT_EQ(value, expected_value++);
+    });
+  }
+}
+
+}  // namespace opossum
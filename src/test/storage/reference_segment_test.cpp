@@ -21,9 +21,9 @@ namespace opossum {
 
 class ReferenceSegmentTest : public ::testing::Test {
   virtual void SetUp() {
-    _test_table = std::make_shared<opossum::Table>(opossum::Table(3));
-    _test_table->add_column("a", "int");
-    _test_table->add_column("b", "float");
+    _test_table = std::make_shared<opossum::Table>(3);
+    _test_table->add_column("a", DataType::Int);
+    _test_table->add_column("b", DataType::Float);
     _test_table->append({123, 456.7f});
     _test_table->append({1234, 457.7f});
     _test_table->append({12345, 458.7f});
@@ -31,8 +31,8 @@ class ReferenceSegmentTest : public ::testing::Test {
     _test_table->append({12345, 458.7f});
 
     _test_table_dict = std::make_shared<opossum::Table>(5);
-    _test_table_dict->add_column("a", "int");
-    _test_table_dict->add_column("b", "int");
+    _test_table_dict->add_column("a", DataType::Int);
+    _test_table_dict->add_column("b", DataType::Int);
     for (int i = 0; i <= 24; i += 2) _test_table_dict->append({i, 100 + i});
 
     _test_table_dict->compress_chunk(ChunkID(0));
@@ -59,7 +59,7 @@ TEST_F(ReferenceSegmentTest, RetrievesValues) {
       std::initializer_list<RowID>({RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}}));
   auto reference_segment = ReferenceSegment(_test_table, ColumnID{0}, pos_list);
 
-  auto& column = *(_test_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  auto& column = *(_test_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
 
   EXPECT_EQ(reference_segment[0], column[0]);
   EXPECT_EQ(reference_segment[1], column[1]);
@@ -72,7 +72,7 @@ TEST_F(ReferenceSegmentTest, RetrievesValuesOutOfOrder) {
       std::initializer_list<RowID>({RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2}, RowID{ChunkID{0}, 0}}));
   auto reference_segment = ReferenceSegment(_test_table, ColumnID{0}, pos_list);
 
-  auto& column = *(_test_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  auto& column = *(_test_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
 
   EXPECT_EQ(reference_segment[0], column[1]);
   EXPECT_EQ(reference_segment[1], column[2]);
@@ -85,8 +85,8 @@ TEST_F(ReferenceSegmentTest, RetrievesValuesFromChunks) {
       std::initializer_list<RowID>({RowID{ChunkID{0}, 2}, RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 1}}));
   auto reference_segment = ReferenceSegment(_test_table, ColumnID{0}, pos_list);
 
-  auto& column_1 = *(_test_table->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
-  auto& column_2 = *(_test_table->get_chunk(ChunkID{1}).get_segment(ColumnID{0}));
+  auto& column_1 = *(_test_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  auto& column_2 = *(_test_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0}));
 
   EXPECT_EQ(reference_segment[0], column_1[2]);
   EXPECT_EQ(reference_segment[2], column_2[1]);
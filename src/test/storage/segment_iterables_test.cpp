@@ -0,0 +1,141 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "resolve_type.hpp"
+#include "storage/chunk_pos_list.hpp"
+#include "storage/materialize.hpp"
+#include "storage/pos_ranges.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterables.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/memory_pool.hpp"
+
+namespace opossum {
+
+class SegmentIterablesTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // chunk 0 is dictionary-encoded, chunk 1 is not
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", DataType::String);
+    for (const auto& value : {"c", "a", "b", "e", "d"}) _table->append({value});
+    _table->compress_chunk(ChunkID{0});
+  }
+
+  template <typename T>
+  std::vector<std::pair<T, ChunkOffset>> iterate(const BaseSegment& segment) {
+    auto result = std::vector<std::pair<T, ChunkOffset>>{};
+    segment_for_each<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) {
+      result.emplace_back(value, chunk_offset);
+    });
+    return result;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(SegmentIterablesTest, ValueSegment) {
+  const auto& segment = *_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0});
+  const auto expected = std::vector<std::pair<std::string, ChunkOffset>>{{"e", 0}, {"d", 1}};
+  EXPECT_EQ(iterate<std::string>(segment), expected);
+}
+
+TEST_F(SegmentIterablesTest, DictionarySegment) {
+  const auto& segment = *_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto expected = std::vector<std::pair<std::string, ChunkOffset>>{{"c", 0}, {"a", 1}, {"b", 2}};
+  EXPECT_EQ(iterate<std::string>(segment), expected);
+}
+
+TEST_F(SegmentIterablesTest, WideDictionarySegment) {
+  // more than 255 values need an attribute vector with two bytes per value id
+  const auto table = std::make_shared<Table>(1'000);
+  table->add_column("a", DataType::Int);
+  for (auto value = 0; value < 1'000; ++value) table->append({value % 300});
+  table->compress_chunk(ChunkID{0});
+
+  const auto values = iterate<int32_t>(*table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_EQ(values.size(), 1'000u);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1'000; ++chunk_offset) {
+    EXPECT_EQ(values[chunk_offset], std::make_pair(static_cast<int32_t>(chunk_offset % 300), chunk_offset));
+  }
+}
+
+TEST_F(SegmentIterablesTest, ReferenceSegment) {
+  // The positions alternate between the encodings of the referenced chunks
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>{
+      RowID{ChunkID{1}, 1}, RowID{ChunkID{0}, 2}, RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}});
+  const auto segment = ReferenceSegment{_table, ColumnID{0}, pos_list};
+  const auto expected = std::vector<std::pair<std::string, ChunkOffset>>{{"d", 0}, {"b", 1}, {"c", 2}, {"e", 3}};
+  EXPECT_EQ(iterate<std::string>(segment), expected);
+}
+
+TEST_F(SegmentIterablesTest, MaterializeReferenceSegment) {
+  const auto memory_pool = std::make_shared<MemoryPool>();
+  const auto table = std::make_shared<Table>(2'000);
+  table->add_column("a", DataType::Int);
+  for (auto value = 0; value < 4'000; ++value) table->append({value % 300});
+  table->compress_chunk(ChunkID{0});
+
+  // scattered positions in the dictionary-encoded and the unencoded chunk, more than a batch per chunk
+  auto pos_list = std::make_shared<PosList>();
+  for (auto chunk_offset = ChunkOffset{1'999}; chunk_offset >= 3; chunk_offset -= 3) {
+    pos_list->emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 2'000; chunk_offset += 2) {
+    pos_list->emplace_back(RowID{ChunkID{1}, chunk_offset});
+  }
+  const auto chunk_pos_list = make_chunk_pos_list(PosList(pos_list->cbegin() + 666, pos_list->cend()), memory_pool);
+  auto pos_ranges = std::make_shared<PosRanges>(ChunkID{0});
+  for (auto chunk_offset = ChunkOffset{10}; chunk_offset < 1'900; ++chunk_offset) pos_ranges->append(chunk_offset);
+
+  for (const auto& segment : {std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list),
+                              std::make_shared<ReferenceSegment>(table, ColumnID{0}, chunk_pos_list),
+                              std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_ranges)}) {
+    // The values are appended to the existing ones
+    auto values = std::vector<int32_t>{-1};
+    materialize_values(*segment, values);
+    ASSERT_EQ(values.size(), segment->size() + 1);
+    EXPECT_EQ(values.front(), -1);
+    for (auto position = size_t{0}; position < segment->size(); ++position) {
+      EXPECT_EQ(AllTypeVariant{values[position + 1]}, (*segment)[position]);
+    }
+  }
+
+  // Strings are copied one by one
+  const auto string_pos_list = std::make_shared<PosList>(
+      std::initializer_list<RowID>{RowID{ChunkID{1}, 1}, RowID{ChunkID{0}, 2}, RowID{ChunkID{0}, 0}});
+  auto strings = std::vector<std::string>{};
+  materialize_values(ReferenceSegment{_table, ColumnID{0}, string_pos_list}, strings);
+  EXPECT_EQ(strings, (std::vector<std::string>{"d", "b", "c"}));
+}
+
+TEST_F(SegmentIterablesTest, ResolveSegmentType) {
+  auto resolved_types = std::vector<std::string>{};
+  const auto resolve = [&](const BaseSegment& segment) {
+    resolve_segment_type<std::string>(segment, [&](const auto& typed_segment) {
+      using SegmentType = std::decay_t<decltype(typed_segment)>;
+      if constexpr (std::is_same_v<SegmentType, ValueSegment<std::string>>) resolved_types.emplace_back("value");
+      if constexpr (std::is_same_v<SegmentType, DictionarySegment<std::string>>) resolved_types.emplace_back("dict");
+      if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) resolved_types.emplace_back("reference");
+    });
+  };
+
+  resolve(*_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  resolve(*_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0}));
+  resolve(ReferenceSegment{_table, ColumnID{0}, std::make_shared<PosList>()});
+  EXPECT_EQ(resolved_types, (std::vector<std::string>{"dict", "value", "reference"}));
+
+  // The data type of the segment has to match
+  EXPECT_THROW(resolve_segment_type<int32_t>(*_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0}),
+                                             [](const auto&) {}),
+               std::logic_error);
+}
+
+}  // namespace opossum
@@ -1,4 +1,8 @@
+#include <atomic>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -50,4 +54,36 @@ TEST_F(StorageStorageManagerTest, HasTable) {
   EXPECT_EQ(sm.has_table("first_table"), true);
 }
 
+TEST_F(StorageStorageManagerTest, DroppedTableStaysAlive) {
+  auto& sm = StorageManager::get();
+  auto table = sm.get_table("second_table");
+  sm.drop_table("second_table");
+  EXPECT_EQ(table->chunk_size(), 4u);
+}
+
+TEST_F(StorageStorageManagerTest, ConcurrentLookupsAndDDL) {
+  auto& sm = StorageManager::get();
+
+  auto ddl_done = std::atomic_bool{false};
+  auto readers = std::vector<std::thread>{};
+  for (auto reader_id = 0; reader_id < 4; ++reader_id) {
+    readers.emplace_back([&]() {
+      while (!ddl_done) {
+        // tables that are not dropped are always found
+        EXPECT_EQ(sm.get_table("second_table")->chunk_size(), 4u);
+        if (sm.has_table("ddl_table")) sm.table_names();
+      }
+    });
+  }
+
+  for (auto iteration = 0; iteration < 1'000; ++iteration) {
+    sm.add_table("ddl_table", std::make_shared<Table>());
+    sm.drop_table("ddl_table");
+  }
+  ddl_done = true;
+  for (auto& reader : readers) reader.join();
+
+  EXPECT_EQ(sm.table_names().size(), 2u);
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -8,15 +9,19 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/index/adaptive_radix_tree/adaptive_radix_tree_table_index.hpp"
+#include "../lib/storage/index/b_tree/b_tree_index.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
 
 namespace opossum {
 
 class StorageTableTest : public BaseTest {
  protected:
   void SetUp() override {
-    t.add_column("col_1", "int");
-    t.add_column("col_2", "string");
+    t.add_column("col_1", DataType::Int);
+    t.add_column("col_2", DataType::String);
   }
 
   Table t{2};
@@ -58,8 +63,8 @@ TEST_F(StorageTableTest, GetColumnName) {
 }
 
 TEST_F(StorageTableTest, GetColumnType) {
-  EXPECT_EQ(t.column_type(ColumnID{0}), "int");
-  EXPECT_EQ(t.column_type(ColumnID{1}), "string");
+  EXPECT_EQ(t.column_type(ColumnID{0}), DataType::Int);
+  EXPECT_EQ(t.column_type(ColumnID{1}), DataType::String);
   // TODO(anyone): Do we want checks here?
   // EXPECT_THROW(t.column_type(ColumnID{2}), std::exception);
 }
@@ -79,7 +84,203 @@ TEST_F(StorageTableTest, CompressChunk) {
   t.append({0, "String"});
   EXPECT_EQ(t.row_count(), t.chunk_size());
   EXPECT_NO_THROW(t.compress_chunk(ChunkID{0}));
-  EXPECT_ANY_THROW(t.get_chunk(ChunkID{0}).append({0, "String"}));
+  EXPECT_ANY_THROW(t.get_chunk(ChunkID{0})->append({0, "String"}));
+}
+
+TEST_F(StorageTableTest, CompressChunkKeepsIndexes) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  const auto index = t.get_chunk(ChunkID{0})->create_index<BTreeIndex>(ColumnID{0});
+
+  t.compress_chunk(ChunkID{0});
+  EXPECT_EQ(t.get_chunk(ChunkID{0})->get_index(SegmentIndexType::BTree, ColumnID{0}), index);
+}
+
+TEST_F(StorageTableTest, TableIndexIsMaintained) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.compress_chunk(ChunkID{0});
+
+  // existing rows are indexed on creation, new rows when they are appended
+  const auto index = t.create_table_index(ColumnID{1});
+  EXPECT_EQ(t.get_table_index(ColumnID{1}), index);
+  EXPECT_EQ(t.get_table_index(ColumnID{0}), nullptr);
+
+  t.append({3, "world"});
+  EXPECT_EQ(index->lookup("world"), (PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0}}));
+  EXPECT_EQ(index->lookup("Hello,"), (PosList{RowID{ChunkID{0}, 0}}));
+  EXPECT_TRUE(index->lookup("!").empty());
+
+  Chunk chunk;
+  chunk.add_segment(std::make_shared<ValueSegment<int32_t>>());
+  chunk.add_segment(std::make_shared<ValueSegment<std::string>>());
+  chunk.append({5, "!"});
+  t.emplace_chunk(std::move(chunk));
+  EXPECT_EQ(index->lookup("!"), (PosList{RowID{ChunkID{2}, 0}}));
+}
+
+TEST_F(StorageTableTest, TableIndexCreatedDuringAppends) {
+  auto table = Table{100};
+  table.add_column("value", DataType::Int);
+
+  constexpr auto thread_count = 4;
+  constexpr auto rows_per_thread = 2'000;
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto row = 0; row < rows_per_thread; ++row) table.append({thread_id * rows_per_thread + row});
+    });
+  }
+  const auto index = table.create_table_index(ColumnID{0});
+  for (auto& thread : threads) thread.join();
+
+  // rows appended before, while, and after the index was created are all indexed once, at their actual position
+  for (auto value = 0; value < thread_count * rows_per_thread; ++value) {
+    const auto row_ids = index->lookup(value);
+    ASSERT_EQ(row_ids.size(), 1u);
+    const auto& segment = *table.get_chunk(row_ids[0].chunk_id)->get_segment(ColumnID{0});
+    EXPECT_EQ(segment[row_ids[0].chunk_offset], AllTypeVariant{value});
+  }
+}
+
+TEST_F(StorageTableTest, TableIndexLookupsDuringAppends) {
+  auto table = Table{100};
+  table.add_column("id", DataType::Int);
+  table.create_table_index(ColumnID{0});
+
+  constexpr auto row_count = 5'000;
+  auto writer = std::thread{[&]() {
+    for (auto row = 0; row < row_count; ++row) table.append({row});
+  }};
+
+  // every id is found at most once, and at its actual position
+  const auto index = table.get_table_index(ColumnID{0});
+  auto found_last_row = false;
+  for (auto lookup = 0; !found_last_row; ++lookup) {
+    const auto id = lookup % row_count;
+    const auto row_ids = index->lookup(id);
+    ASSERT_LE(row_ids.size(), 1u);
+    if (!row_ids.empty()) EXPECT_EQ(row_ids[0], (RowID{ChunkID{static_cast<uint32_t>(id / 100)}, id % 100}));
+    found_last_row = !index->lookup(row_count - 1).empty();
+  }
+
+  writer.join();
+  EXPECT_EQ(index->key_count(), static_cast<size_t>(row_count));
+}
+
+TEST_F(StorageTableTest, AppendRejectsUnconvertibleValues) {
+  // a failed append must not leave a reserved row behind that later rows wait for
+  t.append({4, "Hello,"});
+  EXPECT_ANY_THROW(t.append({"abc", "world"}));
+  t.append({6, "world"});
+  t.append({3, "!"});
+
+  EXPECT_EQ(t.row_count(), 3u);
+  EXPECT_EQ((*t.get_chunk(ChunkID{0})->get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+  EXPECT_EQ((*t.get_chunk(ChunkID{1})->get_segment(ColumnID{0}))[0], AllTypeVariant{3});
+}
+
+TEST_F(StorageTableTest, ConcurrentAppends) {
+  auto table = Table{100};
+  table.add_column("thread", DataType::Int);
+  table.add_column("row", DataType::Int);
+
+  constexpr auto thread_count = 8;
+  constexpr auto rows_per_thread = 1'000;
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto row = 0; row < rows_per_thread; ++row) table.append({thread_id, row});
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(table.row_count(), static_cast<uint64_t>(thread_count * rows_per_thread));
+  EXPECT_EQ(table.chunk_count(), ChunkID{thread_count * rows_per_thread / 100});
+
+  // every row was written exactly once, and the rows of each thread keep their order
+  auto next_rows = std::vector<int32_t>(thread_count, 0);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    EXPECT_EQ(chunk->size(), 100u);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      const auto thread_id = type_cast<int32_t>((*chunk->get_segment(ColumnID{0}))[chunk_offset]);
+      EXPECT_EQ(type_cast<int32_t>((*chunk->get_segment(ColumnID{1}))[chunk_offset]), next_rows[thread_id]++);
+    }
+  }
+}
+
+TEST_F(StorageTableTest, ReadsDuringAppendsAndCompression) {
+  auto table = Table{100};
+  table.add_column("row", DataType::Int);
+
+  constexpr auto row_count = 10'000;
+  auto writer = std::thread{[&]() {
+    for (auto row = 0; row < row_count; ++row) table.append({row});
+  }};
+
+  // a chunk is full once the next one exists, since there is only one writer
+  auto compressor = std::thread{[&]() {
+    for (auto chunk_id = ChunkID{0}; chunk_id < row_count / 100; ++chunk_id) {
+      while (table.chunk_count() <= chunk_id + 1 && table.row_count() < row_count) std::this_thread::yield();
+      table.compress_chunk(chunk_id);
+    }
+  }};
+
+  auto visible_row_count = uint64_t{0};
+  while (visible_row_count < row_count) {
+    auto row_count_in_chunks = uint64_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      const auto segment = chunk->get_segment(ColumnID{0});
+      const auto chunk_size = chunk->size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; chunk_offset += 10) {
+        ASSERT_EQ(type_cast<int32_t>((*segment)[chunk_offset]), static_cast<int32_t>(chunk_id * 100 + chunk_offset));
+      }
+      row_count_in_chunks += chunk_size;
+    }
+
+    // rows never disappear
+    EXPECT_GE(row_count_in_chunks, visible_row_count);
+    visible_row_count = row_count_in_chunks;
+  }
+
+  writer.join();
+  compressor.join();
+  EXPECT_EQ(table.row_count(), static_cast<uint64_t>(row_count));
+  EXPECT_NE(std::dynamic_pointer_cast<const BaseDictionarySegment>(
+                table.get_chunk(ChunkID{99})->get_segment(ColumnID{0})),
+            nullptr);
+}
+
+TEST_F(StorageTableTest, ReadsDuringAppendsToGrowingChunks) {
+  // chunks of the default size start small and are replaced by larger copies while rows are appended
+  auto table = Table{};
+  table.add_column("row", DataType::Int);
+
+  constexpr auto row_count = 10'000;
+  auto writer = std::thread{[&]() {
+    for (auto row = 0; row < row_count; ++row) table.append({row});
+  }};
+
+  auto visible_row_count = ChunkOffset{0};
+  while (visible_row_count < row_count) {
+    const auto chunk = table.get_chunk(ChunkID{0});
+    const auto chunk_size = chunk->size();
+    const auto segment = std::static_pointer_cast<const ValueSegment<int32_t>>(chunk->get_segment(ColumnID{0}));
+    const auto& values = segment->values();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      ASSERT_EQ(values[chunk_offset], static_cast<int32_t>(chunk_offset));
+    }
+
+    // rows never disappear
+    EXPECT_GE(chunk_size, visible_row_count);
+    visible_row_count = chunk_size;
+  }
+
+  writer.join();
+  EXPECT_EQ(table.chunk_count(), 1u);
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->capacity(), 16u * Table::INITIAL_APPEND_CHUNK_CAPACITY);
 }
 
 }  // namespace opossum
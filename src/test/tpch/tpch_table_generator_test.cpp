@@ -0,0 +1,96 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tpch/tpch_queries.hpp"
+#include "tpch/tpch_table_generator.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+class TpchTableGeneratorTest : public BaseTest {
+ protected:
+  void TearDown() override { StorageManager::reset(); }
+};
+
+TEST_F(TpchTableGeneratorTest, RowCounts) {
+  const auto tables = TpchTableGenerator{0.01f, 1'000}.generate();
+
+  ASSERT_EQ(tables.size(), 8u);
+  EXPECT_EQ(tables.at("region")->row_count(), 5u);
+  EXPECT_EQ(tables.at("nation")->row_count(), 25u);
+  EXPECT_EQ(tables.at("supplier")->row_count(), 100u);
+  EXPECT_EQ(tables.at("customer")->row_count(), 1'500u);
+  EXPECT_EQ(tables.at("part")->row_count(), 2'000u);
+  EXPECT_EQ(tables.at("partsupp")->row_count(), 8'000u);
+  EXPECT_EQ(tables.at("orders")->row_count(), 15'000u);
+  EXPECT_EQ(tables.at("orders")->chunk_count(), 15u);
+
+  // one to seven lineitems per order
+  const auto lineitem_count = tables.at("lineitem")->row_count();
+  EXPECT_GT(lineitem_count, 15'000u * 3);
+  EXPECT_LT(lineitem_count, 15'000u * 5);
+}
+
+TEST_F(TpchTableGeneratorTest, Deterministic) {
+  const auto first_lineitem = TpchTableGenerator{0.001f, 500}.generate().at("lineitem");
+  const auto second_lineitem = TpchTableGenerator{0.001f, 500}.generate().at("lineitem");
+
+  EXPECT_TABLE_EQ(first_lineitem, second_lineitem, true);
+}
+
+TEST_F(TpchTableGeneratorTest, Values) {
+  const auto tables = TpchTableGenerator{0.001f}.generate();
+  const auto orders = tables.at("orders")->get_chunk(ChunkID{0});
+  const auto lineitem = tables.at("lineitem")->get_chunk(ChunkID{0});
+
+  // the first order key is 1, and its lineitems come first
+  EXPECT_EQ(type_cast<int32_t>((*orders->get_segment(ColumnID{0}))[0]), 1);
+  EXPECT_EQ(type_cast<int32_t>((*lineitem->get_segment(ColumnID{0}))[0]), 1);
+  EXPECT_EQ(type_cast<int32_t>((*lineitem->get_segment(ColumnID{3}))[0]), 1);
+
+  for (auto row = size_t{0}; row < orders->size(); ++row) {
+    const auto order_date = type_cast<std::string>((*orders->get_segment(ColumnID{4}))[row]);
+    EXPECT_GE(order_date, "1992-01-01");
+    EXPECT_LE(order_date, "1998-08-02");
+    EXPECT_EQ(order_date.size(), 10u);
+  }
+}
+
+TEST_F(TpchTableGeneratorTest, DictionaryEncoding) {
+  const auto tables = TpchTableGenerator{0.001f, 100, true}.generate();
+  const auto& customer = tables.at("customer");
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < customer->chunk_count(); ++chunk_id) {
+    const auto segment = customer->get_chunk(chunk_id)->get_segment(ColumnID{4});
+    const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<std::string>>(segment);
+    ASSERT_TRUE(dictionary_segment);
+    EXPECT_LE(dictionary_segment->unique_values_count(), 5u);
+  }
+}
+
+TEST_F(TpchTableGeneratorTest, QueriesRun) {
+  TpchTableGenerator{0.005f, 1'000}.generate_and_store();
+
+  for (const auto& query : tpch_queries()) {
+    const auto plan = query.make_plan();
+    CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(plan));
+
+    // all queries aggregate into a single row
+    EXPECT_EQ(plan->get_output()->row_count(), 1u) << query.name;
+    const auto count = type_cast<int64_t>((*plan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{1}))[0]);
+    if (query.name != "TPC-H 1" && query.name != "TPC-H 14") {
+      EXPECT_GT(count, 0) << query.name;
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/gather.hpp"
+
+namespace opossum {
+
+class GatherTest : public BaseTest {
+ protected:
+  // gathers descending, scattered positions, which are prefetched. 101 positions are not a multiple of the SIMD width.
+  template <typename T>
+  void test_gather(const std::vector<T>& source) {
+    auto indices = std::vector<uint32_t>{};
+    for (auto index = static_cast<uint32_t>(source.size()); index > 100; index -= 97) indices.push_back(index - 1);
+
+    auto output = std::vector<T>(indices.size());
+    gather(source.data(), indices.data(), indices.size(), output.data());
+    for (auto position = size_t{0}; position < indices.size(); ++position) {
+      EXPECT_EQ(output[position], source[indices[position]]);
+    }
+  }
+
+  template <typename T>
+  std::vector<T> make_source() {
+    auto source = std::vector<T>{};
+    for (auto value = 0; value < 9'897; ++value) source.emplace_back(static_cast<T>(value * 3));
+    return source;
+  }
+};
+
+TEST_F(GatherTest, FixedWidthValues) {
+  test_gather(make_source<int32_t>());
+  test_gather(make_source<int64_t>());
+  test_gather(make_source<float>());
+  test_gather(make_source<double>());
+}
+
+TEST_F(GatherTest, Strings) {
+  auto source = std::vector<std::string>{};
+  for (auto value = 0; value < 9'897; ++value) source.emplace_back(std::to_string(value));
+  test_gather(source);
+}
+
+TEST_F(GatherTest, WidensNarrowValues) {
+  const auto source = std::vector<uint8_t>{7, 200, 3};
+  const auto indices = std::vector<uint32_t>{2, 1, 1, 0};
+  auto output = std::vector<uint32_t>(indices.size());
+  gather(source.data(), indices.data(), indices.size(), output.data());
+  EXPECT_EQ(output, (std::vector<uint32_t>{3, 200, 200, 7}));
+}
+
+TEST_F(GatherTest, ScatteredPositions) {
+  const auto dense = std::vector<uint32_t>{0, 1, 3, 4, 6};
+  EXPECT_FALSE(are_positions_scattered<int32_t>(dense.data(), dense.size()));
+
+  const auto sparse = std::vector<uint32_t>{0, 100, 200, 300};
+  EXPECT_TRUE(are_positions_scattered<int32_t>(sparse.data(), sparse.size()));
+
+  const auto descending = std::vector<uint32_t>{4, 3, 2, 1};
+  EXPECT_TRUE(are_positions_scattered<int32_t>(descending.data(), descending.size()));
+}
+
+}  // namespace opossum
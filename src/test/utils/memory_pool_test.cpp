@@ -0,0 +1,78 @@
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/memory_pool.hpp"
+
+namespace opossum {
+
+class MemoryPoolTest : public BaseTest {};
+
+TEST_F(MemoryPoolTest, ReusesDeallocatedMemory) {
+  auto memory_pool = MemoryPool{};
+  const auto first = memory_pool.allocate(100);
+  const auto second = memory_pool.allocate(100);
+  EXPECT_NE(first, second);
+
+  // 100 and 120 bytes are in the same size class
+  memory_pool.deallocate(first, 100);
+  EXPECT_EQ(memory_pool.allocate(120), first);
+  EXPECT_NE(memory_pool.allocate(100), first);
+
+  // all allocations so far fit into the first block
+  EXPECT_EQ(memory_pool.allocated_bytes(), size_t{64} * 1024);
+}
+
+TEST_F(MemoryPoolTest, AllocatesLargeBlocks) {
+  auto memory_pool = MemoryPool{};
+  const auto large = static_cast<char*>(memory_pool.allocate(size_t{1} << 20));
+  large[(size_t{1} << 20) - 1] = 'x';
+  EXPECT_GE(memory_pool.allocated_bytes(), size_t{1} << 20);
+
+  memory_pool.deallocate(large, size_t{1} << 20);
+  EXPECT_EQ(memory_pool.allocate(size_t{1} << 20), large);
+}
+
+TEST_F(MemoryPoolTest, PooledPosListKeepsPoolAlive) {
+  auto memory_pool = std::make_shared<MemoryPool>();
+  const auto pos_list = make_pooled_pos_list(memory_pool);
+  EXPECT_EQ(pos_list->get_allocator().resource(), memory_pool.get());
+
+  memory_pool.reset();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 10'000; ++chunk_offset) {
+    pos_list->emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+  EXPECT_EQ(pos_list->back(), (RowID{ChunkID{0}, 9'999}));
+}
+
+TEST_F(MemoryPoolTest, ConcurrentPosLists) {
+  const auto memory_pool = std::make_shared<MemoryPool>();
+
+  auto threads = std::vector<std::thread>{};
+  auto pos_lists = std::vector<std::shared_ptr<PosList>>(8);
+  for (auto thread_id = size_t{0}; thread_id < pos_lists.size(); ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      const auto chunk_id = ChunkID{static_cast<uint32_t>(thread_id)};
+      for (auto iteration = 0; iteration < 10; ++iteration) {
+        pos_lists[thread_id] = make_pooled_pos_list(memory_pool);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1'000; ++chunk_offset) {
+          pos_lists[thread_id]->emplace_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  for (auto thread_id = size_t{0}; thread_id < pos_lists.size(); ++thread_id) {
+    const auto chunk_id = ChunkID{static_cast<uint32_t>(thread_id)};
+    ASSERT_EQ(pos_lists[thread_id]->size(), 1'000u);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1'000; ++chunk_offset) {
+      EXPECT_EQ((*pos_lists[thread_id])[chunk_offset], (RowID{chunk_id, chunk_offset}));
+    }
+  }
+}
+
+}  // namespace opossum
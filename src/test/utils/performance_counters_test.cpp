@@ -0,0 +1,85 @@
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+#include "utils/performance_counters.hpp"
+
+namespace opossum {
+
+class PerformanceCountersTest : public BaseTest {
+ protected:
+  void SetUp() override { PerformanceCounters::clear_kernel_statistics(); }
+
+  void TearDown() override {
+    PerformanceCounters::set_enabled(false);
+    PerformanceCounters::clear_kernel_statistics();
+  }
+};
+
+TEST_F(PerformanceCountersTest, Values) {
+  auto begin = PerformanceCounterValues{};
+  begin.values = {100u, 200u, std::nullopt, 5u};
+  auto end = PerformanceCounterValues{};
+  end.values = {300u, 600u, 10u, std::nullopt};
+
+  // counters missing on either side are unavailable
+  const auto difference = end - begin;
+  EXPECT_EQ(difference.get(PerformanceCounter::Cycles), 200u);
+  EXPECT_EQ(difference.get(PerformanceCounter::Instructions), 400u);
+  EXPECT_FALSE(difference.get(PerformanceCounter::CacheMisses));
+  EXPECT_FALSE(difference.get(PerformanceCounter::BranchMisses));
+  EXPECT_EQ(difference.to_string(100), "200 cycles (2.0/row), 400 instructions (4.0/row), 2.00 IPC");
+
+  auto sum = PerformanceCounterValues{};
+  sum += begin;
+  sum += begin;
+  EXPECT_EQ(sum.get(PerformanceCounter::Cycles), 200u);
+  EXPECT_FALSE(sum.get(PerformanceCounter::CacheMisses));
+
+  EXPECT_EQ(PerformanceCounterValues{}.to_string(), "no performance counters available");
+}
+
+TEST_F(PerformanceCountersTest, KernelStatistics) {
+  PerformanceCounters::set_enabled(true);
+
+  auto table = load_table("src/test/tables/int_float.tbl", 2);
+  table->compress_chunk(ChunkID{0});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1000);
+  scan->execute();
+
+  // kernels are measured whether or not the counters are available in this environment
+  const auto statistics = PerformanceCounters::kernel_statistics();
+  ASSERT_EQ(statistics.count("load_table"), 1u);
+  EXPECT_EQ(statistics.at("load_table").row_count, table->row_count());
+  EXPECT_EQ(statistics.at("DictionarySegment construction").invocation_count, 2u);
+  EXPECT_EQ(statistics.at("TableScan chunk").invocation_count, static_cast<uint64_t>(table->chunk_count()));
+  EXPECT_EQ(statistics.at("TableScan chunk").row_count, table->row_count());
+
+  const auto instructions = statistics.at("load_table").counters.get(PerformanceCounter::Instructions);
+  EXPECT_EQ(instructions.has_value(), PerformanceCounters::is_available(PerformanceCounter::Instructions));
+  if (instructions) {
+    EXPECT_GT(*instructions, 0u);
+  }
+
+  auto stream = std::stringstream{};
+  PerformanceCounters::print_kernel_statistics(stream);
+  EXPECT_NE(stream.str().find("load_table: 1 invocations, 3 rows"), std::string::npos);
+}
+
+TEST_F(PerformanceCountersTest, NothingMeasuredWhenDisabled) {
+  load_table("src/test/tables/int_float.tbl", 2);
+
+  EXPECT_TRUE(PerformanceCounters::kernel_statistics().empty());
+}
+
+}  // namespace opossum
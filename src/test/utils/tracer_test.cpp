@@ -0,0 +1,97 @@
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/pipeline.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+#include "utils/load_table.hpp"
+#include "utils/tracer.hpp"
+
+namespace opossum {
+
+class TracerTest : public BaseTest {
+ protected:
+  void SetUp() override { Tracer::clear(); }
+
+  void TearDown() override {
+    CurrentScheduler::set(nullptr);
+    Tracer::set_enabled(false);
+    Tracer::clear();
+  }
+
+  static size_t _count_occurrences(const std::string& text, const std::string& pattern) {
+    auto count = size_t{0};
+    for (auto position = text.find(pattern); position != std::string::npos;
+         position = text.find(pattern, position + 1)) {
+      ++count;
+    }
+    return count;
+  }
+};
+
+TEST_F(TracerTest, RecordsNothingWhenDisabled) {
+  { const auto trace_scope = TraceScope{"test", "disabled"}; }
+  load_table("src/test/tables/int_float.tbl", 2);
+
+  EXPECT_EQ(Tracer::event_count(), 0u);
+}
+
+TEST_F(TracerTest, ScopesOfSeveralThreads) {
+  Tracer::set_enabled(true);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < 4; ++thread_index) {
+    threads.emplace_back([]() {
+      // more events than fit into one block of the thread's buffer
+      for (auto event_index = 0; event_index < 1500; ++event_index) {
+        const auto trace_scope = TraceScope{"test", "event"};
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // the buffers of finished threads are kept
+  EXPECT_EQ(Tracer::event_count(), 6000u);
+
+  Tracer::clear();
+  EXPECT_EQ(Tracer::event_count(), 0u);
+}
+
+TEST_F(TracerTest, ChromeTrace) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::fake(1, 2)));
+  Tracer::set_enabled(true);
+
+  auto table = load_table("src/test/tables/int_float.tbl", 2);
+  table->compress_chunk(ChunkID{0});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1000);
+  const auto pipeline = std::make_shared<Pipeline>(scan);
+  table_wrapper->execute();
+  pipeline->execute();
+
+  auto stream = std::stringstream{};
+  Tracer::write_chrome_trace(stream);
+  const auto trace = stream.str();
+
+  EXPECT_EQ(trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0u);
+  EXPECT_EQ(_count_occurrences(trace, "\"name\":\"load_table src/test/tables/int_float.tbl\",\"cat\":\"load\""), 1u);
+  EXPECT_EQ(_count_occurrences(trace, "\"name\":\"compress chunk 0\",\"cat\":\"compression\""), 1u);
+  EXPECT_EQ(_count_occurrences(trace, "\"cat\":\"operator\""), 2u);
+  EXPECT_EQ(_count_occurrences(trace, "\"name\":\"Pipeline (TableScan column 0 > 1000)\""), 1u);
+  EXPECT_EQ(_count_occurrences(trace, "\"cat\":\"chunk\""), static_cast<size_t>(table->chunk_count()));
+  EXPECT_EQ(_count_occurrences(trace, "\"ph\":\"X\""), Tracer::event_count());
+}
+
+}  // namespace opossum